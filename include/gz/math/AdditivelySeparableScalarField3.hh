@@ -17,12 +17,18 @@
 #ifndef GZ_MATH_SEPARABLE_SCALAR_FIELD3_HH_
 #define GZ_MATH_SEPARABLE_SCALAR_FIELD3_HH_
 
+#include <algorithm>
+#include <cstddef>
 #include <limits>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gz/math/Region3.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
+#include <gz/math/detail/Simd.hh>
 
 namespace ignition
 {
@@ -30,7 +36,20 @@ namespace ignition
   {
     // Inline bracket to help doxygen filtering.
     inline namespace IGNITION_MATH_VERSION_NAMESPACE {
-    //
+    namespace detail {
+      /// \brief Whether a scalar function type has a batch
+      /// void Evaluate(const ScalarT *, ScalarT *, std::size_t, unsigned int)
+      /// method, like Polynomial3.
+      template<typename ScalarFunctionT, typename ScalarT, typename = void>
+      struct HasBatchEvaluate : std::false_type {};
+
+      template<typename ScalarFunctionT, typename ScalarT>
+      struct HasBatchEvaluate<ScalarFunctionT, ScalarT, std::void_t<
+          decltype(std::declval<const ScalarFunctionT &>().Evaluate(
+              std::declval<const ScalarT *>(), std::declval<ScalarT *>(),
+              std::size_t(), 1u))>> : std::true_type {};
+    }  // namespace detail
+
     /** \class AdditivelySeparableScalarField3\
      * AdditivelySeparableScalarField3.hh\
      * ignition/math/AdditivelySeparableScalarField3.hh
@@ -92,6 +111,87 @@ namespace ignition
         return this->Evaluate(_point);
       }
 
+      /// \brief Evaluate the scalar field at each point of a contiguous
+      /// array: _values[i] = F(_points[i]). The points are split into
+      /// blocks of separate x, y and z arrays, see
+      /// Evaluate(const ScalarT *, const ScalarT *, const ScalarT *,
+      /// ScalarT *, std::size_t, unsigned int) const.
+      /// \param[in] _points Pointer to the first point.
+      /// \param[out] _values Pointer to the first result.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void Evaluate(const Vector3<ScalarT> *_points,
+                            ScalarT *_values, std::size_t _count,
+                            unsigned int _threads = 1) const
+      {
+        detail::ParallelFor(_count, _threads,
+            [this, _points, _values](const std::size_t _begin,
+                                     const std::size_t _end)
+            {
+              ScalarT x[kBlockSize], y[kBlockSize], z[kBlockSize];
+              for (std::size_t b = _begin; b < _end; b += kBlockSize)
+              {
+                const std::size_t n = std::min(kBlockSize, _end - b);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                  x[i] = _points[b + i].X();
+                  y[i] = _points[b + i].Y();
+                  z[i] = _points[b + i].Z();
+                }
+                this->EvaluateBlock(x, y, z, _values + b, n);
+              }
+            });
+      }
+
+      /// \brief Evaluate the scalar field at each point of a vector.
+      /// \param[in] _points Scalar field arguments.
+      /// \param[out] _values Results, resized to the number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa Evaluate(const Vector3<ScalarT> *, ScalarT *, std::size_t,
+      /// unsigned int) const
+      public: void Evaluate(const std::vector<Vector3<ScalarT>> &_points,
+                            std::vector<ScalarT> &_values,
+                            unsigned int _threads = 1) const
+      {
+        _values.resize(_points.size());
+        this->Evaluate(_points.data(), _values.data(), _points.size(),
+            _threads);
+      }
+
+      /// \brief Evaluate the scalar field at each point of a point set
+      /// stored as separate x, y and z arrays (structure of arrays):
+      /// _values[i] = F(_x[i], _y[i], _z[i]). This produces the same
+      /// results as calling Evaluate(const Vector3<ScalarT> &) on every
+      /// point. When ScalarFunctionT has a batch Evaluate method, like
+      /// Polynomial3, each of p, q and r is evaluated over a block of
+      /// values at a time.
+      /// \param[in] _x Array of _count x coordinates.
+      /// \param[in] _y Array of _count y coordinates.
+      /// \param[in] _z Array of _count z coordinates.
+      /// \param[out] _values Array of _count results. It may be equal to
+      /// one of the coordinate arrays.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void Evaluate(const ScalarT *_x, const ScalarT *_y,
+                            const ScalarT *_z, ScalarT *_values,
+                            std::size_t _count,
+                            unsigned int _threads = 1) const
+      {
+        detail::ParallelFor(_count, _threads,
+            [this, _x, _y, _z, _values](const std::size_t _begin,
+                                        const std::size_t _end)
+            {
+              for (std::size_t b = _begin; b < _end; b += kBlockSize)
+              {
+                const std::size_t n = std::min(kBlockSize, _end - b);
+                this->EvaluateBlock(_x + b, _y + b, _z + b, _values + b, n);
+              }
+            });
+      }
+
       /// \brief Compute scalar field minimum in a `_region`
       /// \param[in] _region scalar field argument set to check
       /// \param[out] _pMin scalar field argument that yields
@@ -171,6 +271,54 @@ namespace ignition
         return _out << ")]";
       }
 
+      /// \brief Evaluate the scalar field over a block of points.
+      /// \param[in] _x Array of _count x coordinates.
+      /// \param[in] _y Array of _count y coordinates.
+      /// \param[in] _z Array of _count z coordinates.
+      /// \param[out] _values Array of _count results. It may be equal to
+      /// one of the coordinate arrays.
+      /// \param[in] _count Number of points, at most kBlockSize.
+      private: void EvaluateBlock(const ScalarT *_x, const ScalarT *_y,
+                                  const ScalarT *_z, ScalarT *_values,
+                                  std::size_t _count) const
+      {
+        if constexpr (detail::HasBatchEvaluate<
+            ScalarFunctionT, ScalarT>::value)
+        {
+          ScalarT px[kBlockSize], qy[kBlockSize], rz[kBlockSize];
+          this->p.Evaluate(_x, px, _count, 1);
+          this->q.Evaluate(_y, qy, _count, 1);
+          this->r.Evaluate(_z, rz, _count, 1);
+          std::size_t i = 0;
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+          if constexpr (std::is_same_v<ScalarT, double>)
+          {
+            using namespace detail::simd;
+            const Double2 k2 = Splat(this->k);
+            for (; i + 2 <= _count; i += 2)
+            {
+              Store(_values + i, Mul(k2,
+                    Add(Add(Load(px + i), Load(qy + i)), Load(rz + i))));
+            }
+          }
+#endif
+          for (; i < _count; ++i)
+            _values[i] = this->k * (px[i] + qy[i] + rz[i]);
+        }
+        else
+        {
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            _values[i] = this->k * (
+                this->p(_x[i]) + this->q(_y[i]) + this->r(_z[i]));
+          }
+        }
+      }
+
+      /// \brief Number of points evaluated at a time by the batch
+      /// functions, small enough for the temporary arrays to stay in cache.
+      private: static constexpr std::size_t kBlockSize = 256;
+
       /// \brief Scalar constant
       private: ScalarT k;
 
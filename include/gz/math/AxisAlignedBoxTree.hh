@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_AXISALIGNEDBOXTREE_HH_
+#define GZ_MATH_AXISALIGNEDBOXTREE_HH_
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <gz/math/config.hh>
+#include "gz/math/AxisAlignedBox.hh"
+#include "gz/math/Vector3.hh"
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+  // Forward declaration.
+  class AxisAlignedBoxTreePrivate;
+
+  /// \brief A bounding volume hierarchy over a collection of axis aligned
+  /// boxes, used to answer ray and overlap queries without testing every
+  /// box.
+  ///
+  /// The tree is built with the surface area heuristic, using binned
+  /// partitions, and stored as a flat array of nodes. When the boxes move,
+  /// Refit() updates the bounds of the nodes without rebuilding the tree.
+  /// This is much faster than Build(), but queries get slower if the boxes
+  /// move far from their original positions.
+  ///
+  /// Queries are const and can run concurrently from several threads.
+  /// Boxes are identified by their position in the input. Invalid boxes,
+  /// such as a default constructed AxisAlignedBox, are never reported.
+  ///
+  /// \code{.cpp}
+  /// std::vector<gz::math::AxisAlignedBox> boxes = ...;
+  /// gz::math::AxisAlignedBoxTree tree(boxes);
+  /// auto hit = tree.Intersect(origin, dir, 0, 100);
+  /// if (std::get<0>(hit))
+  ///   std::cout << "Box " << std::get<2>(hit) << std::endl;
+  /// \endcode
+  class IGNITION_MATH_VISIBLE AxisAlignedBoxTree
+  {
+    /// \brief Index returned by the queries when no box is hit.
+    public: static constexpr std::size_t NoBox =
+      std::numeric_limits<std::size_t>::max();
+
+    /// \brief Constructor. Creates an empty tree.
+    public: AxisAlignedBoxTree();
+
+    /// \brief Constructor. Builds the tree.
+    /// \param[in] _boxes The boxes.
+    public: explicit AxisAlignedBoxTree(
+                const std::vector<AxisAlignedBox> &_boxes);
+
+    /// \brief Move constructor.
+    /// \param[in] _tree Tree to move.
+    public: AxisAlignedBoxTree(AxisAlignedBoxTree &&_tree) noexcept;
+
+    /// \brief Destructor.
+    public: ~AxisAlignedBoxTree();
+
+    /// \brief Move assignment operator.
+    /// \param[in] _tree Tree to move.
+    /// \return Reference to this tree.
+    public: AxisAlignedBoxTree &operator=(AxisAlignedBoxTree &&_tree) noexcept;
+
+    /// \brief Build the tree, replacing the previous content.
+    /// \param[in] _boxes Pointer to the first box.
+    /// \param[in] _count Number of boxes.
+    public: void Build(const AxisAlignedBox *_boxes, std::size_t _count);
+
+    /// \brief Build the tree, replacing the previous content.
+    /// \param[in] _boxes The boxes.
+    public: void Build(const std::vector<AxisAlignedBox> &_boxes);
+
+    /// \brief Update the tree after the boxes moved, keeping its structure.
+    /// \param[in] _boxes Pointer to the first box, in the same order used
+    /// to build the tree.
+    /// \param[in] _count Number of boxes.
+    /// \return False if _count is not the number of boxes in the tree.
+    public: bool Refit(const AxisAlignedBox *_boxes, std::size_t _count);
+
+    /// \brief Update the tree after the boxes moved, keeping its structure.
+    /// \param[in] _boxes The boxes, in the same order used to build the
+    /// tree.
+    /// \return False if the number of boxes changed.
+    public: bool Refit(const std::vector<AxisAlignedBox> &_boxes);
+
+    /// \brief Get the number of boxes.
+    /// \return The number of boxes.
+    public: std::size_t Size() const;
+
+    /// \brief Get the number of nodes.
+    /// \return The number of nodes.
+    public: std::size_t NodeCount() const;
+
+    /// \brief Get the box that contains all the boxes.
+    /// \return The bounds of the tree. The box is invalid if the tree is
+    /// empty.
+    public: AxisAlignedBox Bounds() const;
+
+    /// \brief Find the closest box hit by a ray. The result is the same as
+    /// testing every box with AxisAlignedBox::Intersect() and keeping the
+    /// closest hit.
+    /// \param[in] _origin Origin of the ray.
+    /// \param[in] _dir Direction of the ray. This ray will be normalized.
+    /// \param[in] _min Minimum allowed distance.
+    /// \param[in] _max Maximum allowed distance.
+    /// \return A boolean, double, std::size_t tuple. The boolean value is
+    /// true if the ray hits a box. The double is the distance from
+    /// _origin + _dir * _min to the closest intersection, like in
+    /// AxisAlignedBox::Intersect(). The std::size_t is the index of the box,
+    /// or NoBox if no box is hit.
+    public: std::tuple<bool, double, std::size_t> Intersect(
+                const Vector3d &_origin, const Vector3d &_dir,
+                const double _min, const double _max) const;
+
+    /// \brief Find the closest box hit by each ray of a batch.
+    /// \param[in] _origins Origins of the rays.
+    /// \param[in] _dirs Directions of the rays. They will be normalized.
+    /// \param[in] _count Number of rays.
+    /// \param[in] _min Minimum allowed distance.
+    /// \param[in] _max Maximum allowed distance.
+    /// \param[out] _indices Array with room for _count elements. Index of
+    /// the closest box hit by each ray, or NoBox.
+    /// \param[out] _distances Optional array with room for _count elements.
+    /// Distance to the closest hit, or infinity if there is no hit.
+    /// \param[in] _threads Maximum number of threads to use. Values of 0 or
+    /// 1 run on the calling thread.
+    public: void Intersect(const Vector3d *_origins, const Vector3d *_dirs,
+                           std::size_t _count,
+                           const double _min, const double _max,
+                           std::size_t *_indices,
+                           double *_distances = nullptr,
+                           unsigned int _threads = 1) const;
+
+    /// \brief Find all the boxes that intersect a box, as defined by
+    /// AxisAlignedBox::Intersects().
+    /// \param[in] _box The box to check.
+    /// \param[out] _indices Indices of the boxes, in no particular order.
+    /// The vector is cleared first, and its memory is reused.
+    public: void Overlaps(const AxisAlignedBox &_box,
+                          std::vector<std::size_t> &_indices) const;
+
+    /// \brief Find all the boxes that intersect a box, as defined by
+    /// AxisAlignedBox::Intersects().
+    /// \param[in] _box The box to check.
+    /// \return Indices of the boxes, in no particular order.
+    public: std::vector<std::size_t> Overlaps(
+                const AxisAlignedBox &_box) const;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+    /// \brief Private data pointer.
+    private: std::unique_ptr<AxisAlignedBoxTreePrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+  };
+  }
+}
+}
+#endif
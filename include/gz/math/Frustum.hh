@@ -17,8 +17,12 @@
 #ifndef GZ_MATH_FRUSTUM_HH_
 #define GZ_MATH_FRUSTUM_HH_
 
+#include <cstddef>
+#include <cstdint>
+
 #include <gz/math/Angle.hh>
 #include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/FrustumCuller.hh>
 #include <gz/math/Plane.hh>
 #include <gz/math/Pose3.hh>
 #include <gz/math/config.hh>
@@ -153,6 +157,31 @@ namespace ignition
       /// \return True if the box is inside the pyramid frustum.
       public: bool Contains(const AxisAlignedBox &_b) const;
 
+      /// \brief Check which boxes of a batch lie inside the pyramid
+      /// frustum. The boxes are given as a structure of arrays, and the
+      /// result for each box is the same as Contains(const AxisAlignedBox &).
+      /// Most boxes are classified against the six planes several at a
+      /// time, only boxes that straddle two or more planes fall back to the
+      /// exact test.
+      /// \param[in] _minX Minimum X coordinate of each box.
+      /// \param[in] _minY Minimum Y coordinate of each box.
+      /// \param[in] _minZ Minimum Z coordinate of each box.
+      /// \param[in] _maxX Maximum X coordinate of each box.
+      /// \param[in] _maxY Maximum Y coordinate of each box.
+      /// \param[in] _maxZ Maximum Z coordinate of each box.
+      /// \param[in] _count Number of boxes.
+      /// \param[out] _visible Visibility bitmask with room for
+      /// (_count + 63) / 64 words. Bit i % 64 of word i / 64 is set if box i
+      /// is inside the frustum. Unused bits of the last word are cleared.
+      /// \param[in] _threads Maximum number of threads to use. Values of 0
+      /// or 1 run on the calling thread.
+      public: void Contains(const double *_minX, const double *_minY,
+                            const double *_minZ, const double *_maxX,
+                            const double *_maxY, const double *_maxZ,
+                            const std::size_t _count,
+                            std::uint64_t *_visible,
+                            const unsigned int _threads = 1) const;
+
       /// \brief Check if a point lies inside the pyramid frustum.
       /// \param[in] _p Point to check.
       /// \return True if the point is inside the pyramid frustum.
@@ -173,9 +202,17 @@ namespace ignition
       /// \return The new frustum.
       public: Frustum &operator=(const Frustum &_f);
 
-      /// \brief Compute the planes of the frustum. This is called whenever
-      /// a property of the frustum is changed.
-      private: void ComputePlanes();
+      /// \brief Get an immutable snapshot of the planes of the frustum,
+      /// which can be shared with other threads. The snapshot does not
+      /// follow later changes to the frustum.
+      /// \return The snapshot.
+      public: FrustumCuller Culler() const;
+
+      /// \brief Compute the planes of the frustum if a property changed
+      /// since they were last computed. Changing a property only marks the
+      /// planes as out of date, so changing several of them in a row
+      /// computes the planes once.
+      private: void Update() const;
 
       /// \internal
       /// \brief Private data pointer
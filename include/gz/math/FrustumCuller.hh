@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_FRUSTUMCULLER_HH_
+#define GZ_MATH_FRUSTUMCULLER_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    // Forward declarations
+    class Frustum;
+    class FrustumCullerPrivate;
+
+    /// \brief An immutable snapshot of the planes of a Frustum, used to
+    /// cull points and boxes.
+    ///
+    /// The planes are stored in a packed layout, together with the absolute
+    /// values of their normals, so that a box is classified against a plane
+    /// with a single dot product of its half size, which is equivalent to
+    /// testing its p-vertex and n-vertex. The results are the same as the
+    /// Contains() functions of the Frustum the snapshot was taken from.
+    ///
+    /// The snapshot does not follow later changes to the frustum. It can be
+    /// used from several threads at the same time, and copies share the
+    /// same data, so they are cheap.
+    ///
+    /// \code{.cpp}
+    /// gz::math::Frustum frustum(...);
+    /// const gz::math::FrustumCuller culler = frustum.Culler();
+    /// // Use culler from any number of threads.
+    /// \endcode
+    class IGNITION_MATH_VISIBLE FrustumCuller
+    {
+      /// \brief Default constructor. The snapshot of a default constructed
+      /// Frustum, whose planes all pass through the origin.
+      public: FrustumCuller();
+
+      /// \brief Constructor. Takes a snapshot of a frustum, same as
+      /// Frustum::Culler().
+      /// \param[in] _frustum The frustum.
+      public: explicit FrustumCuller(const Frustum &_frustum);
+
+      /// \brief Check if a box lies inside the frustum.
+      /// \param[in] _b Box to check.
+      /// \return True if the box is inside the frustum.
+      /// \sa Frustum::Contains(const AxisAlignedBox &) const
+      public: bool Contains(const AxisAlignedBox &_b) const;
+
+      /// \brief Check if a point lies inside the frustum.
+      /// \param[in] _p Point to check.
+      /// \return True if the point is inside the frustum.
+      public: bool Contains(const Vector3d &_p) const;
+
+      /// \brief Check which boxes of a batch lie inside the frustum.
+      /// \param[in] _minX Minimum X coordinate of each box.
+      /// \param[in] _minY Minimum Y coordinate of each box.
+      /// \param[in] _minZ Minimum Z coordinate of each box.
+      /// \param[in] _maxX Maximum X coordinate of each box.
+      /// \param[in] _maxY Maximum Y coordinate of each box.
+      /// \param[in] _maxZ Maximum Z coordinate of each box.
+      /// \param[in] _count Number of boxes.
+      /// \param[out] _visible Visibility bitmask with room for
+      /// (_count + 63) / 64 words. Bit i % 64 of word i / 64 is set if box i
+      /// is inside the frustum. Unused bits of the last word are cleared.
+      /// \param[in] _threads Maximum number of threads to use. Values of 0
+      /// or 1 run on the calling thread.
+      /// \sa Frustum::Contains(const double *, const double *,
+      /// const double *, const double *, const double *, const double *,
+      /// const std::size_t, std::uint64_t *, const unsigned int) const
+      public: void Contains(const double *_minX, const double *_minY,
+                            const double *_minZ, const double *_maxX,
+                            const double *_maxY, const double *_maxZ,
+                            const std::size_t _count,
+                            std::uint64_t *_visible,
+                            const unsigned int _threads = 1) const;
+
+      /// \brief Constructor used by Frustum.
+      /// \param[in] _data The snapshot data.
+      private: explicit FrustumCuller(
+                   std::shared_ptr<const FrustumCullerPrivate> _data);
+
+      /// \brief Frustum creates the snapshots.
+      friend class Frustum;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::shared_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \internal
+      /// \brief Private data pointer, shared by all the copies.
+      private: std::shared_ptr<const FrustumCullerPrivate> dataPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+    }
+  }
+}
+#endif
@@ -39,6 +39,39 @@ namespace ignition
     /// Description based on http://en.wikipedia.org/wiki/K-means_clustering.
     class IGNITION_MATH_VISIBLE Kmeans
     {
+      /// \brief Methods used to choose the initial centroids.
+      /// \sa Seeding
+      public: enum SeedingMethod
+      {
+        /// \brief Use the first k observations. This is fast but converges
+        /// slowly when the observations are sorted.
+        FIRST_OBSERVATIONS = 0,
+
+        /// \brief k-means++. Choose each centroid at random, with a
+        /// probability proportional to the squared distance to the closest
+        /// centroid already chosen. This usually needs fewer iterations.
+        /// The random numbers come from Rand, use Rand::Seed() to get
+        /// repeatable results.
+        KMEANS_PLUS_PLUS = 1
+      };
+
+      /// \brief Methods used to find the closest centroid to each
+      /// observation in Cluster(). All the methods give the same result.
+      /// \sa Assignment
+      public: enum AssignmentMethod
+      {
+        /// \brief Compute the distance to every centroid.
+        BRUTE_FORCE = 0,
+
+        /// \brief Hamerly's algorithm. Keep an upper bound of the distance
+        /// to the closest centroid and a lower bound of the distance to the
+        /// second closest centroid of each observation, and skip the
+        /// observations whose bounds prove that the closest centroid did not
+        /// change. This is much faster with many clusters, and uses memory
+        /// for two numbers per observation.
+        HAMERLY = 1
+      };
+
       /// \brief constructor
       /// \param[in] _obs Set of observations to cluster.
       public: explicit Kmeans(const std::vector<Vector3d> &_obs);
@@ -75,6 +108,64 @@ namespace ignition
                            std::vector<Vector3d> &_centroids,
                            std::vector<unsigned int> &_labels);
 
+      /// \brief Executes the mini-batch k-means algorithm. Each iteration
+      /// moves the centroids towards a small random sample of the
+      /// observations instead of using all of them, which is much faster on
+      /// large sets of observations at the cost of slightly worse clusters.
+      ///
+      /// If the previous call to Cluster() or MiniBatchCluster() used the
+      /// same number of clusters, its centroids are used as starting point.
+      /// This allows clustering a stream of observations: append the new
+      /// observations with AppendObservations() and run a few more
+      /// iterations.
+      /// \param[in] _k Number of partitions to cluster.
+      /// \param[in] _batchSize Number of observations sampled per iteration.
+      /// \param[in] _iterations Number of iterations.
+      /// \param[out] _centroids Vector of centroids. Each element contains the
+      /// centroid of one cluster.
+      /// \param[out] _labels Vector of labels, with the closest centroid to
+      /// each observation.
+      /// \return True when the operation succeed or false otherwise. The
+      /// operation fails for the same reasons as Cluster(), or if _batchSize
+      /// is zero.
+      /// \sa Cluster
+      public: bool MiniBatchCluster(int _k,
+                                    unsigned int _batchSize,
+                                    unsigned int _iterations,
+                                    std::vector<Vector3d> &_centroids,
+                                    std::vector<unsigned int> &_labels);
+
+      /// \brief Get the method used to choose the initial centroids.
+      /// \return The seeding method. The default is FIRST_OBSERVATIONS.
+      public: SeedingMethod Seeding() const;
+
+      /// \brief Set the method used to choose the initial centroids.
+      /// \param[in] _method The seeding method.
+      public: void Seeding(SeedingMethod _method);
+
+      /// \brief Get the method used to find the closest centroid to each
+      /// observation in Cluster().
+      /// \return The assignment method. The default is BRUTE_FORCE.
+      public: AssignmentMethod Assignment() const;
+
+      /// \brief Set the method used to find the closest centroid to each
+      /// observation in Cluster().
+      /// \param[in] _method The assignment method.
+      public: void Assignment(AssignmentMethod _method);
+
+      /// \brief Get the maximum number of threads used to assign the
+      /// observations to the centroids.
+      /// \return The number of threads. The default is 1.
+      public: unsigned int Threads() const;
+
+      /// \brief Set the maximum number of threads used to assign the
+      /// observations to the centroids. Each thread accumulates its own
+      /// partial sums, so the centroids may differ in the last bits for
+      /// different numbers of threads.
+      /// \param[in] _threads The number of threads. Values of 0 or 1 run on
+      /// the calling thread.
+      public: void Threads(unsigned int _threads);
+
       /// \brief Given an observation, it returns the closest centroid to it.
       /// \param[in] _p Point to check.
       /// \return The index of the closest centroid to the point _p.
@@ -18,12 +18,14 @@
 #define GZ_MATH_MATRIX4_HH_
 
 #include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <gz/math/Helpers.hh>
 #include <gz/math/Matrix3.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/Pose3.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/AffineTransform.hh>
 
 namespace ignition
 {
@@ -445,6 +447,47 @@ namespace ignition
         return true;
       }
 
+      /// \brief Perform an affine transformation on a contiguous array of
+      /// points. The loop over the points is simple enough for the compiler
+      /// to vectorize, and can optionally be split across threads.
+      /// \param[in] _in Pointer to the first input point.
+      /// \param[out] _out Pointer to the first output point. It may be equal
+      /// to _in to transform the points in place. The output is not changed
+      /// if this matrix is not affine.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \return True if this matrix is affine, false otherwise.
+      public: bool TransformAffine(const Vector3<T> *_in, Vector3<T> *_out,
+                  std::size_t _count, unsigned int _threads = 1) const
+      {
+        if (!this->IsAffine())
+          return false;
+
+        detail::AffineTransform(this->Affine(), _in, _out, _count, _threads);
+        return true;
+      }
+
+      /// \brief Perform an affine transformation, in place, on points stored
+      /// as separate x, y and z arrays (structure of arrays).
+      /// \param[in,out] _x Array of _count x coordinates.
+      /// \param[in,out] _y Array of _count y coordinates.
+      /// \param[in,out] _z Array of _count z coordinates.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \return True if this matrix is affine, false otherwise. The
+      /// points are not changed if this matrix is not affine.
+      public: bool TransformAffine(T *_x, T *_y, T *_z, std::size_t _count,
+                  unsigned int _threads = 1) const
+      {
+        if (!this->IsAffine())
+          return false;
+
+        detail::AffineTransform(this->Affine(), _x, _y, _z, _count, _threads);
+        return true;
+      }
+
       /// \brief Return the determinant of the matrix
       /// \return Determinant of this matrix.
       public: T Determinant() const
@@ -903,6 +946,20 @@ namespace ignition
                   0,      0,         0,        1);
       }
 
+      /// \brief Get the top three rows of this matrix as an affine
+      /// transform.
+      /// \return The affine transform.
+      private: detail::Affine3x4<T> Affine() const
+      {
+        detail::Affine3x4<T> result;
+        for (unsigned int r = 0; r < 3; ++r)
+        {
+          for (unsigned int c = 0; c < 4; ++c)
+            result.m[r][c] = this->data[r][c];
+        }
+        return result;
+      }
+
       /// \brief The 4x4 matrix
       private: T data[4][4];
     };
@@ -0,0 +1,397 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_MULTICHANNELMOVINGWINDOWFILTER_HH_
+#define GZ_MATH_MULTICHANNELMOVINGWINDOWFILTER_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <gz/math/config.hh>
+#include <gz/math/detail/Simd.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \class MultiChannelMovingWindowFilter
+    /// MultiChannelMovingWindowFilter.hh
+    /// ignition/math/MultiChannelMovingWindowFilter.hh
+    /// \brief Filter several scalar signals that are sampled together, such
+    /// as the positions of the joints of a robot, with one Update() call per
+    /// time step.
+    ///
+    /// This is equivalent to one MovingWindowFilter per channel, but the
+    /// window of every channel is stored in a single ring buffer with one
+    /// row of all channels per time step, so an update reads and writes
+    /// contiguous memory. For doubles, when the library is built with
+    /// IGNITION_MATH_ENABLE_SIMD and SIMD instructions are available, the
+    /// mean kernel updates pairs of channels together.
+    ///
+    /// The values are 0 until the first update. Until the window is filled,
+    /// the mean and median kernels use the samples received so far.
+    ///
+    /// \code{.cpp}
+    /// gz::math::MultiChannelMovingWindowFilter<double> filter(
+    ///     jointCount, 10,
+    ///     gz::math::MultiChannelMovingWindowFilter<double>::MEDIAN);
+    /// filter.Update(positions.data());
+    /// const double *smoothed = filter.Values().data();
+    /// \endcode
+    /// \tparam T A floating point type.
+    template<typename T>
+    class MultiChannelMovingWindowFilter
+    {
+      static_assert(std::is_floating_point<T>::value,
+          "MultiChannelMovingWindowFilter requires a floating point type");
+
+      /// \brief How the samples of the window are combined.
+      public: enum Kernel
+      {
+        /// \brief The mean of the samples in the window, like
+        /// MovingWindowFilter. It is kept as a running sum, which is
+        /// recomputed from the window periodically to bound the rounding
+        /// error.
+        MEAN = 0,
+
+        /// \brief The median of the samples in the window. For an even
+        /// number of samples, the mean of the two middle samples. The
+        /// samples of each channel are kept sorted, so an update costs
+        /// about one pass over the window of each channel. NaN samples are
+        /// ordered after all other values.
+        MEDIAN = 1,
+
+        /// \brief An exponential moving average,
+        /// y = y + alpha * (x - y), with alpha = 2 / (window size + 1) so
+        /// that the average has the same center of mass as a window of
+        /// that size. No samples are stored.
+        EXPONENTIAL = 2
+      };
+
+      /// \brief Constructor.
+      /// \param[in] _channels Number of channels.
+      /// \param[in] _windowSize Number of samples in the window of each
+      /// channel. A size of 0 is treated as 1.
+      /// \param[in] _kernel How the samples of the window are combined.
+      public: explicit MultiChannelMovingWindowFilter(
+                  const std::size_t _channels,
+                  const unsigned int _windowSize = 4,
+                  const Kernel _kernel = MEAN)
+        : channels(_channels), kernel(_kernel)
+      {
+        this->SetWindowSize(_windowSize);
+      }
+
+      /// \brief Add one sample to every channel.
+      /// \param[in] _values Pointer to Channels() values, one per channel.
+      public: void Update(const T *_values)
+      {
+        switch (this->kernel)
+        {
+          case MEDIAN:
+            this->UpdateMedian(_values);
+            break;
+          case EXPONENTIAL:
+            this->UpdateExponential(_values);
+            break;
+          case MEAN:
+          default:
+            this->UpdateMean(_values);
+            break;
+        }
+      }
+
+      /// \brief Add one sample to every channel.
+      /// \param[in] _values One value per channel. Ignored if it has fewer
+      /// than Channels() values.
+      public: void Update(const std::vector<T> &_values)
+      {
+        if (_values.size() >= this->channels)
+          this->Update(_values.data());
+      }
+
+      /// \brief Set the window size, and forget all previous samples.
+      /// \param[in] _n New window size. A size of 0 is treated as 1.
+      public: void SetWindowSize(const unsigned int _n)
+      {
+        this->windowSize = std::max(1u, _n);
+        this->alpha = T(2) / (T(this->windowSize) + T(1));
+        this->Reset();
+      }
+
+      /// \brief Forget all previous samples.
+      public: void Reset()
+      {
+        // The mean kernel subtracts the rows that have not been written
+        // yet, so they must be zero.
+        const std::size_t size = this->windowSize * this->channels;
+        this->history.assign(this->kernel != EXPONENTIAL ? size : 0, T(0));
+        this->sorted.assign(this->kernel == MEDIAN ? size : 0, T(0));
+        this->sums.assign(this->kernel == MEAN ? this->channels : 0, T(0));
+        this->values.assign(this->channels, T(0));
+        this->next = 0;
+        this->samples = 0;
+        this->updatesSinceRefresh = 0;
+      }
+
+      /// \brief Get the number of channels.
+      /// \return The number of channels.
+      public: std::size_t Channels() const
+      {
+        return this->channels;
+      }
+
+      /// \brief Get the window size.
+      /// \return The size of the moving window.
+      public: unsigned int WindowSize() const
+      {
+        return this->windowSize;
+      }
+
+      /// \brief Get the kernel.
+      /// \return How the samples of the window are combined.
+      public: Kernel WindowKernel() const
+      {
+        return this->kernel;
+      }
+
+      /// \brief Get whether the window has been filled.
+      /// \return True if the window has been filled.
+      public: bool WindowFilled() const
+      {
+        return this->samples == this->windowSize;
+      }
+
+      /// \brief Get the filtered value of one channel.
+      /// \param[in] _channel Index of the channel, less than Channels().
+      /// \return Latest filtered value of the channel.
+      public: T Value(const std::size_t _channel) const
+      {
+        return this->values[_channel];
+      }
+
+      /// \brief Get the filtered values of all the channels.
+      /// \return Latest filtered value of each channel.
+      public: const std::vector<T> &Values() const
+      {
+        return this->values;
+      }
+
+      /// \brief Update the running sums, the window and the means.
+      /// \param[in] _values One value per channel.
+      private: void UpdateMean(const T *_values)
+      {
+        if (!this->WindowFilled())
+          ++this->samples;
+
+        // Before the window is filled, the rows that have not been written
+        // yet are zero, so the oldest value can be subtracted either way.
+        T *row = this->history.data() + this->next * this->channels;
+        T *sum = this->sums.data();
+        T *out = this->values.data();
+        const T inv = T(1) / T(this->samples);
+
+        std::size_t c = 0;
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+        if constexpr (std::is_same_v<T, double>)
+        {
+          using namespace detail::simd;
+          const Double2 invCount = Splat(inv);
+          for (; c + 2 <= this->channels; c += 2)
+          {
+            const Double2 x = Load(_values + c);
+            const Double2 s = Sub(Add(Load(sum + c), x), Load(row + c));
+            Store(sum + c, s);
+            Store(row + c, x);
+            Store(out + c, Mul(s, invCount));
+          }
+        }
+#endif
+        for (; c < this->channels; ++c)
+        {
+          const T s = sum[c] + _values[c] - row[c];
+          sum[c] = s;
+          row[c] = _values[c];
+          out[c] = s * inv;
+        }
+
+        this->Advance();
+
+        // Recompute the sums from the window to discard the rounding error
+        // accumulated by the additions and subtractions.
+        if (++this->updatesSinceRefresh >=
+            std::size_t(kRefreshWindows) * this->windowSize)
+        {
+          this->updatesSinceRefresh = 0;
+          std::fill(this->sums.begin(), this->sums.end(), T(0));
+          for (unsigned int r = 0; r < this->samples; ++r)
+          {
+            const T *h = this->history.data() + r * this->channels;
+            for (std::size_t k = 0; k < this->channels; ++k)
+              sum[k] += h[k];
+          }
+          for (std::size_t k = 0; k < this->channels; ++k)
+            out[k] = sum[k] * inv;
+        }
+      }
+
+      /// \brief Update the sorted windows and the medians.
+      /// \param[in] _values One value per channel.
+      private: void UpdateMedian(const T *_values)
+      {
+        const bool filled = this->WindowFilled();
+        const unsigned int n = filled ? this->samples : this->samples + 1;
+        T *row = this->history.data() + this->next * this->channels;
+
+        for (std::size_t c = 0; c < this->channels; ++c)
+        {
+          T *s = this->sorted.data() + c * this->windowSize;
+          const T x = _values[c];
+
+          // Count the samples ordered before the oldest sample, which is
+          // its index, and before the new sample once the oldest is removed,
+          // which is the index of the new sample. Counting does not branch
+          // on the data, unlike a search, so it is faster for short windows
+          // of noisy signals. Before the window is filled, the new sample
+          // takes a new slot at the end instead.
+          const T old = filled ? row[c] : T(0);
+          const std::size_t valid = filled ? n : n - 1;
+          std::size_t oldIndex = 0;
+          std::size_t newIndex = 0;
+          if (!std::isnan(x) && !std::isnan(old))
+          {
+            // NaN samples are greater than both, which < already gives.
+            for (std::size_t i = 0; i < valid; ++i)
+            {
+              oldIndex += s[i] < old;
+              newIndex += s[i] < x;
+            }
+          }
+          else
+          {
+            for (std::size_t i = 0; i < valid; ++i)
+            {
+              oldIndex += Less(s[i], old);
+              newIndex += Less(s[i], x);
+            }
+          }
+          if (filled)
+            newIndex -= Less(old, x);
+          else
+            oldIndex = n - 1;
+
+          // Shift the samples between the two indices into the slot of the
+          // oldest sample, which frees the slot of the new sample.
+          for (std::size_t i = oldIndex; i < newIndex; ++i)
+            s[i] = s[i + 1];
+          for (std::size_t i = oldIndex; i > newIndex; --i)
+            s[i] = s[i - 1];
+          s[newIndex] = x;
+          row[c] = x;
+
+          this->values[c] = n % 2 == 1 ? s[n / 2] :
+            (s[n / 2 - 1] + s[n / 2]) / T(2);
+        }
+
+        this->samples = n;
+        this->Advance();
+      }
+
+      /// \brief Update the exponential moving averages.
+      /// \param[in] _values One value per channel.
+      private: void UpdateExponential(const T *_values)
+      {
+        T *out = this->values.data();
+        if (this->samples == 0)
+        {
+          for (std::size_t c = 0; c < this->channels; ++c)
+            out[c] = _values[c];
+          this->samples = 1;
+          return;
+        }
+
+        for (std::size_t c = 0; c < this->channels; ++c)
+          out[c] += this->alpha * (_values[c] - out[c]);
+        if (this->samples < this->windowSize)
+          ++this->samples;
+      }
+
+      /// \brief Move to the next row of the ring buffer.
+      private: void Advance()
+      {
+        if (++this->next == this->windowSize)
+          this->next = 0;
+      }
+
+      /// \brief Strict weak ordering of the samples of the median kernel,
+      /// which puts NaN after all other values.
+      /// \param[in] _a First value.
+      /// \param[in] _b Second value.
+      /// \return True if _a is ordered before _b.
+      private: static bool Less(const T _a, const T _b)
+      {
+        return _a < _b || (!std::isnan(_a) && std::isnan(_b));
+      }
+
+      /// \brief Number of windows of updates after which the running sums
+      /// of the mean kernel are recomputed.
+      private: static constexpr unsigned int kRefreshWindows = 16;
+
+      /// \brief Number of channels.
+      private: std::size_t channels;
+
+      /// \brief How the samples of the window are combined.
+      private: Kernel kernel;
+
+      /// \brief Number of samples in the window.
+      private: unsigned int windowSize = 4;
+
+      /// \brief Smoothing factor of the exponential kernel.
+      private: T alpha = T(0.4);
+
+      /// \brief Ring buffer of the samples, one row of all the channels
+      /// per sample. Unused by the exponential kernel.
+      private: std::vector<T> history;
+
+      /// \brief Sorted samples of each channel, one window per channel.
+      /// Only used by the median kernel.
+      private: std::vector<T> sorted;
+
+      /// \brief Running sum of each channel. Only used by the mean kernel.
+      private: std::vector<T> sums;
+
+      /// \brief Latest filtered value of each channel.
+      private: std::vector<T> values;
+
+      /// \brief Row of the ring buffer that the next sample is written to.
+      private: unsigned int next = 0;
+
+      /// \brief Number of samples in the window.
+      private: unsigned int samples = 0;
+
+      /// \brief Number of updates since the running sums were recomputed.
+      private: std::size_t updatesSinceRefresh = 0;
+    };
+    }
+  }
+}
+#endif
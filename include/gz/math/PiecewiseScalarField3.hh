@@ -18,6 +18,8 @@
 #define GZ_MATH_PIECEWISE_SCALAR_FIELD3_HH_
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -26,6 +28,7 @@
 #include <gz/math/Region3.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
 
 namespace ignition
 {
@@ -53,6 +56,11 @@ namespace ignition
     /// \tparam ScalarT a numeric type for which std::numeric_limits<> traits
     ///   have been specialized.
     ///
+    /// When there are more than a few pieces, a uniform grid over the
+    /// finite bounds of their regions is built at construction time. Each
+    /// grid cell lists the pieces whose region overlaps it, so evaluating
+    /// the field only checks the pieces of one cell instead of all of them.
+    ///
     /// ## Example
     ///
     /// \snippet examples/piecewise_scalar_field3_example.cc complete
@@ -97,6 +105,7 @@ namespace ignition
             }
           }
         }
+        this->BuildIndex();
       }
 
       /// \brief Define piecewise scalar field as `_field` throughout R^3 space
@@ -114,6 +123,15 @@ namespace ignition
       ///   if the scalar field is not defined at `_p`
       public: ScalarT Evaluate(const Vector3<ScalarT> &_p) const
       {
+        if (!this->cellOffsets.empty())
+        {
+          const Piece *piece = this->FindInGrid(_p);
+          if (piece == nullptr)
+          {
+            return std::numeric_limits<ScalarT>::quiet_NaN();
+          }
+          return piece->field(_p);
+        }
         auto it = std::find_if(
             this->pieces.begin(), this->pieces.end(),
             [&](const Piece &piece)
@@ -127,6 +145,44 @@ namespace ignition
         return it->field(_p);
       }
 
+      /// \brief Evaluate the piecewise scalar field at each point of a
+      /// contiguous array: _values[i] = F(_points[i]).
+      /// \param[in] _points Pointer to the first point.
+      /// \param[out] _values Pointer to the first result, NaN where the
+      /// scalar field is not defined.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void Evaluate(const Vector3<ScalarT> *_points,
+                            ScalarT *_values, std::size_t _count,
+                            unsigned int _threads = 1) const
+      {
+        detail::ParallelFor(_count, _threads,
+            [this, _points, _values](const std::size_t _begin,
+                                     const std::size_t _end)
+            {
+              for (std::size_t i = _begin; i < _end; ++i)
+                _values[i] = this->Evaluate(_points[i]);
+            }, 1024);
+      }
+
+      /// \brief Evaluate the piecewise scalar field at each point of a
+      /// vector.
+      /// \param[in] _points Piecewise scalar field arguments.
+      /// \param[out] _values Results, resized to the number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa Evaluate(const Vector3<ScalarT> *, ScalarT *, std::size_t,
+      /// unsigned int) const
+      public: void Evaluate(const std::vector<Vector3<ScalarT>> &_points,
+                            std::vector<ScalarT> &_values,
+                            unsigned int _threads = 1) const
+      {
+        _values.resize(_points.size());
+        this->Evaluate(_points.data(), _values.data(), _points.size(),
+            _threads);
+      }
+
       /// \brief Call operator overload
       /// \see PiecewiseScalarField3::Evaluate()
       /// \param[in] _p piecewise scalar field argument
@@ -204,8 +260,191 @@ namespace ignition
                     << _field.pieces.back().region;
       }
 
+      /// \brief Find the piece whose region contains a point, using the
+      /// grid built by BuildIndex.
+      /// \param[in] _p The point.
+      /// \return The first such piece, or nullptr if there is none.
+      private: const Piece *FindInGrid(const Vector3<ScalarT> &_p) const
+      {
+        // Pieces are listed in ascending order, so the first piece
+        // that contains the point takes precedence, as without the index.
+        const std::size_t cell =
+            (this->CellIndex(_p.Z(), 2) * this->cellCount[1] +
+             this->CellIndex(_p.Y(), 1)) * this->cellCount[0] +
+            this->CellIndex(_p.X(), 0);
+        for (std::size_t k = this->cellOffsets[cell];
+             k < this->cellOffsets[cell + 1]; ++k)
+        {
+          const Piece &piece = this->pieces[this->cellPieces[k]];
+          if (piece.region.Contains(_p))
+            return &piece;
+        }
+        return nullptr;
+      }
+
+      /// \brief Get the interval of a region along an axis.
+      /// \param[in] _region The region.
+      /// \param[in] _axis 0, 1 or 2 for x, y or z.
+      /// \return The interval.
+      private: static const Interval<ScalarT> &Axis(
+          const Region3<ScalarT> &_region, const int _axis)
+      {
+        return _axis == 0 ? _region.Ix() :
+               (_axis == 1 ? _region.Iy() : _region.Iz());
+      }
+
+      /// \brief Get the grid cell of a coordinate along an axis. Values
+      /// outside the grid, including infinities, are clamped to its border
+      /// cells, and NaN is mapped to the first cell.
+      /// \param[in] _value The coordinate.
+      /// \param[in] _axis 0, 1 or 2 for x, y or z.
+      /// \return The cell index along the axis.
+      private: std::size_t CellIndex(const ScalarT _value,
+                                     const int _axis) const
+      {
+        const ScalarT c =
+            (_value - this->gridMin[_axis]) * this->gridInvCellSize[_axis];
+        if (!(c >= ScalarT(1)))
+          return 0;
+        if (c >= static_cast<ScalarT>(this->cellCount[_axis]))
+          return this->cellCount[_axis] - 1;
+        return static_cast<std::size_t>(c);
+      }
+
+      /// \brief Build the grid used by Evaluate to find the pieces that may
+      /// contain a point. The grid spans the finite bounds of the regions,
+      /// with about as many cells along each axis as there are distinct
+      /// region bounds, and at most kCellsPerPiece cells per piece in total.
+      private: void BuildIndex()
+      {
+        this->cellOffsets.clear();
+        this->cellPieces.clear();
+        if (this->pieces.size() <= kMaxLinearPieces)
+          return;
+
+        std::size_t totalCells = 1;
+        ScalarT gridSize[3];
+        for (int a = 0; a < 3; ++a)
+        {
+          std::vector<ScalarT> bounds;
+          for (const Piece &piece : this->pieces)
+          {
+            if (piece.region.Empty())
+              continue;
+            const Interval<ScalarT> &interval = Axis(piece.region, a);
+            for (const ScalarT v : {interval.LeftValue(),
+                                    interval.RightValue()})
+            {
+              using std::isfinite;
+              if (isfinite(v))
+                bounds.push_back(v);
+            }
+          }
+          std::sort(bounds.begin(), bounds.end());
+          bounds.erase(std::unique(bounds.begin(), bounds.end()),
+                       bounds.end());
+
+          this->cellCount[a] = 1;
+          this->gridMin[a] = ScalarT(0);
+          gridSize[a] = ScalarT(0);
+          if (bounds.size() > 1)
+          {
+            this->cellCount[a] = bounds.size() - 1;
+            this->gridMin[a] = bounds.front();
+            gridSize[a] = bounds.back() - bounds.front();
+          }
+          totalCells *= this->cellCount[a];
+        }
+
+        // Halve the finest axis until the grid is within budget.
+        const std::size_t maxCells = std::max<std::size_t>(
+            kCellsPerPiece * this->pieces.size(), 64);
+        while (totalCells > maxCells)
+        {
+          const int a = static_cast<int>(std::max_element(
+              this->cellCount, this->cellCount + 3) - this->cellCount);
+          totalCells /= this->cellCount[a];
+          this->cellCount[a] = (this->cellCount[a] + 1) / 2;
+          totalCells *= this->cellCount[a];
+        }
+
+        for (int a = 0; a < 3; ++a)
+        {
+          this->gridInvCellSize[a] = this->cellCount[a] > 1 ?
+              static_cast<ScalarT>(this->cellCount[a]) / gridSize[a] :
+              ScalarT(0);
+        }
+
+        // Count the pieces of each cell, then list them, in ascending order.
+        std::size_t first[3], last[3];
+        auto cellRange = [&](const Region3<ScalarT> &_region)
+        {
+          for (int a = 0; a < 3; ++a)
+          {
+            const Interval<ScalarT> &interval = Axis(_region, a);
+            first[a] = this->CellIndex(interval.LeftValue(), a);
+            last[a] = this->CellIndex(interval.RightValue(), a);
+          }
+        };
+        auto forEachCell = [&](auto &&_func)
+        {
+          for (std::size_t z = first[2]; z <= last[2]; ++z)
+            for (std::size_t y = first[1]; y <= last[1]; ++y)
+              for (std::size_t x = first[0]; x <= last[0]; ++x)
+                _func((z * this->cellCount[1] + y) * this->cellCount[0] + x);
+        };
+
+        this->cellOffsets.assign(totalCells + 1, 0);
+        for (const Piece &piece : this->pieces)
+        {
+          if (piece.region.Empty())
+            continue;
+          cellRange(piece.region);
+          forEachCell([&](std::size_t _cell)
+              { ++this->cellOffsets[_cell + 1]; });
+        }
+        for (std::size_t c = 0; c < totalCells; ++c)
+          this->cellOffsets[c + 1] += this->cellOffsets[c];
+
+        this->cellPieces.resize(this->cellOffsets.back());
+        std::vector<std::size_t> next(this->cellOffsets.begin(),
+                                      this->cellOffsets.end() - 1);
+        for (std::size_t i = 0; i < this->pieces.size(); ++i)
+        {
+          if (this->pieces[i].region.Empty())
+            continue;
+          cellRange(this->pieces[i].region);
+          forEachCell([&](std::size_t _cell)
+              { this->cellPieces[next[_cell]++] = i; });
+        }
+      }
+
+      /// \brief Largest number of pieces that are searched linearly,
+      /// without building the grid.
+      private: static constexpr std::size_t kMaxLinearPieces = 8;
+
+      /// \brief Largest number of grid cells per piece.
+      private: static constexpr std::size_t kCellsPerPiece = 8;
+
       /// \brief Scalar fields Pn and the regions Rn in which these are defined
       private: std::vector<Piece> pieces;
+
+      /// \brief Number of grid cells along each axis.
+      private: std::size_t cellCount[3] = {1, 1, 1};
+
+      /// \brief Coordinates of the grid corner.
+      private: ScalarT gridMin[3] = {};
+
+      /// \brief Number of grid cells per unit length along each axis.
+      private: ScalarT gridInvCellSize[3] = {};
+
+      /// \brief Offset of the first piece of each grid cell in cellPieces,
+      /// followed by the total number of listed pieces. Empty when the
+      /// pieces are searched linearly.
+      private: std::vector<std::size_t> cellOffsets;
+
+      /// \brief Indices of the pieces whose region overlaps each grid cell.
+      private: std::vector<std::size_t> cellPieces;
     };
 
     template<typename ScalarField3T>
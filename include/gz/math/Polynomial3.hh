@@ -19,13 +19,18 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gz/math/Interval.hh>
 #include <gz/math/Vector4.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
+#include <gz/math/detail/Simd.hh>
 
 namespace ignition
 {
@@ -95,11 +100,72 @@ namespace ignition
           }
           return this->coeffs[3];
         }
-        const T _x2 = _x * _x;
-        const T _x3 = _x2 * _x;
+        // Horner form
+        return ((this->coeffs[0] * _x + this->coeffs[1]) * _x +
+                this->coeffs[2]) * _x + this->coeffs[3];
+      }
 
-        return (this->coeffs[0] * _x3 + this->coeffs[1] * _x2 +
-                this->coeffs[2] * _x + this->coeffs[3]);
+      /// \brief Evaluate the polynomial at each value of a contiguous array:
+      /// _y[i] = p(_x[i]). This produces the same results as calling
+      /// Evaluate(const T &) on every value. For doubles, when the library
+      /// is built with IGNITION_MATH_ENABLE_SIMD and SIMD instructions are
+      /// available, pairs of values are evaluated together, and only pairs
+      /// with a non-finite result go through the scalar handling of
+      /// non-finite arguments.
+      /// \param[in] _x Pointer to the first polynomial argument.
+      /// \param[out] _y Pointer to the first result. It may be equal to _x
+      /// to evaluate the polynomial in place.
+      /// \param[in] _count Number of values.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void Evaluate(const T *_x, T *_y, std::size_t _count,
+                            unsigned int _threads = 1) const
+      {
+        detail::ParallelFor(_count, _threads,
+            [this, _x, _y](const std::size_t _begin, const std::size_t _end)
+            {
+              std::size_t i = _begin;
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+              if constexpr (std::is_same_v<T, double>)
+              {
+                using namespace detail::simd;
+                const Double2 c0 = Splat(this->coeffs[0]);
+                const Double2 c1 = Splat(this->coeffs[1]);
+                const Double2 c2 = Splat(this->coeffs[2]);
+                const Double2 c3 = Splat(this->coeffs[3]);
+                for (; i + 2 <= _end; i += 2)
+                {
+                  // Same operations, in the same order, as the scalar
+                  // Evaluate(const T &)
+                  const Double2 x = Load(_x + i);
+                  const Double2 y =
+                      Add(Mul(Add(Mul(Add(Mul(c0, x), c1), x), c2), x), c3);
+                  Store(_y + i, y);
+                  if (FiniteMask(y) != 3)
+                  {
+                    double xs[2];
+                    Store(xs, x);
+                    _y[i] = this->Evaluate(xs[0]);
+                    _y[i + 1] = this->Evaluate(xs[1]);
+                  }
+                }
+              }
+#endif
+              for (; i < _end; ++i)
+                _y[i] = this->Evaluate(_x[i]);
+            });
+      }
+
+      /// \brief Evaluate the polynomial at each value of a vector, in place.
+      /// \param[in,out] _values Polynomial arguments, replaced by the results.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa Evaluate(const T *, T *, std::size_t, unsigned int) const
+      public: void Evaluate(std::vector<T> &_values,
+                            unsigned int _threads = 1) const
+      {
+        this->Evaluate(_values.data(), _values.data(), _values.size(),
+            _threads);
       }
 
       /// \brief Call operator overload
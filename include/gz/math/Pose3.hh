@@ -17,9 +17,12 @@
 #ifndef GZ_MATH_POSE_HH_
 #define GZ_MATH_POSE_HH_
 
+#include <cstddef>
+#include <vector>
 #include <gz/math/Quaternion.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
+#include <gz/math/detail/AffineTransform.hh>
 
 namespace ignition
 {
@@ -273,6 +276,51 @@ namespace ignition
                           _pose.p.Z() + tmp.Z());
       }
 
+      /// \brief Add this pose to each point of a contiguous array:
+      /// _out[i] = this + _in[i]. This produces the same result as calling
+      /// CoordPositionAdd(const Vector3<T> &) on every point, but the
+      /// rotation is converted to a matrix once and the loop is simple
+      /// enough for the compiler to vectorize.
+      /// \param[in] _in Pointer to the first input point.
+      /// \param[out] _out Pointer to the first output point. It may be equal
+      /// to _in to transform the points in place.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void CoordPositionAdd(const Vector3<T> *_in, Vector3<T> *_out,
+                  std::size_t _count, unsigned int _threads = 1) const
+      {
+        detail::AffineTransform(this->Affine(), _in, _out, _count, _threads);
+      }
+
+      /// \brief Add this pose to each point of a vector, in place.
+      /// \param[in,out] _points Points to transform.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa CoordPositionAdd(const Vector3<T> *, Vector3<T> *, std::size_t,
+      /// unsigned int) const
+      public: void CoordPositionAdd(std::vector<Vector3<T>> &_points,
+                  unsigned int _threads = 1) const
+      {
+        this->CoordPositionAdd(_points.data(), _points.data(), _points.size(),
+            _threads);
+      }
+
+      /// \brief Add this pose, in place, to each point of a point set stored
+      /// as separate x, y and z arrays (structure of arrays). This layout
+      /// gives the best throughput for large point clouds.
+      /// \param[in,out] _x Array of _count x coordinates.
+      /// \param[in,out] _y Array of _count y coordinates.
+      /// \param[in,out] _z Array of _count z coordinates.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void CoordPositionAdd(T *_x, T *_y, T *_z, std::size_t _count,
+                  unsigned int _threads = 1) const
+      {
+        detail::AffineTransform(this->Affine(), _x, _y, _z, _count, _threads);
+      }
+
       /// \brief Subtract one position from another: result = this - pose
       /// \param[in] _pose Pose3<T> to subtract
       /// \return The resulting position
@@ -483,6 +531,24 @@ namespace ignition
         return _in;
       }
 
+      /// \brief Get this pose as a 3x4 affine transform.
+      /// \return Rotation matrix of the normalized rotation in the first
+      /// three columns, and the position in the last column.
+      private: detail::Affine3x4<T> Affine() const
+      {
+        const Matrix3<T> rot(this->q);
+        detail::Affine3x4<T> result;
+        for (unsigned int r = 0; r < 3; ++r)
+        {
+          for (unsigned int c = 0; c < 3; ++c)
+            result.m[r][c] = rot(r, c);
+        }
+        result.m[0][3] = this->p.X();
+        result.m[1][3] = this->p.Y();
+        result.m[2][3] = this->p.Z();
+        return result;
+      }
+
       /// \brief The position
       private: Vector3<T> p;
 
@@ -23,6 +23,10 @@
 #include <gz/math/Matrix3.hh>
 #include <gz/math/config.hh>
 
+#ifdef IGNITION_MATH_ENABLE_SIMD
+#include <gz/math/detail/Simd.hh>
+#endif
+
 namespace ignition
 {
   namespace math
@@ -1098,6 +1102,23 @@ namespace ignition
     template<typename T> const Quaternion<T>
       Quaternion<T>::Zero(0, 0, 0, 0);
 
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+    /// \brief SIMD specialization of the quaternion product for doubles,
+    /// enabled by the IGNITION_MATH_ENABLE_SIMD build option.
+    /// \param[in] _q Quaternion to multiply by.
+    /// \return The product.
+    template<>
+    inline Quaternion<double> Quaternion<double>::operator*(
+        const Quaternion<double> &_q) const
+    {
+      const double a[4] = {this->qw, this->qx, this->qy, this->qz};
+      const double b[4] = {_q.qw, _q.qx, _q.qy, _q.qz};
+      double out[4];
+      detail::simd::QuaternionMultiply(a, b, out);
+      return Quaternion<double>(out[0], out[1], out[2], out[3]);
+    }
+#endif
+
     typedef Quaternion<double> Quaterniond;
     typedef Quaternion<float> Quaternionf;
     typedef Quaternion<int> Quaternioni;
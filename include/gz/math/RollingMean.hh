@@ -35,6 +35,12 @@ namespace ignition
     /// The window size determines the maximum number of data points. The
     /// oldest value is popped off when the window size is reached and
     /// a new value is pushed in.
+    ///
+    /// The values are kept in a ring buffer allocated for the window size,
+    /// along with a compensated running sum and monotonic queues for the
+    /// minimum and maximum, so that pushing a value and querying the
+    /// statistics take constant (amortized) time regardless of the window
+    /// size.
     class IGNITION_MATH_VISIBLE RollingMean
     {
       /// \brief Constructor
@@ -51,6 +57,25 @@ namespace ignition
       /// present.
       public: double Mean() const;
 
+      /// \brief Get the sample variance of the data points, with a
+      /// denominator of Count() - 1, like SignalVariance.
+      /// \return The current variance, 0 if there is a single data point,
+      /// or std::numeric_limits<double>::quiet_NaN() if data points are not
+      /// present or some are not finite.
+      public: double Variance() const;
+
+      /// \brief Get the minimum value.
+      /// \return The current minimum value, or
+      /// std::numeric_limits<double>::quiet_NaN() if data points are not
+      /// present or some are NaN.
+      public: double Min() const;
+
+      /// \brief Get the maximum value.
+      /// \return The current maximum value, or
+      /// std::numeric_limits<double>::quiet_NaN() if data points are not
+      /// present or some are NaN.
+      public: double Max() const;
+
       /// \brief Get the number of data points.
       /// \return The number of datapoints.
       public: size_t Count() const;
@@ -62,7 +87,8 @@ namespace ignition
       /// \brief Remove all the pushed values.
       public: void Clear();
 
-      /// \brief Set the new window size. This will also clear the data.
+      /// \brief Set the new window size. This will also clear the data,
+      /// and allocate room for _windowSize values.
       /// Nothing happens if the _windowSize is zero.
       /// \param[in] _windowSize The window size to use.
       public: void SetWindowSize(size_t _windowSize);
@@ -17,9 +17,12 @@
 #ifndef GZ_MATH_SIGNALSTATS_HH_
 #define GZ_MATH_SIGNALSTATS_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
 
@@ -66,6 +69,10 @@ namespace ignition
       /// \brief Forget all previous data.
       public: virtual void Reset();
 
+      /// \brief SignalStats inserts batches of samples and merges
+      /// statistics through its private data.
+      friend class SignalStatsPrivate;
+
 #ifdef _WIN32
 // Disable warning C4251 which is triggered by
 // std::unique_ptr
@@ -174,6 +181,168 @@ namespace ignition
       public: virtual void InsertData(const double _data) override;
     };
 
+    /// \brief Forward declare private data class.
+    class SignalQuantilePrivate;
+
+    /// \class SignalQuantile SignalStats.hh ignition/math/SignalStats.hh
+    /// \brief Estimating a quantile of a discretely sampled signal, such as
+    /// its median or 99th percentile, without storing the samples.
+    ///
+    /// The samples are counted in a DDSketch: buckets whose bounds grow
+    /// geometrically, so that every quantile is estimated within 1% of its
+    /// true value. Inserting a sample takes constant time. At most 2048
+    /// buckets are kept for each sign. When the samples span a wider range
+    /// than that (a ratio of about 1e17 between the largest and smallest
+    /// magnitude), the buckets closest to zero are merged, which only
+    /// affects the accuracy of the quantiles of the smallest magnitudes.
+    /// Non-finite samples are counted but otherwise ignored.
+    ///
+    /// The short name is "p" followed by the quantile as a percentage, for
+    /// example "p50" for the median and "p99.9" for the 99.9th percentile.
+    /// SignalStats::InsertStatistic accepts any such name.
+    class IGNITION_MATH_VISIBLE SignalQuantile : public SignalStatistic
+    {
+      /// \brief Constructor.
+      /// \param[in] _quantile The quantile to estimate, in [0, 1]. Values
+      /// outside of this range are clamped.
+      public: explicit SignalQuantile(const double _quantile = 0.5);
+
+      /// \brief Copy constructor.
+      /// \param[in] _ss SignalQuantile to copy.
+      public: SignalQuantile(const SignalQuantile &_ss);
+
+      /// \brief Destructor.
+      public: virtual ~SignalQuantile();
+
+      /// \brief Get the estimate of the quantile given to the constructor.
+      /// \return The estimate, or 0 if there are no samples.
+      public: virtual double Value() const override;
+
+      /// \brief Get a short version of the name of this statistical measure.
+      /// \return "p" followed by the quantile as a percentage.
+      public: virtual std::string ShortName() const override;
+
+      // Documentation inherited.
+      public: virtual void InsertData(const double _data) override;
+
+      // Documentation inherited.
+      public: virtual void Reset() override;
+
+      /// \brief Get an estimate of any quantile of the samples.
+      /// \param[in] _quantile The quantile, in [0, 1].
+      /// \return The estimate, or 0 if there are no finite samples.
+      public: double Quantile(const double _quantile) const;
+
+      /// \brief SignalStats inserts batches of samples and merges
+      /// statistics through its private data.
+      friend class SignalStatsPrivate;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Pointer to the sketch.
+      private: std::unique_ptr<SignalQuantilePrivate> sketchPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+
+    /// \brief Forward declare private data class.
+    class SignalHistogramPrivate;
+
+    /// \class SignalHistogram SignalStats.hh ignition/math/SignalStats.hh
+    /// \brief Counting the samples of a discretely sampled signal in
+    /// buckets of equal width.
+    ///
+    /// The range [min, max] is split into a fixed number of buckets.
+    /// Samples below or above the range are counted separately, and NaN
+    /// samples are counted but otherwise ignored. Inserting a sample takes
+    /// constant time.
+    ///
+    /// The short name is "hist[min:max:buckets]", for example
+    /// "hist[0:100:50]", which SignalStats::InsertStatistic accepts. The
+    /// bounds are written with as many digits as needed to read them back
+    /// exactly. The value is the median, interpolated within its bucket.
+    class IGNITION_MATH_VISIBLE SignalHistogram : public SignalStatistic
+    {
+      /// \brief Constructor.
+      /// \param[in] _min Lower bound of the first bucket.
+      /// \param[in] _max Upper bound of the last bucket. It must be greater
+      /// than _min, otherwise a range of 1 is used.
+      /// \param[in] _buckets Number of buckets. At least one bucket is
+      /// used.
+      public: SignalHistogram(const double _min, const double _max,
+                              const std::size_t _buckets);
+
+      /// \brief Copy constructor.
+      /// \param[in] _ss SignalHistogram to copy.
+      public: SignalHistogram(const SignalHistogram &_ss);
+
+      /// \brief Destructor.
+      public: virtual ~SignalHistogram();
+
+      /// \brief Get the median, interpolated within its bucket.
+      /// \return The median, or 0 if there are no samples.
+      public: virtual double Value() const override;
+
+      /// \brief Get a short version of the name of this statistical measure.
+      /// \return "hist[min:max:buckets]"
+      public: virtual std::string ShortName() const override;
+
+      // Documentation inherited.
+      public: virtual void InsertData(const double _data) override;
+
+      // Documentation inherited.
+      public: virtual void Reset() override;
+
+      /// \brief Get the lower bound of the first bucket.
+      /// \return The lower bound.
+      public: double Min() const;
+
+      /// \brief Get the upper bound of the last bucket.
+      /// \return The upper bound.
+      public: double Max() const;
+
+      /// \brief Get the number of samples in each bucket. Bucket i covers
+      /// [Min() + i * width, Min() + (i + 1) * width).
+      /// \return The counts, one per bucket.
+      public: const std::vector<std::uint64_t> &Counts() const;
+
+      /// \brief Get the number of samples below Min().
+      /// \return The number of samples.
+      public: std::uint64_t Underflow() const;
+
+      /// \brief Get the number of samples above Max().
+      /// \return The number of samples.
+      public: std::uint64_t Overflow() const;
+
+      /// \brief Get an estimate of a quantile, interpolated within its
+      /// bucket. Quantiles that fall below or above the range are
+      /// reported as Min() or Max().
+      /// \param[in] _quantile The quantile, in [0, 1].
+      /// \return The estimate, or 0 if there are no samples.
+      public: double Quantile(const double _quantile) const;
+
+      /// \brief SignalStats inserts batches of samples and merges
+      /// statistics through its private data.
+      friend class SignalStatsPrivate;
+
+#ifdef _WIN32
+// Disable warning C4251 which is triggered by
+// std::unique_ptr
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+      /// \brief Pointer to the buckets.
+      private: std::unique_ptr<SignalHistogramPrivate> histogramPtr;
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+    };
+
     /// \brief Forward declare private data class.
     class SignalStatsPrivate;
 
@@ -208,12 +377,50 @@ namespace ignition
       /// \param[in] _data New signal data point.
       public: void InsertData(const double _data);
 
+      /// \brief Add a batch of samples to the statistical measures.
+      /// Each statistic processes the samples in blocks, with a single
+      /// loop per block instead of one virtual call per sample.
+      ///
+      /// With more than one thread, the samples are split into contiguous
+      /// chunks that are reduced separately and merged in order, see
+      /// Merge(). The results can then differ from a single thread in the
+      /// last bits.
+      /// \param[in] _data Pointer to the signal data points.
+      /// \param[in] _count Number of data points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa SignalStatsPack for statistics chosen at compile time.
+      public: void InsertData(const double *_data, const std::size_t _count,
+                              const unsigned int _threads = 1);
+
+      /// \brief Add a batch of samples to the statistical measures.
+      /// \param[in] _data The signal data points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void InsertData(const std::vector<double> &_data,
+                              const unsigned int _threads = 1);
+
+      /// \brief Merge the data of another collection of statistics into
+      /// this one, as if its samples had been inserted into this one.
+      /// This allows statistics to be computed over shards of a signal and
+      /// combined afterwards.
+      /// \param[in] _other Statistics to merge. It must have the same
+      /// statistics as this one, in any order.
+      /// \return True if the statistics were merged, false if the
+      /// statistics of _other do not match, in which case nothing changes.
+      public: bool Merge(const SignalStats &_other);
+
       /// \brief Add a new type of statistic.
       /// \param[in] _name Short name of new statistic.
       /// Valid values include:
+      ///  "max"
       ///  "maxAbs"
       ///  "mean"
+      ///  "min"
       ///  "rms"
+      ///  "var"
+      ///  "p" followed by a percentage, such as "p99", see SignalQuantile
+      ///  "hist[min:max:buckets]", see SignalHistogram
       /// \return True if statistic was successfully added,
       /// false if name was not recognized or had already
       /// been inserted.
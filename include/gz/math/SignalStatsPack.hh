@@ -0,0 +1,488 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_SIGNALSTATSPACK_HH_
+#define GZ_MATH_SIGNALSTATSPACK_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+    //
+    /// \brief Statistics that can be composed into a SignalStatsPack.
+    ///
+    /// Each statistic is a small value type with the following members:
+    ///  - void Insert(double _x): add a sample.
+    ///  - void Merge(const Stat &_other, std::size_t _count,
+    ///    std::size_t _otherCount): add the samples of another statistic of
+    ///    the same type, given the number of samples of each.
+    ///  - double Value(std::size_t _count) const: the value of the statistic
+    ///    after _count samples.
+    ///  - static std::string ShortName(): same name as the matching
+    ///    SignalStatistic.
+    /// A default constructed statistic has no samples.
+    namespace stats
+    {
+      /// \brief Maximum value of a signal, see SignalMaximum.
+      /// NaN samples are ignored.
+      class Maximum
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          this->value = _x > this->value ? _x : this->value;
+        }
+
+        /// \brief Add the samples of another maximum.
+        /// \param[in] _other The other maximum.
+        public: void Merge(const Maximum &_other, const std::size_t,
+                           const std::size_t)
+        {
+          this->Insert(_other.value);
+        }
+
+        /// \brief Get the maximum.
+        /// \param[in] _count Number of samples.
+        /// \return The maximum, or 0 if there are no samples.
+        public: double Value(const std::size_t _count) const
+        {
+          return _count == 0 ? 0.0 : this->value;
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "max"
+        public: static std::string ShortName()
+        {
+          return "max";
+        }
+
+        /// \brief Largest sample so far.
+        private: double value = -std::numeric_limits<double>::infinity();
+      };
+
+      /// \brief Maximum absolute value of a signal, see
+      /// SignalMaxAbsoluteValue. NaN samples are ignored.
+      class MaxAbsoluteValue
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          const double absX = std::abs(_x);
+          this->value = absX > this->value ? absX : this->value;
+        }
+
+        /// \brief Add the samples of another maximum absolute value.
+        /// \param[in] _other The other maximum absolute value.
+        public: void Merge(const MaxAbsoluteValue &_other, const std::size_t,
+                           const std::size_t)
+        {
+          this->Insert(_other.value);
+        }
+
+        /// \brief Get the maximum absolute value.
+        /// \param[in] _count Number of samples.
+        /// \return The maximum absolute value, or 0 if there are no
+        /// samples.
+        public: double Value(const std::size_t /*_count*/) const
+        {
+          return this->value;
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "maxAbs"
+        public: static std::string ShortName()
+        {
+          return "maxAbs";
+        }
+
+        /// \brief Largest absolute value so far.
+        private: double value = 0.0;
+      };
+
+      /// \brief Mean value of a signal, see SignalMean.
+      class Mean
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          this->sum += _x;
+        }
+
+        /// \brief Add the samples of another mean.
+        /// \param[in] _other The other mean.
+        public: void Merge(const Mean &_other, const std::size_t,
+                           const std::size_t)
+        {
+          this->sum += _other.sum;
+        }
+
+        /// \brief Get the mean.
+        /// \param[in] _count Number of samples.
+        /// \return The mean, or 0 if there are no samples.
+        public: double Value(const std::size_t _count) const
+        {
+          return _count == 0 ? 0.0 : this->sum / _count;
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "mean"
+        public: static std::string ShortName()
+        {
+          return "mean";
+        }
+
+        /// \brief Sum of the samples.
+        private: double sum = 0.0;
+      };
+
+      /// \brief Minimum value of a signal, see SignalMinimum.
+      /// NaN samples are ignored.
+      class Minimum
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          this->value = _x < this->value ? _x : this->value;
+        }
+
+        /// \brief Add the samples of another minimum.
+        /// \param[in] _other The other minimum.
+        public: void Merge(const Minimum &_other, const std::size_t,
+                           const std::size_t)
+        {
+          this->Insert(_other.value);
+        }
+
+        /// \brief Get the minimum.
+        /// \param[in] _count Number of samples.
+        /// \return The minimum, or 0 if there are no samples.
+        public: double Value(const std::size_t _count) const
+        {
+          return _count == 0 ? 0.0 : this->value;
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "min"
+        public: static std::string ShortName()
+        {
+          return "min";
+        }
+
+        /// \brief Smallest sample so far.
+        private: double value = std::numeric_limits<double>::infinity();
+      };
+
+      /// \brief Root mean square of a signal, see SignalRootMeanSquare.
+      class RootMeanSquare
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          this->sumSquares += _x * _x;
+        }
+
+        /// \brief Add the samples of another root mean square.
+        /// \param[in] _other The other root mean square.
+        public: void Merge(const RootMeanSquare &_other, const std::size_t,
+                           const std::size_t)
+        {
+          this->sumSquares += _other.sumSquares;
+        }
+
+        /// \brief Get the root mean square.
+        /// \param[in] _count Number of samples.
+        /// \return The root mean square, or 0 if there are no samples.
+        public: double Value(const std::size_t _count) const
+        {
+          return _count == 0 ? 0.0 : std::sqrt(this->sumSquares / _count);
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "rms"
+        public: static std::string ShortName()
+        {
+          return "rms";
+        }
+
+        /// \brief Sum of the squared samples.
+        private: double sumSquares = 0.0;
+      };
+
+      /// \brief Sample variance of a signal, see SignalVariance.
+      ///
+      /// The sums of the samples and of their squares are taken relative
+      /// to the first sample, which keeps them small for signals whose
+      /// mean is large compared to their spread, without the division
+      /// per sample of the online algorithm used by SignalVariance.
+      class Variance
+      {
+        /// \brief Add a sample.
+        /// \param[in] _x New signal data point.
+        public: void Insert(const double _x)
+        {
+          if (!this->started)
+          {
+            this->shift = _x;
+            this->started = true;
+          }
+          const double d = _x - this->shift;
+          this->sum += d;
+          this->sumSquares += d * d;
+        }
+
+        /// \brief Add the samples of another variance. Its sums are moved
+        /// to the shift of this one before they are added.
+        /// \param[in] _other The other variance.
+        /// \param[in] _otherCount Number of samples of the other variance.
+        public: void Merge(const Variance &_other, const std::size_t,
+                           const std::size_t _otherCount)
+        {
+          if (!_other.started)
+            return;
+          if (!this->started)
+          {
+            *this = _other;
+            return;
+          }
+
+          // x - shift = (x - other.shift) + c
+          const double c = _other.shift - this->shift;
+          const double n = static_cast<double>(_otherCount);
+          this->sumSquares +=
+            _other.sumSquares + 2.0 * c * _other.sum + n * c * c;
+          this->sum += _other.sum + n * c;
+        }
+
+        /// \brief Get the sample variance.
+        /// \param[in] _count Number of samples.
+        /// \return The variance, or 0 if there are fewer than two samples.
+        public: double Value(const std::size_t _count) const
+        {
+          if (_count < 2)
+            return 0.0;
+          const double n = static_cast<double>(_count);
+          return std::max(0.0,
+              (this->sumSquares - this->sum * this->sum / n) / (n - 1.0));
+        }
+
+        /// \brief Get the short name of the statistic.
+        /// \return "var"
+        public: static std::string ShortName()
+        {
+          return "var";
+        }
+
+        /// \brief Value subtracted from each sample.
+        private: double shift = 0.0;
+
+        /// \brief Sum of the shifted samples.
+        private: double sum = 0.0;
+
+        /// \brief Sum of the squared shifted samples.
+        private: double sumSquares = 0.0;
+
+        /// \brief True once the shift has been set.
+        private: bool started = false;
+      };
+    }
+
+    /// \class SignalStatsPack SignalStatsPack.hh
+    /// ignition/math/SignalStatsPack.hh
+    /// \brief A collection of statistics for a scalar signal, chosen at
+    /// compile time.
+    ///
+    /// SignalStats picks its statistics at run time and makes a virtual
+    /// call per statistic and sample. A SignalStatsPack holds its
+    /// statistics by value, so they are inlined and updated together in a
+    /// single pass over the data, sharing one sample count.
+    ///
+    /// \code{.cpp}
+    /// gz::math::SignalStatsPack<gz::math::stats::Mean,
+    ///     gz::math::stats::Variance> pack;
+    /// pack.InsertData(samples.data(), samples.size());
+    /// double mean = pack.Value<gz::math::stats::Mean>();
+    /// \endcode
+    ///
+    /// \tparam Stats Statistics from the stats namespace, or any type with
+    /// the same members. Each type can appear only once.
+    template<typename... Stats>
+    class SignalStatsPack
+    {
+      /// \brief Get number of data points.
+      /// \return Number of data points.
+      public: std::size_t Count() const
+      {
+        return this->count;
+      }
+
+      /// \brief Get the current value of one statistic.
+      /// \tparam Stat Type of the statistic, which must be part of the pack.
+      /// \return Current value of the statistic.
+      public: template<typename Stat>
+              double Value() const
+      {
+        return std::get<Stat>(this->stats).Value(this->count);
+      }
+
+      /// \brief Get the current values of each statistic, stored in a map
+      /// using the short name as the key, same as SignalStats::Map().
+      /// \return Map with short name of each statistic as key
+      /// and value of statistic as the value.
+      public: std::map<std::string, double> Map() const
+      {
+        std::map<std::string, double> map;
+        ((map[Stats::ShortName()] = this->Value<Stats>()), ...);
+        return map;
+      }
+
+      /// \brief Add a new sample to the statistics.
+      /// \param[in] _data New signal data point.
+      public: void InsertData(const double _data)
+      {
+        std::apply([_data](Stats &... _stats)
+        {
+          (_stats.Insert(_data), ...);
+        }, this->stats);
+        ++this->count;
+      }
+
+      /// \brief Add a batch of samples to the statistics, in a single pass.
+      ///
+      /// With more than one thread, the samples are split into contiguous
+      /// chunks that are reduced separately and merged in order, see
+      /// Merge(). The results can then differ from a single thread in the
+      /// last bits.
+      /// \param[in] _data Pointer to the signal data points.
+      /// \param[in] _count Number of data points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void InsertData(const double *_data, const std::size_t _count,
+                              const unsigned int _threads = 1)
+      {
+        const std::size_t chunks = std::min<std::size_t>(
+            std::max(1u, _threads), _count / kParallelGrain);
+        if (chunks > 1)
+        {
+          this->InsertDataParallel(_data, _count, chunks);
+          return;
+        }
+
+        // Work on a local copy so that the statistics stay in registers.
+        std::tuple<Stats...> local = this->stats;
+        std::apply([_data, _count](Stats &... _stats)
+        {
+          for (std::size_t i = 0; i < _count; ++i)
+          {
+            const double x = _data[i];
+            (_stats.Insert(x), ...);
+          }
+        }, local);
+        this->stats = local;
+        this->count += _count;
+      }
+
+      /// \brief Add a batch of samples to the statistics, in a single pass.
+      /// \param[in] _data The signal data points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void InsertData(const std::vector<double> &_data,
+                              const unsigned int _threads = 1)
+      {
+        this->InsertData(_data.data(), _data.size(), _threads);
+      }
+
+      /// \brief Merge the data of another pack into this one, as if its
+      /// samples had been inserted into this one. This allows statistics
+      /// to be computed over shards of a signal and combined afterwards.
+      /// \param[in] _other The pack to merge.
+      public: void Merge(const SignalStatsPack &_other)
+      {
+        const std::size_t thisCount = this->count;
+        const std::size_t otherCount = _other.count;
+        std::apply([&](Stats &... _stats)
+        {
+          (_stats.Merge(std::get<Stats>(_other.stats), thisCount,
+                        otherCount), ...);
+        }, this->stats);
+        this->count += otherCount;
+      }
+
+      /// \brief Forget all previous data.
+      public: void Reset()
+      {
+        this->stats = std::tuple<Stats...>();
+        this->count = 0;
+      }
+
+      /// \brief Reduce contiguous chunks of the samples on separate
+      /// threads and merge the results in order.
+      /// \param[in] _data Pointer to the signal data points.
+      /// \param[in] _count Number of data points.
+      /// \param[in] _chunks Number of chunks, one per thread.
+      private: void InsertDataParallel(const double *_data,
+                                       const std::size_t _count,
+                                       const std::size_t _chunks)
+      {
+        std::vector<SignalStatsPack> partial(_chunks);
+        const std::size_t chunkSize = (_count + _chunks - 1) / _chunks;
+        detail::ParallelFor(_chunks, static_cast<unsigned int>(_chunks),
+            [&](const std::size_t _begin, const std::size_t _end)
+            {
+              for (std::size_t c = _begin; c < _end; ++c)
+              {
+                const std::size_t begin = c * chunkSize;
+                const std::size_t end = std::min(_count, begin + chunkSize);
+                partial[c].InsertData(_data + begin, end - begin);
+              }
+            }, 1);
+
+        for (const auto &pack : partial)
+          this->Merge(pack);
+      }
+
+      /// \brief Minimum number of samples per thread in InsertData, below
+      /// which starting a thread costs more than it saves.
+      private: static constexpr std::size_t kParallelGrain = 65536;
+
+      /// \brief The statistics.
+      private: std::tuple<Stats...> stats;
+
+      /// \brief Number of data points.
+      private: std::size_t count = 0;
+    };
+    }
+  }
+}
+#endif
@@ -17,8 +17,10 @@
 #ifndef GZ_MATH_SPHERICALCOORDINATES_HH_
 #define GZ_MATH_SPHERICALCOORDINATES_HH_
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gz/math/Angle.hh>
 #include <gz/math/Vector3.hh>
@@ -68,6 +70,30 @@ namespace ignition
                 LOCAL2 = 5
               };
 
+      /// \enum ApproximationType
+      /// \brief Models used to convert positions between SPHERICAL and the
+      /// Cartesian frames GLOBAL, LOCAL and LOCAL2.
+      public: enum ApproximationType
+              {
+                /// \brief Exact conversion through ECEF.
+                EXACT = 0,
+
+                /// \brief Second order expansion of the geodetic coordinates
+                /// in the tangent plane at the reference point. This is an
+                /// equirectangular projection with curvature corrections and
+                /// needs no trigonometric functions per point.
+                ///
+                /// Compared to EXACT, for points less than 5 km horizontally
+                /// and 1 km vertically from the reference point, the
+                /// position error is below 5 mm for reference latitudes up
+                /// to 60 degrees, and below 5 cm up to 80 degrees. The error
+                /// grows with the cube of the distance to the reference
+                /// point, it is 125 times smaller within 1 km, and it grows
+                /// quickly closer to the poles, so this mode is meant for
+                /// small operating areas.
+                TANGENT_PLANE = 1
+              };
+
       /// \brief Constructor.
       public: SphericalCoordinates();
 
@@ -110,6 +136,25 @@ namespace ignition
       public: gz::math::Vector3d SphericalFromLocalPosition(
                   const gz::math::Vector3d &_xyz) const;
 
+      /// \brief Convert a contiguous array of Cartesian position vectors to
+      /// geodetic coordinates. This produces the same result as calling
+      /// SphericalFromLocalPosition(const Vector3d &) const on every point,
+      /// up to rounding, see
+      /// PositionTransform(const Vector3d *, Vector3d *, std::size_t,
+      /// const CoordinateType &, const CoordinateType &, unsigned int) const.
+      /// \param[in] _xyz Pointer to the first Cartesian position vector in
+      /// the heading-adjusted world frame.
+      /// \param[out] _latLonEle Pointer to the first output: geodetic
+      /// latitude (deg), longitude (deg), altitude above sea level (m). It
+      /// may be equal to _xyz to convert the points in place.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void SphericalFromLocalPosition(
+                  const gz::math::Vector3d *_xyz,
+                  gz::math::Vector3d *_latLonEle, std::size_t _count,
+                  unsigned int _threads = 1) const;
+
       /// \brief Convert a Cartesian velocity vector in the local frame
       ///        to a global Cartesian frame with components East, North, Up.
       /// This is a wrapper around `VelocityTransform(_xyz, LOCAL, GLOBAL)`
@@ -153,6 +198,10 @@ namespace ignition
       /// \return Current SurfaceType value.
       public: SurfaceType Surface() const;
 
+      /// \brief Get the approximation used to convert positions.
+      /// \return Current ApproximationType value, EXACT by default.
+      public: ApproximationType Approximation() const;
+
       /// \brief Get reference geodetic latitude.
       /// \return Reference geodetic latitude.
       public: gz::math::Angle LatitudeReference() const;
@@ -175,6 +224,13 @@ namespace ignition
       /// \param[in] _type SurfaceType value.
       public: void SetSurface(const SurfaceType &_type);
 
+      /// \brief Set the approximation used by PositionTransform and the
+      /// functions based on it to convert positions between SPHERICAL and
+      /// GLOBAL, LOCAL or LOCAL2. Conversions to and from ECEF, and velocity
+      /// conversions, are always exact.
+      /// \param[in] _type ApproximationType value.
+      public: void SetApproximation(const ApproximationType &_type);
+
       /// \brief Set reference geodetic latitude.
       /// \param[in] _angle Reference geodetic latitude.
       public: void SetLatitudeReference(const gz::math::Angle &_angle);
@@ -199,6 +255,23 @@ namespace ignition
       public: gz::math::Vector3d LocalFromSphericalPosition(
                   const gz::math::Vector3d &_latLonEle) const;
 
+      /// \brief Convert a contiguous array of geodetic position vectors to
+      /// Cartesian coordinates. This produces the same result as calling
+      /// LocalFromSphericalPosition(const Vector3d &) const on every point.
+      /// \param[in] _latLonEle Pointer to the first geodetic position in the
+      /// planetary frame of reference. X: latitude (deg), Y: longitude (deg),
+      /// Z: altitude.
+      /// \param[out] _xyz Pointer to the first output Cartesian position
+      /// vector in the heading-adjusted world frame. It may be equal to
+      /// _latLonEle to convert the points in place.
+      /// \param[in] _count Number of points.
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void LocalFromSphericalPosition(
+                  const gz::math::Vector3d *_latLonEle,
+                  gz::math::Vector3d *_xyz, std::size_t _count,
+                  unsigned int _threads = 1) const;
+
       /// \brief Convert a Cartesian velocity vector with components East,
       /// North, Up to a local cartesian frame vector XYZ.
       /// This is a wrapper around `VelocityTransform(_xyz, GLOBAL, LOCAL)`
@@ -220,6 +293,46 @@ namespace ignition
               PositionTransform(const gz::math::Vector3d &_pos,
                   const CoordinateType &_in, const CoordinateType &_out) const;
 
+      /// \brief Convert a contiguous array of positions between
+      /// SPHERICAL/ECEF/LOCAL/GLOBAL frames. Spherical coordinates use
+      /// radians, while the other frames use meters.
+      ///
+      /// The points are converted in blocks, one stage at a time, using the
+      /// cached rotation matrices, so that the linear stages vectorize. The
+      /// conversion from ECEF to SPHERICAL derives the sines and cosines from
+      /// the tangents instead of calling the trigonometric functions, so its
+      /// result may differ from
+      /// PositionTransform(const Vector3d &, const CoordinateType &,
+      /// const CoordinateType &) const in the last bits, and it is more
+      /// accurate close to the polar axis. The other conversions give the
+      /// same result.
+      /// \param[in] _pos Pointer to the first position, in the frame
+      /// defined by parameter _in.
+      /// \param[out] _result Pointer to the first transformed position. It
+      /// may be equal to _pos to transform the points in place.
+      /// \param[in] _count Number of points.
+      /// \param[in] _in CoordinateType for input
+      /// \param[in] _out CoordinateType for output
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      public: void PositionTransform(const gz::math::Vector3d *_pos,
+                  gz::math::Vector3d *_result, std::size_t _count,
+                  const CoordinateType &_in, const CoordinateType &_out,
+                  unsigned int _threads = 1) const;
+
+      /// \brief Convert a vector of positions in place between
+      /// SPHERICAL/ECEF/LOCAL/GLOBAL frames.
+      /// \param[in,out] _pos Positions to transform.
+      /// \param[in] _in CoordinateType for input
+      /// \param[in] _out CoordinateType for output
+      /// \param[in] _threads Maximum number of threads to split the work
+      /// across. The default of 1 uses only the calling thread.
+      /// \sa PositionTransform(const Vector3d *, Vector3d *, std::size_t,
+      /// const CoordinateType &, const CoordinateType &, unsigned int) const
+      public: void PositionTransform(std::vector<gz::math::Vector3d> &_pos,
+                  const CoordinateType &_in, const CoordinateType &_out,
+                  unsigned int _threads = 1) const;
+
       /// \brief Convert between velocity in SPHERICAL/ECEF/LOCAL/GLOBAL frame
       /// Spherical coordinates use radians, while the other frames use meters.
       /// \param[in] _vel Velocity vector in frame defined by parameter _in
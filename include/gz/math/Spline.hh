@@ -19,6 +19,9 @@
 #ifndef GZ_MATH_SPLINE_HH_
 #define GZ_MATH_SPLINE_HH_
 
+#include <cstddef>
+#include <vector>
+
 #include <gz/math/Helpers.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/config.hh>
@@ -54,6 +57,26 @@ namespace ignition
       /// \return the value of the tension, which is between 0.0 and 1.0.
       public: double Tension() const;
 
+      /// \brief Sets the size of the arc length table. When the size is
+      /// greater than 0, the spline samples the inverse of its arc length
+      /// function at that many evenly spaced lengths, plus one, every time
+      /// it is rebuilt. Functions that take a parameter value over the whole
+      /// spline then look up the table in constant time, and the parameter
+      /// value becomes proportional to the arc length also within each
+      /// segment, so that evenly spaced parameter values give points evenly
+      /// spaced along the curve. A size of a few entries per segment is
+      /// usually enough. The default of 0 disables the table: the
+      /// segment is then found by a binary search, and the arc length is
+      /// assumed to be linear with the parameter within each segment.
+      /// \param[in] _size Number of intervals of the table, or 0 to disable
+      /// it.
+      public: void ArcLengthTableSize(const unsigned int _size);
+
+      /// \brief Gets the size of the arc length table.
+      /// \return Number of intervals of the table, 0 if it is disabled.
+      /// \sa ArcLengthTableSize(const unsigned int)
+      public: unsigned int ArcLengthTableSize() const;
+
       /// \brief Gets spline arc length.
       /// \return arc length or INF on error.
       public: double ArcLength() const;
@@ -172,6 +195,16 @@ namespace ignition
       public: Vector3d Interpolate(const unsigned int _fromIndex,
                                    const double _t) const;
 
+      /// \brief Interpolates points on the spline at evenly spaced parameter
+      /// values from 0 to 1, in one pass. Point i is the same as
+      /// Interpolate(i / (_count - 1.0)), but the segments are walked in
+      /// order instead of searched for each point.
+      /// \param[in] _count Number of points.
+      /// \param[out] _points The interpolated points, resized to _count.
+      /// \sa ArcLengthTableSize(const unsigned int)
+      public: void Interpolate(const std::size_t _count,
+                               std::vector<Vector3d> &_points) const;
+
       /// \brief Interpolates a tangent on the spline at
       /// parameter value \p _t.
       /// \remarks Parameter value is normalized over the
@@ -247,7 +280,8 @@ namespace ignition
       /// \brief Maps \p _t parameter value over the whole spline
       /// to the right segment (starting at point \p _index) with
       /// the proper parameter value fraction \p _fraction.
-      /// \remarks Arc length is assumed to be linear with the parameter.
+      /// \remarks Arc length is assumed to be linear with the parameter,
+      /// unless the arc length table is enabled.
       /// \param[in] _t parameter value over the whole spline (range 0 to 1).
       /// \param[out] _index point index at which the segment starts.
       /// \param[out] _fraction parameter value fraction for the given segment.
@@ -17,7 +17,9 @@
 #ifndef GZ_MATH_VECTOR3STATS_HH_
 #define GZ_MATH_VECTOR3STATS_HH_
 
+#include <cstddef>
 #include <string>
+#include <vector>
 #include <gz/math/Helpers.hh>
 #include <gz/math/SignalStats.hh>
 #include <gz/math/Vector3.hh>
@@ -47,6 +49,17 @@ namespace ignition
       /// \param[in] _data New signal data point.
       public: void InsertData(const Vector3d &_data);
 
+      /// \brief Add a batch of samples to the statistical measures.
+      /// The components and magnitudes are gathered in blocks and passed to
+      /// SignalStats::InsertData(const double *, const std::size_t).
+      /// \param[in] _data Pointer to the signal data points.
+      /// \param[in] _count Number of data points.
+      public: void InsertData(const Vector3d *_data, const std::size_t _count);
+
+      /// \brief Add a batch of samples to the statistical measures.
+      /// \param[in] _data The signal data points.
+      public: void InsertData(const std::vector<Vector3d> &_data);
+
       /// \brief Add a new type of statistic.
       /// \param[in] _name Short name of new statistic.
       /// Valid values include:
@@ -67,6 +80,14 @@ namespace ignition
       /// been inserted.
       public: bool InsertStatistics(const std::string &_names);
 
+      /// \brief Merge the data of another Vector3Stats into this one, as if
+      /// its samples had been inserted into this one.
+      /// \param[in] _other Statistics to merge. It must have the same
+      /// statistics as this one.
+      /// \return True if the statistics were merged, see
+      /// SignalStats::Merge().
+      public: bool Merge(const Vector3Stats &_other);
+
       /// \brief Forget all previous data.
       public: void Reset();
 
@@ -25,6 +25,10 @@
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
 
+#ifdef IGNITION_MATH_ENABLE_SIMD
+#include <gz/math/detail/Simd.hh>
+#endif
+
 namespace ignition
 {
   namespace math
@@ -746,6 +750,58 @@ namespace ignition
         std::numeric_limits<T>::quiet_NaN(),
         std::numeric_limits<T>::quiet_NaN());
 
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+    /// \brief SIMD specialization of the addition operator for doubles,
+    /// enabled by the IGNITION_MATH_ENABLE_SIMD build option.
+    /// \param[in] _v The vector to add.
+    /// \return The sum vector.
+    template<>
+    inline Vector4<double> Vector4<double>::operator+(
+        const Vector4<double> &_v) const
+    {
+      Vector4<double> result;
+      detail::simd::Add4(this->data, _v.data, result.data);
+      return result;
+    }
+
+    /// \brief SIMD specialization of the subtraction operator for doubles,
+    /// enabled by the IGNITION_MATH_ENABLE_SIMD build option.
+    /// \param[in] _v The vector to subtract.
+    /// \return The difference vector.
+    template<>
+    inline Vector4<double> Vector4<double>::operator-(
+        const Vector4<double> &_v) const
+    {
+      Vector4<double> result;
+      detail::simd::Sub4(this->data, _v.data, result.data);
+      return result;
+    }
+
+    /// \brief SIMD specialization of the element wise multiplication
+    /// operator for doubles, enabled by the IGNITION_MATH_ENABLE_SIMD build
+    /// option.
+    /// \param[in] _pt Another vector.
+    /// \return The result vector.
+    template<>
+    inline const Vector4<double> Vector4<double>::operator*(
+        const Vector4<double> &_pt) const
+    {
+      Vector4<double> result;
+      detail::simd::Mul4(this->data, _pt.data, result.data);
+      return result;
+    }
+
+    /// \brief SIMD specialization of the dot product for doubles, enabled
+    /// by the IGNITION_MATH_ENABLE_SIMD build option.
+    /// \param[in] _v The vector.
+    /// \return The dot product.
+    template<>
+    inline double Vector4<double>::Dot(const Vector4<double> &_v) const
+    {
+      return detail::simd::Dot4(this->data, _v.data);
+    }
+#endif
+
     typedef Vector4<int> Vector4i;
     typedef Vector4<double> Vector4d;
     typedef Vector4<float> Vector4f;
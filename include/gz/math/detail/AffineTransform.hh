@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_DETAIL_AFFINETRANSFORM_HH_
+#define GZ_MATH_DETAIL_AFFINETRANSFORM_HH_
+
+#include <cstddef>
+
+#include <gz/math/Vector3.hh>
+#include <gz/math/config.hh>
+#include <gz/math/detail/ParallelFor.hh>
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace detail
+{
+  /// \brief Row-major 3x4 affine transform [R | t], kept as plain scalars
+  /// so that the batch loops below only touch local values and can be
+  /// auto-vectorized by the compiler.
+  template<typename T>
+  struct Affine3x4
+  {
+    /// \brief Matrix entries, row-major.
+    T m[3][4];
+  };
+
+  /// \brief Apply an affine transform to a contiguous array of points.
+  /// \param[in] _a The transform.
+  /// \param[in] _in First input point.
+  /// \param[out] _out First output point. May be equal to _in.
+  /// \param[in] _count Number of points.
+  /// \param[in] _threads Maximum number of threads, see ParallelFor.
+  template<typename T>
+  void AffineTransform(const Affine3x4<T> &_a, const Vector3<T> *_in,
+      Vector3<T> *_out, const std::size_t _count, const unsigned int _threads)
+  {
+    const Affine3x4<T> a = _a;
+    ParallelFor(_count, _threads,
+        [a, _in, _out](const std::size_t _begin, const std::size_t _end)
+        {
+          for (std::size_t i = _begin; i < _end; ++i)
+          {
+            const T x = _in[i].X();
+            const T y = _in[i].Y();
+            const T z = _in[i].Z();
+            _out[i].Set(
+                a.m[0][0] * x + a.m[0][1] * y + a.m[0][2] * z + a.m[0][3],
+                a.m[1][0] * x + a.m[1][1] * y + a.m[1][2] * z + a.m[1][3],
+                a.m[2][0] * x + a.m[2][1] * y + a.m[2][2] * z + a.m[2][3]);
+          }
+        });
+  }
+
+  /// \brief Apply an affine transform in place to points stored as
+  /// separate x, y and z arrays (structure of arrays).
+  /// \param[in] _a The transform.
+  /// \param[in,out] _x Array of x coordinates.
+  /// \param[in,out] _y Array of y coordinates.
+  /// \param[in,out] _z Array of z coordinates.
+  /// \param[in] _count Number of points.
+  /// \param[in] _threads Maximum number of threads, see ParallelFor.
+  template<typename T>
+  void AffineTransform(const Affine3x4<T> &_a, T *_x, T *_y, T *_z,
+      const std::size_t _count, const unsigned int _threads)
+  {
+    const Affine3x4<T> a = _a;
+    ParallelFor(_count, _threads,
+        [a, _x, _y, _z](const std::size_t _begin, const std::size_t _end)
+        {
+          for (std::size_t i = _begin; i < _end; ++i)
+          {
+            const T x = _x[i];
+            const T y = _y[i];
+            const T z = _z[i];
+            _x[i] = a.m[0][0] * x + a.m[0][1] * y + a.m[0][2] * z + a.m[0][3];
+            _y[i] = a.m[1][0] * x + a.m[1][1] * y + a.m[1][2] * z + a.m[1][3];
+            _z[i] = a.m[2][0] * x + a.m[2][1] * y + a.m[2][2] * z + a.m[2][3];
+          }
+        });
+  }
+}
+}
+}
+}
+#endif
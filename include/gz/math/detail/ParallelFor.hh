@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_DETAIL_PARALLELFOR_HH_
+#define GZ_MATH_DETAIL_PARALLELFOR_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gz/math/config.hh>
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace detail
+{
+  /// \brief Split the index range [0, _count) into contiguous chunks and
+  /// call _func(begin, end) once per chunk, running chunks on up to
+  /// _threads threads. The calling thread processes the first chunk.
+  /// Values of 0 or 1 for _threads run everything on the calling thread.
+  /// Fewer threads than requested are used when there are less than _grain
+  /// items per thread, since spawning a thread costs more than processing
+  /// a small chunk.
+  /// \param[in] _count Number of items.
+  /// \param[in] _threads Maximum number of threads to use.
+  /// \param[in] _func Callable with signature void(std::size_t, std::size_t).
+  /// \param[in] _grain Minimum number of items per thread.
+  template<typename Function>
+  void ParallelFor(const std::size_t _count, const unsigned int _threads,
+      const Function &_func, const std::size_t _grain = 4096)
+  {
+    const std::size_t maxThreads =
+      std::max<std::size_t>(1, _count / std::max<std::size_t>(1, _grain));
+    const std::size_t threads =
+      std::min<std::size_t>(std::max(1u, _threads), maxThreads);
+
+    if (threads <= 1)
+    {
+      _func(std::size_t(0), _count);
+      return;
+    }
+
+    const std::size_t chunk = (_count + threads - 1) / threads;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t)
+    {
+      const std::size_t begin = t * chunk;
+      const std::size_t end = std::min(_count, begin + chunk);
+      if (begin < end)
+        workers.emplace_back(_func, begin, end);
+    }
+
+    _func(std::size_t(0), std::min(_count, chunk));
+
+    for (auto &worker : workers)
+      worker.join();
+  }
+}
+}
+}
+}
+#endif
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_DETAIL_SIMD_HH_
+#define GZ_MATH_DETAIL_SIMD_HH_
+
+#include <gz/math/config.hh>
+
+// Select a two lane double precision instruction set. SSE2 is part of the
+// x86-64 baseline, and is also used when compiling with AVX since the VEX
+// encoded forms are generated automatically. NEON double precision lanes
+// are only available on AArch64.
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define IGNITION_MATH_SIMD_SSE2 1
+  #define IGNITION_MATH_HAVE_SIMD 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define IGNITION_MATH_SIMD_NEON 1
+  #define IGNITION_MATH_HAVE_SIMD 1
+#endif
+
+#ifdef IGNITION_MATH_HAVE_SIMD
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace detail
+{
+namespace simd
+{
+#if defined(IGNITION_MATH_SIMD_SSE2)
+  /// \brief Register holding two doubles.
+  using Double2 = __m128d;
+
+  /// \brief Load two doubles from unaligned memory.
+  inline Double2 Load(const double *_p) { return _mm_loadu_pd(_p); }
+
+  /// \brief Store two doubles to unaligned memory.
+  inline void Store(double *_p, Double2 _v) { _mm_storeu_pd(_p, _v); }
+
+  /// \brief Build a register from two scalars, _a in the first lane.
+  inline Double2 Set(double _a, double _b) { return _mm_set_pd(_b, _a); }
+
+  /// \brief Broadcast a scalar to both lanes.
+  inline Double2 Splat(double _a) { return _mm_set1_pd(_a); }
+
+  /// \brief Lane-wise addition.
+  inline Double2 Add(Double2 _a, Double2 _b) { return _mm_add_pd(_a, _b); }
+
+  /// \brief Lane-wise subtraction.
+  inline Double2 Sub(Double2 _a, Double2 _b) { return _mm_sub_pd(_a, _b); }
+
+  /// \brief Lane-wise multiplication.
+  inline Double2 Mul(Double2 _a, Double2 _b) { return _mm_mul_pd(_a, _b); }
+
+  /// \brief Sum of both lanes.
+  inline double HorizontalAdd(Double2 _v)
+  {
+    return _mm_cvtsd_f64(_mm_add_sd(_v, _mm_unpackhi_pd(_v, _v)));
+  }
+
+  /// \brief Lane-wise less than comparison.
+  /// \return Bit i is set if lane i of _a is less than lane i of _b.
+  inline int LessMask(Double2 _a, Double2 _b)
+  {
+    return _mm_movemask_pd(_mm_cmplt_pd(_a, _b));
+  }
+
+  /// \brief Lane-wise finiteness check.
+  /// \return Bit i is set if lane i of _v is neither infinite nor NaN.
+  inline int FiniteMask(Double2 _v)
+  {
+    // inf - inf and NaN - NaN are NaN, which is unordered with itself
+    const __m128d d = _mm_sub_pd(_v, _v);
+    return _mm_movemask_pd(_mm_cmpord_pd(d, d));
+  }
+#elif defined(IGNITION_MATH_SIMD_NEON)
+  /// \brief Register holding two doubles.
+  using Double2 = float64x2_t;
+
+  /// \brief Load two doubles from unaligned memory.
+  inline Double2 Load(const double *_p) { return vld1q_f64(_p); }
+
+  /// \brief Store two doubles to unaligned memory.
+  inline void Store(double *_p, Double2 _v) { vst1q_f64(_p, _v); }
+
+  /// \brief Build a register from two scalars, _a in the first lane.
+  inline Double2 Set(double _a, double _b)
+  {
+    return vsetq_lane_f64(_b, vdupq_n_f64(_a), 1);
+  }
+
+  /// \brief Broadcast a scalar to both lanes.
+  inline Double2 Splat(double _a) { return vdupq_n_f64(_a); }
+
+  /// \brief Lane-wise addition.
+  inline Double2 Add(Double2 _a, Double2 _b) { return vaddq_f64(_a, _b); }
+
+  /// \brief Lane-wise subtraction.
+  inline Double2 Sub(Double2 _a, Double2 _b) { return vsubq_f64(_a, _b); }
+
+  /// \brief Lane-wise multiplication.
+  inline Double2 Mul(Double2 _a, Double2 _b) { return vmulq_f64(_a, _b); }
+
+  /// \brief Sum of both lanes.
+  inline double HorizontalAdd(Double2 _v) { return vaddvq_f64(_v); }
+
+  /// \brief Lane-wise less than comparison.
+  /// \return Bit i is set if lane i of _a is less than lane i of _b.
+  inline int LessMask(Double2 _a, Double2 _b)
+  {
+    const uint64x2_t m = vcltq_f64(_a, _b);
+    return static_cast<int>((vgetq_lane_u64(m, 0) & 1u) |
+                            (vgetq_lane_u64(m, 1) & 2u));
+  }
+
+  /// \brief Lane-wise finiteness check.
+  /// \return Bit i is set if lane i of _v is neither infinite nor NaN.
+  inline int FiniteMask(Double2 _v)
+  {
+    // inf - inf and NaN - NaN are NaN, which is not equal to itself
+    const Double2 d = vsubq_f64(_v, _v);
+    const uint64x2_t m = vceqq_f64(d, d);
+    return static_cast<int>((vgetq_lane_u64(m, 0) & 1u) |
+                            (vgetq_lane_u64(m, 1) & 2u));
+  }
+#endif
+
+  /// \brief Hamilton product of two quaternions stored as (w, x, y, z).
+  /// The terms are accumulated in the same order as the scalar
+  /// Quaternion<T>::operator*, so the result matches it exactly unless the
+  /// compiler contracts the scalar version into fused multiply-adds.
+  /// \param[in] _a Left hand quaternion.
+  /// \param[in] _b Right hand quaternion.
+  /// \param[out] _out Result. May not alias the inputs.
+  inline void QuaternionMultiply(const double _a[4], const double _b[4],
+      double _out[4])
+  {
+    const Double2 w = Splat(_a[0]);
+    const Double2 x = Splat(_a[1]);
+    const Double2 y = Splat(_a[2]);
+    const Double2 z = Splat(_a[3]);
+
+    // Lanes (w, x) of the result
+    Double2 lo = Mul(w, Load(_b));
+    lo = Add(lo, Mul(x, Set(-_b[1], _b[0])));
+    lo = Add(lo, Mul(y, Set(-_b[2], _b[3])));
+    lo = Add(lo, Mul(z, Set(-_b[3], -_b[2])));
+
+    // Lanes (y, z) of the result
+    Double2 hi = Mul(w, Load(_b + 2));
+    hi = Add(hi, Mul(x, Set(-_b[3], _b[2])));
+    hi = Add(hi, Mul(y, Set(_b[0], -_b[1])));
+    hi = Add(hi, Mul(z, Set(_b[1], _b[0])));
+
+    Store(_out, lo);
+    Store(_out + 2, hi);
+  }
+
+  /// \brief Lane-wise sum of two four element arrays.
+  /// \param[in] _a First operand.
+  /// \param[in] _b Second operand.
+  /// \param[out] _out Result. May alias the inputs.
+  inline void Add4(const double _a[4], const double _b[4], double _out[4])
+  {
+    const Double2 lo = Add(Load(_a), Load(_b));
+    const Double2 hi = Add(Load(_a + 2), Load(_b + 2));
+    Store(_out, lo);
+    Store(_out + 2, hi);
+  }
+
+  /// \brief Lane-wise difference of two four element arrays.
+  /// \param[in] _a First operand.
+  /// \param[in] _b Second operand.
+  /// \param[out] _out Result. May alias the inputs.
+  inline void Sub4(const double _a[4], const double _b[4], double _out[4])
+  {
+    const Double2 lo = Sub(Load(_a), Load(_b));
+    const Double2 hi = Sub(Load(_a + 2), Load(_b + 2));
+    Store(_out, lo);
+    Store(_out + 2, hi);
+  }
+
+  /// \brief Lane-wise product of two four element arrays.
+  /// \param[in] _a First operand.
+  /// \param[in] _b Second operand.
+  /// \param[out] _out Result. May alias the inputs.
+  inline void Mul4(const double _a[4], const double _b[4], double _out[4])
+  {
+    const Double2 lo = Mul(Load(_a), Load(_b));
+    const Double2 hi = Mul(Load(_a + 2), Load(_b + 2));
+    Store(_out, lo);
+    Store(_out + 2, hi);
+  }
+
+  /// \brief Dot product of two four element arrays. The summation order
+  /// differs from a sequential scalar loop, so results may differ from it
+  /// in the last bits.
+  /// \param[in] _a First operand.
+  /// \param[in] _b Second operand.
+  /// \return The dot product.
+  inline double Dot4(const double _a[4], const double _b[4])
+  {
+    return HorizontalAdd(Add(Mul(Load(_a), Load(_b)),
+                             Mul(Load(_a + 2), Load(_b + 2))));
+  }
+}
+}
+}
+}
+}
+#endif
+#endif
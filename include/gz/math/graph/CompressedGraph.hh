@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_GRAPH_COMPRESSEDGRAPH_HH_
+#define GZ_MATH_GRAPH_COMPRESSEDGRAPH_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <gz/math/config.hh>
+#include "gz/math/graph/Edge.hh"
+#include "gz/math/graph/Graph.hh"
+#include "gz/math/graph/Vertex.hh"
+
+namespace ignition
+{
+namespace math
+{
+// Inline bracket to help doxygen filtering.
+inline namespace IGNITION_MATH_VERSION_NAMESPACE {
+namespace graph
+{
+  /// \brief Represents an invalid dense vertex index.
+  static const std::size_t kNullIndex =
+    std::numeric_limits<std::size_t>::max();
+
+  /// \brief An immutable compressed sparse row (CSR) snapshot of the
+  /// connectivity of a Graph.
+  ///
+  /// Vertices are renumbered with dense indices in [0, VertexCount()), in
+  /// increasing VertexId order. The outgoing arcs of the vertex with index
+  /// i are stored contiguously in the range [Offsets()[i], Offsets()[i+1])
+  /// of Targets(), Weights() and EdgeIds(), sorted by target index. In an
+  /// undirected graph each edge produces one arc in each direction, except
+  /// self loops which produce a single arc.
+  ///
+  /// Traversing the snapshot does not allocate memory, which makes it
+  /// suitable for repeated queries on large graphs. Vertex and edge data are
+  /// not copied, they can be looked up in the original graph using Id() and
+  /// EdgeIds(). The snapshot does not track later changes to the graph.
+  ///
+  /// \code{.cpp}
+  /// gz::math::graph::DirectedGraph<int, double> graph(...);
+  /// gz::math::graph::CompressedGraph frozen(graph);
+  /// auto res = gz::math::graph::Dijkstra(frozen, 0);
+  /// \endcode
+  class CompressedGraph
+  {
+    /// \brief Default constructor. Creates an empty graph.
+    public: CompressedGraph() = default;
+
+    /// \brief Constructor. Takes a snapshot of a graph.
+    /// \param[in] _graph The graph.
+    public: template<typename V, typename E, typename EdgeType>
+    explicit CompressedGraph(const Graph<V, E, EdgeType> &_graph)
+    {
+      const auto vertices = _graph.Vertices();
+
+      this->ids.reserve(vertices.size());
+      for (auto const &v : vertices)
+        this->ids.push_back(v.first);
+
+      // Temporary storage for the arcs of one vertex, sorted before being
+      // appended to the flat arrays.
+      std::vector<std::tuple<std::size_t, EdgeId, double>> arcs;
+
+      this->offsets.reserve(this->ids.size() + 1);
+      for (auto const &id : this->ids)
+      {
+        arcs.clear();
+        _graph.ForEachIncidentFrom(id, [this, &arcs, &id](const EdgeType &_e)
+        {
+          arcs.emplace_back(this->Index(_e.From(id)), _e.Id(), _e.Weight());
+        });
+        std::sort(arcs.begin(), arcs.end());
+
+        for (auto const &arc : arcs)
+        {
+          this->targets.push_back(std::get<0>(arc));
+          this->edgeIds.push_back(std::get<1>(arc));
+          this->weights.push_back(std::get<2>(arc));
+        }
+        this->offsets.push_back(this->targets.size());
+      }
+    }
+
+    /// \brief Get the number of vertices.
+    /// \return The number of vertices.
+    public: std::size_t VertexCount() const
+    {
+      return this->ids.size();
+    }
+
+    /// \brief Get the number of arcs. In an undirected graph this is
+    /// about twice the number of edges.
+    /// \return The number of arcs.
+    public: std::size_t ArcCount() const
+    {
+      return this->targets.size();
+    }
+
+    /// \brief Get whether the graph is empty.
+    /// \return True when there are no vertices in the graph.
+    public: bool Empty() const
+    {
+      return this->ids.empty();
+    }
+
+    /// \brief Get the dense index of a vertex. This is a binary search.
+    /// \param[in] _id The vertex Id.
+    /// \return The dense index or kNullIndex if the vertex is not found.
+    public: std::size_t Index(const VertexId &_id) const
+    {
+      auto it = std::lower_bound(this->ids.begin(), this->ids.end(), _id);
+      if (it == this->ids.end() || *it != _id)
+        return kNullIndex;
+      return static_cast<std::size_t>(it - this->ids.begin());
+    }
+
+    /// \brief Get the Id of a vertex from its dense index.
+    /// \param[in] _index The dense index.
+    /// \return The vertex Id, or kNullId if the index is out of range.
+    public: VertexId Id(const std::size_t _index) const
+    {
+      if (_index >= this->ids.size())
+        return kNullId;
+      return this->ids[_index];
+    }
+
+    /// \brief Get the number of outgoing arcs of a vertex.
+    /// \param[in] _index The dense index of the vertex. Must be valid.
+    /// \return The number of outgoing arcs.
+    public: std::size_t OutDegree(const std::size_t _index) const
+    {
+      return this->offsets[_index + 1] - this->offsets[_index];
+    }
+
+    /// \brief Get the vertex Ids, indexed by dense index.
+    /// \return The vertex Ids, sorted in increasing order.
+    public: const std::vector<VertexId> &Ids() const
+    {
+      return this->ids;
+    }
+
+    /// \brief Get the arc offsets. This vector has VertexCount() + 1
+    /// elements, the arcs of vertex i are in [Offsets()[i], Offsets()[i+1]).
+    /// \return The arc offsets.
+    public: const std::vector<std::size_t> &Offsets() const
+    {
+      return this->offsets;
+    }
+
+    /// \brief Get the dense index of the target vertex of every arc.
+    /// \return The arc targets.
+    public: const std::vector<std::size_t> &Targets() const
+    {
+      return this->targets;
+    }
+
+    /// \brief Get the weight of every arc.
+    /// \return The arc weights.
+    public: const std::vector<double> &Weights() const
+    {
+      return this->weights;
+    }
+
+    /// \brief Get the Id of the edge that produced every arc.
+    /// \return The edge Ids.
+    public: const std::vector<EdgeId> &EdgeIds() const
+    {
+      return this->edgeIds;
+    }
+
+    /// \brief Vertex Ids, sorted.
+    private: std::vector<VertexId> ids;
+
+    /// \brief Arc offsets for each vertex, plus one past the end.
+    private: std::vector<std::size_t> offsets = {0};
+
+    /// \brief Target vertex index of each arc.
+    private: std::vector<std::size_t> targets;
+
+    /// \brief Weight of each arc.
+    private: std::vector<double> weights;
+
+    /// \brief Edge Id of each arc.
+    private: std::vector<EdgeId> edgeIds;
+  };
+}
+}
+}
+}
+#endif
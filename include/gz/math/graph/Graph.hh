@@ -17,11 +17,15 @@
 #ifndef GZ_MATH_GRAPH_GRAPH_HH_
 #define GZ_MATH_GRAPH_GRAPH_HH_
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 #include <map>
 #include <set>
 #include <string>
+#include <tuple>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -37,6 +41,26 @@ namespace math
 inline namespace IGNITION_MATH_VERSION_NAMESPACE {
 namespace graph
 {
+  /// \brief Problems found by Graph::Load(). Each entry is the position
+  /// of an ignored element in the input vectors.
+  struct GraphLoadReport
+  {
+    /// \brief Get whether all the vertices and edges were loaded.
+    /// \return True when nothing was ignored.
+    public: bool Valid() const
+    {
+      return this->ignoredVertices.empty() && this->ignoredEdges.empty();
+    }
+
+    /// \brief Positions of the vertices that were ignored because their Id
+    /// was repeated or no Id was available.
+    public: std::vector<std::size_t> ignoredVertices;
+
+    /// \brief Positions of the edges that were ignored because one of
+    /// their vertices does not exist or no Id was available.
+    public: std::vector<std::size_t> ignoredEdges;
+  };
+
   /// \brief A generic graph class.
   /// Both vertices and edges can store user information. A vertex could be
   /// created passing a custom Id if needed, otherwise it will be choosen
@@ -110,22 +134,127 @@ namespace graph
     public: Graph(const std::vector<Vertex<V>> &_vertices,
                   const std::vector<EdgeInitializer<E>> &_edges)
     {
-      // Add all vertices.
-      for (auto const &v : _vertices)
+      const auto report = this->Load(_vertices, _edges);
+
+      for (auto const &i : report.ignoredVertices)
+      {
+        std::cerr << "Invalid vertex with Id [" << _vertices[i].Id()
+                  << "]. Ignoring." << std::endl;
+      }
+
+      for (std::size_t i = 0; i < report.ignoredEdges.size(); ++i)
+        std::cerr << "Ignoring edge" << std::endl;
+    }
+
+    /// \brief Replace the content of the graph with a collection of
+    /// vertices and edges.
+    /// The result is the same as clearing the graph and calling AddVertex()
+    /// and AddEdge() for each element in order, but the input is validated
+    /// in a single pass and the internal containers are filled in sorted
+    /// order, which is much faster for large graphs. Input vertices sorted
+    /// by Id are loaded fastest. Nothing is printed, the elements that could
+    /// not be added are listed in the returned report instead.
+    /// \param[in] _vertices Collection of vertices. Vertices with Id kNullId
+    /// get the next available Id.
+    /// \param[in] _edges Collection of edges. Edges get consecutive Ids.
+    /// \return Report with the elements that were ignored.
+    public: GraphLoadReport Load(const std::vector<Vertex<V>> &_vertices,
+                                 const std::vector<EdgeInitializer<E>> &_edges)
+    {
+      GraphLoadReport report;
+
+      this->vertices.clear();
+      this->edges.clear();
+      this->adjList.clear();
+      this->names.clear();
+      this->nextVertexId = 0u;
+      this->nextEdgeId = 0u;
+
+      // Assign the vertex Ids in input order, like AddVertex() would.
+      std::unordered_set<VertexId> used;
+      used.reserve(_vertices.size());
+      std::vector<std::pair<VertexId, std::size_t>> ids;
+      ids.reserve(_vertices.size());
+      for (std::size_t i = 0; i < _vertices.size(); ++i)
+      {
+        auto id = _vertices[i].Id();
+        if (id == kNullId)
+        {
+          while (used.find(this->nextVertexId) != used.end() &&
+                 this->nextVertexId < MAX_UI64)
+          {
+            ++this->nextVertexId;
+          }
+          id = this->nextVertexId;
+        }
+
+        if (id == kNullId || !used.insert(id).second)
+        {
+          report.ignoredVertices.push_back(i);
+          continue;
+        }
+        ids.emplace_back(id, i);
+      }
+
+      // Insert the vertices in Id order, so each insertion is constant time.
+      if (!std::is_sorted(ids.begin(), ids.end()))
+        std::sort(ids.begin(), ids.end());
+      for (auto const &id : ids)
+      {
+        const auto &v = _vertices[id.second];
+        this->vertices.emplace_hint(this->vertices.end(), id.first,
+            Vertex<V>(v.Name(), v.Data(), id.first));
+        this->adjList.emplace_hint(this->adjList.end(), id.first, EdgeId_S());
+      }
+
+      // Names keep the insertion order among vertices with the same name.
+      std::vector<std::tuple<std::string, std::size_t, VertexId>> sortedNames;
+      sortedNames.reserve(ids.size());
+      for (auto const &id : ids)
+      {
+        sortedNames.emplace_back(_vertices[id.second].Name(), id.second,
+            id.first);
+      }
+      std::sort(sortedNames.begin(), sortedNames.end());
+      for (auto &name : sortedNames)
+      {
+        this->names.emplace_hint(this->names.end(),
+            std::move(std::get<0>(name)), std::get<2>(name));
+      }
+
+      // Create the edges, with consecutive Ids like AddEdge() would.
+      std::vector<std::pair<VertexId, EdgeId>> incidences;
+      incidences.reserve(2 * _edges.size());
+      EdgeId edgeId = this->nextEdgeId;
+      for (std::size_t i = 0; i < _edges.size(); ++i)
       {
-        if (!this->AddVertex(v.Name(), v.Data(), v.Id()).Valid())
+        const auto &e = _edges[i];
+        if (edgeId == kNullId ||
+            used.find(e.vertices.first) == used.end() ||
+            used.find(e.vertices.second) == used.end())
         {
-          std::cerr << "Invalid vertex with Id [" << v.Id() << "]. Ignoring."
-                    << std::endl;
+          report.ignoredEdges.push_back(i);
+          continue;
         }
+
+        this->nextEdgeId = edgeId++;
+        this->edges.emplace_hint(this->edges.end(), this->nextEdgeId,
+            EdgeType(e.vertices, e.data, e.weight, this->nextEdgeId));
+        incidences.emplace_back(e.vertices.first, this->nextEdgeId);
+        incidences.emplace_back(e.vertices.second, this->nextEdgeId);
       }
 
-      // Add all edges.
-      for (auto const &e : _edges)
+      // Fill the adjacency list in vertex order.
+      std::sort(incidences.begin(), incidences.end());
+      auto adjIt = this->adjList.begin();
+      for (auto const &incidence : incidences)
       {
-        if (!this->AddEdge(e.vertices, e.data, e.weight).Valid())
-          std::cerr << "Ignoring edge" << std::endl;
+        while (adjIt->first != incidence.first)
+          ++adjIt;
+        adjIt->second.emplace_hint(adjIt->second.end(), incidence.second);
       }
+
+      return report;
     }
 
     /// \brief Add a new vertex to the graph.
@@ -490,6 +619,87 @@ namespace graph
       return this->IncidentsTo(_vertex.Id());
     }
 
+    /// \brief Call a function for each outgoing edge of a vertex. This
+    /// visits the same edges as IncidentsFrom(), in increasing edge Id order,
+    /// but walks the adjacency list directly instead of building a map, so
+    /// it does not allocate memory.
+    /// \param[in] _vertex Id of the vertex.
+    /// \param[in] _func Function called with a const reference to each
+    /// outgoing edge. Nothing is called when the vertex does not exist.
+    /// The graph must not be modified from this function.
+    public: template<typename Function>
+    void ForEachIncidentFrom(const VertexId &_vertex, Function &&_func) const
+    {
+      const auto adjIt = this->adjList.find(_vertex);
+      if (adjIt == this->adjList.end())
+        return;
+
+      for (auto const &edgeId : adjIt->second)
+      {
+        const auto &edge = this->EdgeFromId(edgeId);
+        if (edge.From(_vertex) != kNullId)
+          _func(edge);
+      }
+    }
+
+    /// \brief Call a function for each incoming edge of a vertex. This
+    /// visits the same edges as IncidentsTo(), in increasing edge Id order,
+    /// without allocating memory.
+    /// \param[in] _vertex Id of the vertex.
+    /// \param[in] _func Function called with a const reference to each
+    /// incoming edge. Nothing is called when the vertex does not exist.
+    /// The graph must not be modified from this function.
+    public: template<typename Function>
+    void ForEachIncidentTo(const VertexId &_vertex, Function &&_func) const
+    {
+      const auto adjIt = this->adjList.find(_vertex);
+      if (adjIt == this->adjList.end())
+        return;
+
+      for (auto const &edgeId : adjIt->second)
+      {
+        const auto &edge = this->EdgeFromId(edgeId);
+        if (edge.To(_vertex) != kNullId)
+          _func(edge);
+      }
+    }
+
+    /// \brief Call a function for each vertex adjacent from a given vertex,
+    /// i.e. for the far end of each outgoing edge, without allocating
+    /// memory. Unlike AdjacentsFrom(), a neighbor connected through several
+    /// edges is visited once per edge, and neighbors are visited in edge Id
+    /// order.
+    /// \param[in] _vertex Id of the vertex.
+    /// \param[in] _func Function called with a const reference to each
+    /// adjacent vertex. The graph must not be modified from this function.
+    public: template<typename Function>
+    void ForEachAdjacentFrom(const VertexId &_vertex, Function &&_func) const
+    {
+      this->ForEachIncidentFrom(_vertex,
+          [this, &_vertex, &_func](const EdgeType &_edge)
+          {
+            _func(this->VertexFromId(_edge.From(_vertex)));
+          });
+    }
+
+    /// \brief Call a function for each vertex adjacent to a given vertex,
+    /// i.e. for the far end of each incoming edge, without allocating
+    /// memory. Unlike AdjacentsTo(), a neighbor connected through several
+    /// edges is visited once per edge, and neighbors are visited in edge Id
+    /// order.
+    /// \param[in] _vertex Id of the vertex.
+    /// \param[in] _func Function called with a const reference to each
+    /// adjacent vertex. The graph must not be modified from this function.
+    public: template<typename Function>
+    void ForEachAdjacentTo(const VertexId &_vertex, Function &&_func) const
+    {
+      this->ForEachIncidentTo(_vertex,
+          [this, &_vertex, &_func](const EdgeType &_edge)
+          {
+            _func(this->VertexFromId(_edge.To(_vertex)));
+          });
+    }
+
     /// \brief Get whether the graph is empty.
     /// \return True when there are no vertices in the graph or
     /// false otherwise.
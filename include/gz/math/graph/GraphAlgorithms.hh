@@ -17,15 +17,22 @@
 #ifndef GZ_MATH_GRAPH_GRAPHALGORITHMS_HH_
 #define GZ_MATH_GRAPH_GRAPHALGORITHMS_HH_
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
-#include <list>
 #include <map>
+#include <mutex>
 #include <queue>
 #include <stack>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <gz/math/config.hh>
+#include "gz/math/graph/CompressedGraph.hh"
+#include "gz/math/detail/ParallelFor.hh"
 #include "gz/math/graph/Graph.hh"
 #include "gz/math/Helpers.hh"
 
@@ -42,110 +49,254 @@ namespace graph
   /// the cost (first element) to reach a destination vertex (second element).
   using CostInfo = std::pair<double, VertexId>;
 
+  namespace detail
+  {
+    /// \internal
+    /// \brief Set of visited vertices used by the graph traversals.
+    /// Vertex Ids assigned by Graph are consecutive from 0, so they are
+    /// tracked in a dense bitmap that grows with the largest Id seen, which
+    /// allocates a few times per traversal instead of once per vertex.
+    /// Ids beyond kMaxDenseId, which can only come from user supplied Ids,
+    /// are tracked in a hash set instead.
+    class VisitedVertices
+    {
+      /// \brief Mark a vertex as visited.
+      /// \param[in] _id Id of the vertex.
+      /// \return True if the vertex had not been visited before.
+      public: bool Insert(const VertexId _id)
+      {
+        if (_id >= kMaxDenseId)
+          return this->sparse.insert(_id).second;
+
+        if (_id >= this->dense.size())
+        {
+          this->dense.resize(
+              std::max<std::size_t>(_id + 1, 2 * this->dense.size()), false);
+        }
+        if (this->dense[_id])
+          return false;
+        this->dense[_id] = true;
+        return true;
+      }
+
+      /// \brief Get whether a vertex has been visited.
+      /// \param[in] _id Id of the vertex.
+      /// \return True if the vertex has been visited.
+      public: bool Contains(const VertexId _id) const
+      {
+        if (_id >= kMaxDenseId)
+          return this->sparse.count(_id) > 0;
+        return _id < this->dense.size() && this->dense[_id];
+      }
+
+      /// \brief Largest vertex Id tracked in the dense bitmap, plus one.
+      private: static constexpr VertexId kMaxDenseId = VertexId(1) << 20;
+
+      /// \brief Visited flag of each vertex with a small Id.
+      private: std::vector<bool> dense;
+
+      /// \brief Visited vertices with a large Id.
+      private: std::unordered_set<VertexId> sparse;
+    };
+  }
+
   /// \brief Breadth first sort (BFS).
   /// Starting from the vertex == _from, it traverses the graph exploring the
   /// neighbors first, before moving to the next level neighbors.
   /// \param[in] _graph A graph.
   /// \param[in] _from The starting vertex.
   /// \return The vector of vertices Ids traversed in a breadth first manner.
+  /// An empty vector is returned if _from is not in the graph.
   template<typename V, typename E, typename EdgeType>
   std::vector<VertexId> BreadthFirstSort(const Graph<V, E, EdgeType> &_graph,
                                          const VertexId &_from)
   {
-    // Create an auxiliary graph, where the data is just a boolean value that
-    // stores whether the vertex has been visited or not.
-    Graph<bool, E, EdgeType> visitorGraph;
-
-    // Copy the vertices (just the Id).
-    for (auto const &v : _graph.Vertices())
-      visitorGraph.AddVertex("", false, v.first);
+    std::vector<VertexId> visited;
+    if (!_graph.VertexFromId(_from).Valid())
+      return visited;
 
-    // Copy the edges (without data).
-    for (auto const &e : _graph.Edges())
-      visitorGraph.AddEdge(e.second.get().Vertices(), E());
+    detail::VisitedVertices visitedSet;
+    std::queue<VertexId> pending;
+    pending.push(_from);
 
-    std::vector<VertexId> visited;
-    std::list<VertexId> pending = {_from};
+    // Neighbors of the current vertex. Reused to avoid allocations.
+    std::vector<VertexId> neighbors;
 
     while (!pending.empty())
     {
       auto vId = pending.front();
-      pending.pop_front();
+      pending.pop();
 
       // If the vertex has been visited, skip.
-      auto &vertex = visitorGraph.VertexFromId(vId);
-      if (vertex.Data())
+      if (!visitedSet.Insert(vId))
         continue;
 
       visited.push_back(vId);
-      vertex.Data() = true;
+
+      // Visit the neighbors in increasing Id order, once each.
+      neighbors.clear();
+      _graph.ForEachIncidentFrom(vId, [&neighbors, &vId](const EdgeType &_e)
+      {
+        neighbors.push_back(_e.From(vId));
+      });
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                      neighbors.end());
 
       // Add more vertices to visit if they haven't been visited yet.
-      auto adjacents = visitorGraph.AdjacentsFrom(vId);
-      for (auto const &adj : adjacents)
+      for (auto const &adj : neighbors)
       {
-        vId = adj.first;
-        auto &v = adj.second.get();
-        if (!v.Data())
-          pending.push_back(vId);
+        if (!visitedSet.Contains(adj))
+          pending.push(adj);
       }
     }
 
     return visited;
   }
 
+  /// \brief Breadth first sort (BFS) of a compressed graph.
+  /// This produces the same result as the BreadthFirstSort() overload for
+  /// Graph, without allocating memory per visited vertex.
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _from The starting vertex.
+  /// \return The vector of vertices Ids traversed in a breadth first manner.
+  /// An empty vector is returned if _from is not in the graph.
+  inline std::vector<VertexId> BreadthFirstSort(
+      const CompressedGraph &_graph, const VertexId &_from)
+  {
+    std::vector<VertexId> visitedIds;
+
+    const std::size_t start = _graph.Index(_from);
+    if (start == kNullIndex)
+      return visitedIds;
+
+    const auto &offsets = _graph.Offsets();
+    const auto &targets = _graph.Targets();
+
+    std::vector<bool> visited(_graph.VertexCount(), false);
+
+    // Queue of pending vertices, consumed from the front.
+    std::vector<std::size_t> pending = {start};
+    for (std::size_t next = 0; next < pending.size(); ++next)
+    {
+      const std::size_t u = pending[next];
+
+      // If the vertex has been visited, skip.
+      if (visited[u])
+        continue;
+
+      visitedIds.push_back(_graph.Id(u));
+      visited[u] = true;
+
+      // Add more vertices to visit if they haven't been visited yet.
+      for (std::size_t a = offsets[u]; a < offsets[u + 1]; ++a)
+      {
+        if (!visited[targets[a]])
+          pending.push_back(targets[a]);
+      }
+    }
+
+    return visitedIds;
+  }
+
   /// \brief Depth first sort (DFS).
   /// Starting from the vertex == _from, it visits the graph as far as
   /// possible along each branch before backtracking.
   /// \param[in] _graph A graph.
   /// \param[in] _from The starting vertex.
   /// \return The vector of vertices Ids visited in a depth first manner.
+  /// An empty vector is returned if _from is not in the graph.
   template<typename V, typename E, typename EdgeType>
   std::vector<VertexId> DepthFirstSort(const Graph<V, E, EdgeType> &_graph,
                                        const VertexId &_from)
   {
-    // Create an auxiliary graph, where the data is just a boolean value that
-    // stores whether the vertex has been visited or not.
-    Graph<bool, E, EdgeType> visitorGraph;
-
-    // Copy the vertices (just the Id).
-    for (auto const &v : _graph.Vertices())
-      visitorGraph.AddVertex("", false, v.first);
-
-    // Copy the edges (without data).
-    for (auto const &e : _graph.Edges())
-      visitorGraph.AddEdge(e.second.get().Vertices(), E());
-
     std::vector<VertexId> visited;
+    if (!_graph.VertexFromId(_from).Valid())
+      return visited;
+
+    detail::VisitedVertices visitedSet;
     std::stack<VertexId> pending({_from});
 
+    // Neighbors of the current vertex. Reused to avoid allocations.
+    std::vector<VertexId> neighbors;
+
     while (!pending.empty())
     {
       auto vId = pending.top();
       pending.pop();
 
       // If the vertex has been visited, skip.
-      auto &vertex = visitorGraph.VertexFromId(vId);
-      if (vertex.Data())
+      if (!visitedSet.Insert(vId))
         continue;
 
       visited.push_back(vId);
-      vertex.Data() = true;
+
+      // Visit the neighbors in increasing Id order, once each.
+      neighbors.clear();
+      _graph.ForEachIncidentFrom(vId, [&neighbors, &vId](const EdgeType &_e)
+      {
+        neighbors.push_back(_e.From(vId));
+      });
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                      neighbors.end());
 
       // Add more vertices to visit if they haven't been visited yet.
-      auto adjacents = visitorGraph.AdjacentsFrom(vId);
-      for (auto const &adj : adjacents)
+      for (auto const &adj : neighbors)
       {
-        vId = adj.first;
-        auto &v = adj.second.get();
-        if (!v.Data())
-          pending.push(vId);
+        if (!visitedSet.Contains(adj))
+          pending.push(adj);
       }
     }
 
     return visited;
   }
 
+  /// \brief Depth first sort (DFS) of a compressed graph.
+  /// This produces the same result as the DepthFirstSort() overload for
+  /// Graph, without allocating memory per visited vertex.
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _from The starting vertex.
+  /// \return The vector of vertices Ids visited in a depth first manner.
+  /// An empty vector is returned if _from is not in the graph.
+  inline std::vector<VertexId> DepthFirstSort(
+      const CompressedGraph &_graph, const VertexId &_from)
+  {
+    std::vector<VertexId> visitedIds;
+
+    const std::size_t start = _graph.Index(_from);
+    if (start == kNullIndex)
+      return visitedIds;
+
+    const auto &offsets = _graph.Offsets();
+    const auto &targets = _graph.Targets();
+
+    std::vector<bool> visited(_graph.VertexCount(), false);
+    std::vector<std::size_t> pending = {start};
+
+    while (!pending.empty())
+    {
+      const std::size_t u = pending.back();
+      pending.pop_back();
+
+      // If the vertex has been visited, skip.
+      if (visited[u])
+        continue;
+
+      visitedIds.push_back(_graph.Id(u));
+      visited[u] = true;
+
+      // Add more vertices to visit if they haven't been visited yet.
+      for (std::size_t a = offsets[u]; a < offsets[u + 1]; ++a)
+      {
+        if (!visited[targets[a]])
+          pending.push_back(targets[a]);
+      }
+    }
+
+    return visitedIds;
+  }
+
   /// \brief Dijkstra algorithm.
   /// Find the shortest path between the vertices in a graph.
   /// If only a graph and a source vertex is provided, the algorithm will
@@ -259,25 +410,764 @@ namespace graph
 
       pq.pop();
 
-      for (auto const &edgePair : _graph.IncidentsFrom(u))
+      const double uCost = dist[u].first;
+      _graph.ForEachIncidentFrom(u, [&dist, &pq, &u, &uCost](
+            const EdgeType &_edge)
       {
-        const auto &edge = edgePair.second.get();
-        const auto &v = edge.From(u);
-        double weight = edge.Weight();
+        const auto v = _edge.From(u);
+        auto &vInfo = dist[v];
 
         //  If there is shorted path to v through u.
-        if (dist[v].first > dist[u].first + weight)
+        if (vInfo.first > uCost + _edge.Weight())
         {
           // Updating distance of v.
-          dist[v] = std::make_pair(dist[u].first + weight, u);
-          pq.push(std::make_pair(dist[v].first, v));
+          vInfo = std::make_pair(uCost + _edge.Weight(), u);
+          pq.push(std::make_pair(vInfo.first, v));
         }
-      }
+      });
     }
 
     return dist;
   }
 
+  class DijkstraBuffer;
+
+  /// \brief Dijkstra algorithm on a compressed graph, writing the result
+  /// into a reusable buffer.
+  /// The buffer keeps its memory between calls, so once it has grown to
+  /// the size of the graph repeated queries do not allocate memory. This
+  /// is useful when running many queries, for example in a planning loop.
+  ///
+  /// \code{.cpp}
+  /// gz::math::graph::CompressedGraph graph(...);
+  /// gz::math::graph::DijkstraBuffer buffer;
+  /// for (auto const &goal : goals)
+  /// {
+  ///   if (gz::math::graph::Dijkstra(graph, start, buffer, goal))
+  ///     std::cout << buffer.Cost(graph.Index(goal)) << std::endl;
+  /// }
+  /// \endcode
+  ///
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[out] _result Buffer where the result is written. Its previous
+  /// content is discarded.
+  /// \param[in] _to Optional destination vertex. The search stops once the
+  /// shortest path to this vertex is found, and the costs of vertices that
+  /// are further away may not be final.
+  /// \return False if _from or _to are not in the graph, in which case the
+  /// buffer is left empty.
+  inline bool Dijkstra(const CompressedGraph &_graph,
+                       const VertexId &_from,
+                       DijkstraBuffer &_result,
+                       const VertexId &_to = kNullId);
+
+  /// \brief Result of Dijkstra() on a compressed graph, stored in dense
+  /// arrays indexed by the dense vertex index of the graph.
+  ///
+  /// Each entry has a generation stamp, and an entry is only valid when its
+  /// stamp matches the current generation. Starting a new query increments
+  /// the generation, which invalidates all the entries in constant time
+  /// instead of clearing the arrays. The priority queue used by the search
+  /// is also stored here, so its memory is reused as well.
+  class DijkstraBuffer
+  {
+    /// \brief Default constructor. Creates an empty buffer.
+    public: DijkstraBuffer() = default;
+
+    /// \brief Constructor. Allocates memory for a graph.
+    /// \param[in] _vertexCount Number of vertices in the graph.
+    public: explicit DijkstraBuffer(const std::size_t _vertexCount)
+    {
+      this->Reset(_vertexCount);
+    }
+
+    /// \brief Discard the current result and prepare the buffer for a
+    /// graph. This only allocates memory if the graph has more vertices
+    /// than any graph the buffer was used with before.
+    /// \param[in] _vertexCount Number of vertices in the graph.
+    public: void Reset(const std::size_t _vertexCount)
+    {
+      if (_vertexCount > this->stamps.size())
+      {
+        this->costs.resize(_vertexCount);
+        this->previous.resize(_vertexCount);
+        this->stamps.resize(_vertexCount, 0);
+      }
+      this->vertexCount = _vertexCount;
+      this->queue.clear();
+
+      // Clear the stamps when the generation wraps around, so old entries
+      // do not become valid again.
+      if (++this->generation == 0)
+      {
+        std::fill(this->stamps.begin(), this->stamps.end(), 0u);
+        this->generation = 1;
+      }
+    }
+
+    /// \brief Get the number of vertices of the graph of the last query.
+    /// \return The number of vertices.
+    public: std::size_t VertexCount() const
+    {
+      return this->vertexCount;
+    }
+
+    /// \brief Get whether a vertex was reached by the last query.
+    /// \param[in] _index Dense index of the vertex.
+    /// \return True if the vertex was reached.
+    public: bool Reached(const std::size_t _index) const
+    {
+      return _index < this->vertexCount &&
+             this->stamps[_index] == this->generation;
+    }
+
+    /// \brief Get the cost of the shortest path to a vertex.
+    /// \param[in] _index Dense index of the vertex.
+    /// \return The cost, or MAX_D if the vertex was not reached.
+    public: double Cost(const std::size_t _index) const
+    {
+      return this->Reached(_index) ? this->costs[_index] : MAX_D;
+    }
+
+    /// \brief Get the previous vertex in the shortest path to a vertex.
+    /// \param[in] _index Dense index of the vertex.
+    /// \return The dense index of the previous vertex, or kNullIndex if the
+    /// vertex was not reached. The start vertex is its own previous vertex.
+    public: std::size_t Previous(const std::size_t _index) const
+    {
+      return this->Reached(_index) ? this->previous[_index] : kNullIndex;
+    }
+
+    /// \brief Get the shortest path to a vertex.
+    /// \param[in] _index Dense index of the vertex.
+    /// \param[out] _path Dense indices of the vertices of the path, starting
+    /// at the start vertex and ending at _index. It is empty if the vertex
+    /// was not reached. Its memory is reused, so passing the same vector
+    /// to successive calls avoids allocations.
+    public: void Path(std::size_t _index,
+                      std::vector<std::size_t> &_path) const
+    {
+      _path.clear();
+      if (!this->Reached(_index))
+        return;
+
+      _path.push_back(_index);
+      while (this->previous[_index] != _index)
+      {
+        _index = this->previous[_index];
+        _path.push_back(_index);
+      }
+      std::reverse(_path.begin(), _path.end());
+    }
+
+    /// \brief Set the cost and previous vertex of a vertex if the cost is
+    /// lower than the current one.
+    /// \param[in] _index Dense index of the vertex.
+    /// \param[in] _cost The cost.
+    /// \param[in] _previous Dense index of the previous vertex.
+    /// \return True if the entry was updated.
+    private: bool Relax(const std::size_t _index, const double _cost,
+                        const std::size_t _previous)
+    {
+      if (this->Reached(_index) && this->costs[_index] <= _cost)
+        return false;
+
+      this->stamps[_index] = this->generation;
+      this->costs[_index] = _cost;
+      this->previous[_index] = _previous;
+      this->queue.push_back(std::make_pair(_cost, _index));
+      std::push_heap(this->queue.begin(), this->queue.end(),
+          std::greater<std::pair<double, std::size_t>>());
+      return true;
+    }
+
+    /// \brief Allow Dijkstra() to run the search.
+    friend bool Dijkstra(const CompressedGraph &_graph,
+                         const VertexId &_from,
+                         DijkstraBuffer &_result,
+                         const VertexId &_to);
+
+    /// \brief Number of vertices of the graph of the last query.
+    private: std::size_t vertexCount = 0;
+
+    /// \brief Current generation.
+    private: unsigned int generation = 0;
+
+    /// \brief Generation in which each entry was last written.
+    private: std::vector<unsigned int> stamps;
+
+    /// \brief Cost of each vertex.
+    private: std::vector<double> costs;
+
+    /// \brief Previous vertex of each vertex.
+    private: std::vector<std::size_t> previous;
+
+    /// \brief Binary heap with the pending vertices, ordered by cost.
+    private: std::vector<std::pair<double, std::size_t>> queue;
+  };
+
+  /////////////////////////////////////////////////
+  inline bool Dijkstra(const CompressedGraph &_graph,
+                       const VertexId &_from,
+                       DijkstraBuffer &_result,
+                       const VertexId &_to)
+  {
+    _result.Reset(_graph.VertexCount());
+
+    const std::size_t from = _graph.Index(_from);
+    const std::size_t to = _to == kNullId ? kNullIndex : _graph.Index(_to);
+    if (from == kNullIndex || (_to != kNullId && to == kNullIndex))
+    {
+      _result.Reset(0);
+      return false;
+    }
+
+    const auto &offsets = _graph.Offsets();
+    const auto &targets = _graph.Targets();
+    const auto &weights = _graph.Weights();
+    auto &queue = _result.queue;
+    const std::greater<std::pair<double, std::size_t>> greater;
+
+    _result.Relax(from, 0.0, from);
+
+    while (!queue.empty())
+    {
+      // This is the minimum distance vertex.
+      const double uCost = queue.front().first;
+      const std::size_t u = queue.front().second;
+
+      // Shortcut: Destination vertex found, exiting.
+      if (u == to)
+        break;
+
+      std::pop_heap(queue.begin(), queue.end(), greater);
+      queue.pop_back();
+
+      // Skip outdated entries.
+      if (uCost > _result.costs[u])
+        continue;
+
+      for (std::size_t a = offsets[u]; a < offsets[u + 1]; ++a)
+        _result.Relax(targets[a], uCost + weights[a], u);
+    }
+
+    return true;
+  }
+
+  /// \brief Dijkstra algorithm on a compressed graph.
+  /// See the Dijkstra() overload for Graph for a description of the
+  /// arguments and the result. The costs are the same, but when several
+  /// paths have the same cost a different previous vertex may be chosen.
+  /// The search itself works on dense arrays and does not allocate memory
+  /// per explored vertex.
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _to Optional destination vertex.
+  /// \return A map where the keys are the destination vertices. For each
+  /// destination, the value is a pair with the shortest cost from the origin
+  /// vertex and the previous vertex Id in the shortest path.
+  inline std::map<VertexId, CostInfo> Dijkstra(const CompressedGraph &_graph,
+                                               const VertexId &_from,
+                                               const VertexId &_to = kNullId)
+  {
+    const std::size_t from = _graph.Index(_from);
+    const std::size_t to = _to == kNullId ? kNullIndex : _graph.Index(_to);
+
+    // Sanity check: The source vertex should exist.
+    if (from == kNullIndex)
+    {
+      std::cerr << "Vertex [" << _from << "] Not found" << std::endl;
+      return {};
+    }
+
+    // Sanity check: The destination vertex should exist (if used).
+    if (_to != kNullId && to == kNullIndex)
+    {
+      std::cerr << "Vertex [" << _to << "] Not found" << std::endl;
+      return {};
+    }
+
+    DijkstraBuffer buffer;
+    Dijkstra(_graph, _from, buffer, _to);
+
+    std::map<VertexId, CostInfo> res;
+    for (std::size_t i = 0; i < _graph.VertexCount(); ++i)
+    {
+      res.emplace_hint(res.end(), _graph.Id(i),
+          std::make_pair(buffer.Cost(i), _graph.Id(buffer.Previous(i))));
+    }
+
+    return res;
+  }
+
+  namespace detail
+  {
+    /// \internal
+    /// \brief Reconstruct a path from a table of previous vertices. This is
+    /// a helper for AStar() and BidirectionalDijkstra().
+    /// \param[in] _prev Table that maps each reached vertex to a pair with
+    /// its cost and previous vertex. The start vertex is its own predecessor.
+    /// \param[in] _to Last vertex of the path.
+    /// \return The path, starting at the start vertex and ending at _to.
+    inline std::vector<VertexId> PathFromPrevious(
+        const std::unordered_map<VertexId, CostInfo> &_prev,
+        const VertexId &_to)
+    {
+      std::vector<VertexId> path = {_to};
+      for (auto it = _prev.find(_to);
+           it != _prev.end() && it->second.second != path.back();
+           it = _prev.find(it->second.second))
+      {
+        path.push_back(it->second.second);
+      }
+      std::reverse(path.begin(), path.end());
+      return path;
+    }
+  }
+
+  /// \brief A* search.
+  /// Find the shortest path between two vertices, guided by a heuristic
+  /// that estimates the remaining cost to the destination. Only the
+  /// vertices that are explored are stored, so the cost of a query depends
+  /// on the size of the explored region instead of the size of the graph.
+  ///
+  /// The path is optimal when the heuristic never overestimates the
+  /// remaining cost (admissible heuristic). A heuristic that always returns
+  /// zero makes this equivalent to Dijkstra with early termination.
+  ///
+  /// \code{.cpp}
+  /// // Vertex data holds the position of each vertex.
+  /// gz::math::graph::UndirectedGraph<gz::math::Vector3d, double> graph(...);
+  /// double cost;
+  /// auto path = gz::math::graph::AStar(graph, start, goal,
+  ///   [](const auto &_vertex, const auto &_goal)
+  ///   {
+  ///     return _vertex.Data().Distance(_goal.Data());
+  ///   }, &cost);
+  /// \endcode
+  ///
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _to The destination vertex.
+  /// \param[in] _heuristic Function with signature
+  /// double(const Vertex<V> &_vertex, const Vertex<V> &_goal) that
+  /// estimates the cost from _vertex to _goal.
+  /// \param[out] _cost Optional output. Cost of the path, or MAX_D when
+  /// there is no path.
+  /// \return The vertices of the shortest path, starting with _from and
+  /// ending with _to. An empty vector is returned when any of the vertices
+  /// is not in the graph or when _to is not reachable from _from.
+  template<typename V, typename E, typename EdgeType, typename Heuristic>
+  std::vector<VertexId> AStar(const Graph<V, E, EdgeType> &_graph,
+                              const VertexId &_from,
+                              const VertexId &_to,
+                              Heuristic &&_heuristic,
+                              double *_cost = nullptr)
+  {
+    if (_cost)
+      *_cost = MAX_D;
+
+    const auto &goal = _graph.VertexFromId(_to);
+    if (!_graph.VertexFromId(_from).Valid() || !goal.Valid())
+      return {};
+
+    // Cost from the start and previous vertex, for each reached vertex.
+    std::unordered_map<VertexId, CostInfo> reached;
+    reached[_from] = std::make_pair(0.0, _from);
+
+    // Queue sorted by estimated total cost. The cost from the start is
+    // stored to detect outdated entries.
+    using Entry = std::tuple<double, double, VertexId>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq;
+    pq.push(Entry(_heuristic(_graph.VertexFromId(_from), goal), 0.0, _from));
+
+    while (!pq.empty())
+    {
+      const double uCost = std::get<1>(pq.top());
+      const VertexId u = std::get<2>(pq.top());
+      pq.pop();
+
+      // Skip outdated entries.
+      if (uCost > reached[u].first)
+        continue;
+
+      if (u == _to)
+      {
+        if (_cost)
+          *_cost = uCost;
+        return detail::PathFromPrevious(reached, _to);
+      }
+
+      _graph.ForEachIncidentFrom(u,
+          [&_graph, &_heuristic, &goal, &reached, &pq, &u, &uCost](
+            const EdgeType &_edge)
+      {
+        const VertexId v = _edge.From(u);
+        const double vCost = uCost + _edge.Weight();
+
+        auto it = reached.find(v);
+        if (it == reached.end() || it->second.first > vCost)
+        {
+          reached[v] = std::make_pair(vCost, u);
+          pq.push(Entry(vCost + _heuristic(_graph.VertexFromId(v), goal),
+                        vCost, v));
+        }
+      });
+    }
+
+    return {};
+  }
+
+  /// \brief Bidirectional Dijkstra algorithm.
+  /// Find the shortest path between two vertices by searching forward from
+  /// the source and backward from the destination at the same time, and
+  /// stopping when the two searches meet. Only the vertices that are
+  /// explored are stored, so the cost of a query depends on the size of the
+  /// explored region instead of the size of the graph. On road-like graphs
+  /// this explores roughly half the vertices explored by Dijkstra().
+  /// \param[in] _graph A graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _to The destination vertex.
+  /// \param[out] _cost Optional output. Cost of the path, or MAX_D when
+  /// there is no path.
+  /// \return The vertices of the shortest path, starting with _from and
+  /// ending with _to. An empty vector is returned when any of the vertices
+  /// is not in the graph or when _to is not reachable from _from.
+  template<typename V, typename E, typename EdgeType>
+  std::vector<VertexId> BidirectionalDijkstra(
+      const Graph<V, E, EdgeType> &_graph,
+      const VertexId &_from,
+      const VertexId &_to,
+      double *_cost = nullptr)
+  {
+    if (_cost)
+      *_cost = MAX_D;
+
+    if (!_graph.VertexFromId(_from).Valid() ||
+        !_graph.VertexFromId(_to).Valid())
+    {
+      return {};
+    }
+
+    // Reached vertices of the forward and backward searches.
+    std::unordered_map<VertexId, CostInfo> forward;
+    std::unordered_map<VertexId, CostInfo> backward;
+    forward[_from] = std::make_pair(0.0, _from);
+    backward[_to] = std::make_pair(0.0, _to);
+
+    std::priority_queue<CostInfo,
+      std::vector<CostInfo>, std::greater<CostInfo>> forwardPq, backwardPq;
+    forwardPq.push(std::make_pair(0.0, _from));
+    backwardPq.push(std::make_pair(0.0, _to));
+
+    // Cost of the best path found so far, and the vertex where both
+    // searches meet on it.
+    double best = _from == _to ? 0.0 : MAX_D;
+    VertexId meeting = _from == _to ? _from : kNullId;
+
+    while (!forwardPq.empty() && !backwardPq.empty() &&
+           forwardPq.top().first + backwardPq.top().first < best)
+    {
+      // Expand the search with the smallest frontier cost.
+      const bool isForward = forwardPq.top().first <= backwardPq.top().first;
+      auto &pq = isForward ? forwardPq : backwardPq;
+      auto &reached = isForward ? forward : backward;
+      const auto &other = isForward ? backward : forward;
+
+      const double uCost = pq.top().first;
+      const VertexId u = pq.top().second;
+      pq.pop();
+
+      // Skip outdated entries.
+      if (uCost > reached[u].first)
+        continue;
+
+      auto relax = [&](const VertexId &_v, const double _weight)
+      {
+        const double vCost = uCost + _weight;
+        auto it = reached.find(_v);
+        if (it == reached.end() || it->second.first > vCost)
+        {
+          reached[_v] = std::make_pair(vCost, u);
+          pq.push(std::make_pair(vCost, _v));
+
+          // Check whether this improves the best path through _v.
+          auto otherIt = other.find(_v);
+          if (otherIt != other.end() &&
+              vCost + otherIt->second.first < best)
+          {
+            best = vCost + otherIt->second.first;
+            meeting = _v;
+          }
+        }
+      };
+
+      if (isForward)
+      {
+        _graph.ForEachIncidentFrom(u, [&u, &relax](const EdgeType &_edge)
+        {
+          relax(_edge.From(u), _edge.Weight());
+        });
+      }
+      else
+      {
+        _graph.ForEachIncidentTo(u, [&u, &relax](const EdgeType &_edge)
+        {
+          relax(_edge.To(u), _edge.Weight());
+        });
+      }
+    }
+
+    if (meeting == kNullId)
+      return {};
+
+    if (_cost)
+      *_cost = best;
+
+    // The forward half ends at the meeting vertex, the backward half is
+    // stored from the meeting vertex towards _to.
+    auto path = detail::PathFromPrevious(forward, meeting);
+    auto backwardPath = detail::PathFromPrevious(backward, meeting);
+    path.insert(path.end(), backwardPath.rbegin() + 1, backwardPath.rend());
+    return path;
+  }
+
+  /// \brief Calculate the connected component label of every vertex of a
+  /// compressed graph, using a concurrent union-find.
+  /// In a compressed directed graph the arcs are followed regardless of
+  /// their direction, which produces the weakly connected components.
+  /// Labels are consecutive integers starting at zero. Components are
+  /// numbered in increasing order of their smallest vertex Id, which is the
+  /// same order used by ConnectedComponents().
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _threads Maximum number of threads to use. Values of 0 or
+  /// 1 run on the calling thread.
+  /// \param[out] _count Optional output. Number of components.
+  /// \return The label of every vertex, indexed by dense index.
+  inline std::vector<std::size_t> ConnectedComponentLabels(
+      const CompressedGraph &_graph, const unsigned int _threads = 1,
+      std::size_t *_count = nullptr)
+  {
+    const std::size_t n = _graph.VertexCount();
+    const auto &offsets = _graph.Offsets();
+    const auto &targets = _graph.Targets();
+
+    // Parent of each vertex in the union-find forest. Roots are always
+    // linked to a root with a smaller index, so the root of a tree is the
+    // smallest index in its component and no cycles can appear.
+    std::vector<std::atomic<std::size_t>> parent(n);
+    math::detail::ParallelFor(n, _threads,
+        [&parent](const std::size_t _begin, const std::size_t _end)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+        parent[i].store(i, std::memory_order_relaxed);
+    });
+
+    // Find the root of a vertex, halving the path along the way.
+    auto find = [&parent](std::size_t _x)
+    {
+      std::size_t p = parent[_x].load(std::memory_order_relaxed);
+      while (p != _x)
+      {
+        const std::size_t gp = parent[p].load(std::memory_order_relaxed);
+        if (gp != p)
+          parent[_x].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+        _x = gp;
+        p = parent[_x].load(std::memory_order_relaxed);
+      }
+      return _x;
+    };
+
+    math::detail::ParallelFor(n, _threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      for (std::size_t u = _begin; u < _end; ++u)
+      {
+        for (std::size_t a = offsets[u]; a < offsets[u + 1]; ++a)
+        {
+          std::size_t ru = find(u);
+          std::size_t rv = find(targets[a]);
+          while (ru != rv)
+          {
+            if (ru < rv)
+              std::swap(ru, rv);
+
+            // Link the larger root below the smaller one. This fails if
+            // another thread linked ru in the meantime, so retry with the
+            // updated roots.
+            std::size_t expected = ru;
+            if (parent[ru].compare_exchange_strong(expected, rv,
+                  std::memory_order_relaxed))
+            {
+              break;
+            }
+            ru = find(ru);
+            rv = find(rv);
+          }
+        }
+      }
+    });
+
+    // Number the roots in increasing index order.
+    std::vector<std::size_t> labels(n);
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (find(i) == i)
+        labels[i] = count++;
+    }
+
+    // Only the labels of the roots are read, and they are already set, so
+    // skip them to avoid writing labels that other threads read.
+    math::detail::ParallelFor(n, _threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        const std::size_t root = find(i);
+        if (root != i)
+          labels[i] = labels[root];
+      }
+    });
+
+    if (_count)
+      *_count = count;
+    return labels;
+  }
+
+  /// \brief Calculate the connected component label of every vertex of an
+  /// undirected graph. Unlike ConnectedComponents(), this does not copy the
+  /// vertices and edges of the graph. Use ConnectedComponent() to build the
+  /// subgraph of a single component when needed.
+  /// \param[in] _graph A graph.
+  /// \param[in] _threads Maximum number of threads to use. Values of 0 or
+  /// 1 run on the calling thread.
+  /// \param[out] _count Optional output. Number of components.
+  /// \return The label of every vertex. Labels are consecutive integers
+  /// starting at zero, and follow the order of ConnectedComponents().
+  template<typename V, typename E>
+  std::unordered_map<VertexId, std::size_t> ConnectedComponentLabels(
+      const UndirectedGraph<V, E> &_graph, const unsigned int _threads = 1,
+      std::size_t *_count = nullptr)
+  {
+    const CompressedGraph csr(_graph);
+    const auto labels = ConnectedComponentLabels(csr, _threads, _count);
+
+    std::unordered_map<VertexId, std::size_t> res;
+    res.reserve(labels.size());
+    for (std::size_t i = 0; i < labels.size(); ++i)
+      res.emplace(csr.Id(i), labels[i]);
+    return res;
+  }
+
+  /// \brief Build the subgraph of a single connected component.
+  /// \param[in] _graph A graph.
+  /// \param[in] _labels Labels returned by ConnectedComponentLabels().
+  /// \param[in] _label Label of the component.
+  /// \return The component, with the same vertex Ids as the original graph.
+  /// The graph is empty when there is no component with this label.
+  template<typename V, typename E>
+  UndirectedGraph<V, E> ConnectedComponent(
+      const UndirectedGraph<V, E> &_graph,
+      const std::unordered_map<VertexId, std::size_t> &_labels,
+      const std::size_t _label)
+  {
+    std::vector<Vertex<V>> vertices;
+    std::vector<EdgeInitializer<E>> edges;
+
+    for (auto const &vPair : _graph.Vertices())
+    {
+      auto it = _labels.find(vPair.first);
+      if (it == _labels.end() || it->second != _label)
+        continue;
+
+      const auto &v = vPair.second.get();
+      vertices.push_back(v);
+
+      // Add each edge once, from its first vertex.
+      _graph.ForEachIncidentFrom(v.Id(),
+          [&edges, &v](const UndirectedEdge<E> &_edge)
+      {
+        if (_edge.Vertices().first == v.Id())
+          edges.push_back({_edge.Vertices(), _edge.Data(), _edge.Weight()});
+      });
+    }
+
+    return UndirectedGraph<V, E>(vertices, edges);
+  }
+
+  /// \brief Level synchronous breadth first search of a compressed graph.
+  /// All the vertices of a level are expanded in parallel before moving to
+  /// the next level. Unlike BreadthFirstSort(), the result does not depend
+  /// on the order in which vertices are visited, so it is the same for any
+  /// number of threads.
+  /// \param[in] _graph A compressed graph.
+  /// \param[in] _from The starting vertex.
+  /// \param[in] _threads Maximum number of threads to use. Values of 0 or
+  /// 1 run on the calling thread. Levels with few vertices always run on
+  /// the calling thread.
+  /// \return The number of arcs in the shortest path from _from to every
+  /// vertex, indexed by dense index, or kNullIndex for vertices that are
+  /// not reachable. An empty vector is returned if _from is not in the
+  /// graph.
+  inline std::vector<std::size_t> BreadthFirstLevels(
+      const CompressedGraph &_graph, const VertexId &_from,
+      const unsigned int _threads = 1)
+  {
+    const std::size_t start = _graph.Index(_from);
+    if (start == kNullIndex)
+      return {};
+
+    const std::size_t n = _graph.VertexCount();
+    const auto &offsets = _graph.Offsets();
+    const auto &targets = _graph.Targets();
+
+    std::vector<std::atomic<std::size_t>> levels(n);
+    for (auto &level : levels)
+      level.store(kNullIndex, std::memory_order_relaxed);
+    levels[start].store(0, std::memory_order_relaxed);
+
+    std::vector<std::size_t> frontier = {start};
+    std::vector<std::size_t> next;
+    std::mutex mutex;
+
+    for (std::size_t level = 1; !frontier.empty(); ++level)
+    {
+      next.clear();
+      math::detail::ParallelFor(frontier.size(), _threads,
+          [&](const std::size_t _begin, const std::size_t _end)
+      {
+        std::vector<std::size_t> found;
+        for (std::size_t i = _begin; i < _end; ++i)
+        {
+          const std::size_t u = frontier[i];
+          for (std::size_t a = offsets[u]; a < offsets[u + 1]; ++a)
+          {
+            // Claim the vertex, only one thread succeeds.
+            std::size_t expected = kNullIndex;
+            if (levels[targets[a]].load(std::memory_order_relaxed) ==
+                  kNullIndex &&
+                levels[targets[a]].compare_exchange_strong(expected, level,
+                  std::memory_order_relaxed))
+            {
+              found.push_back(targets[a]);
+            }
+          }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        next.insert(next.end(), found.begin(), found.end());
+      }, 1024);
+      std::swap(frontier, next);
+    }
+
+    std::vector<std::size_t> res(n);
+    for (std::size_t i = 0; i < n; ++i)
+      res[i] = levels[i].load(std::memory_order_relaxed);
+    return res;
+  }
+
   /// \brief Calculate the connected components of an undirected graph.
   /// A connected component of an undirected graph is a subgraph in which any
   /// two vertices are connected to each other by paths, and which is connected
@@ -290,19 +1180,8 @@ namespace graph
   std::vector<UndirectedGraph<V, E>> ConnectedComponents(
     const UndirectedGraph<V, E> &_graph)
   {
-    std::map<VertexId, unsigned int> visited;
-    unsigned int componentCount = 0;
-
-    for (auto const &v : _graph.Vertices())
-    {
-      if (visited.find(v.first) == visited.end())
-      {
-        auto component = BreadthFirstSort(_graph, v.first);
-        for (auto const &vId : component)
-          visited[vId] = componentCount;
-        ++componentCount;
-      }
-    }
+    std::size_t componentCount = 0;
+    auto visited = ConnectedComponentLabels(_graph, 1, &componentCount);
 
     std::vector<UndirectedGraph<V, E>> res(componentCount);
 
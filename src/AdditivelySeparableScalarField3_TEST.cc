@@ -15,8 +15,10 @@
  *
 */
 #include <gtest/gtest.h>
+#include <cmath>
 #include <functional>
 #include <ostream>
+#include <vector>
 
 #include "gz/math/AdditivelySeparableScalarField3.hh"
 #include "gz/math/Polynomial3.hh"
@@ -43,6 +45,72 @@ TEST(AdditivelySeparableScalarField3Test, Evaluate)
   EXPECT_DOUBLE_EQ(scalarField(INF_V), math::INF_D);
 }
 
+/////////////////////////////////////////////////
+TEST(AdditivelySeparableScalarField3Test, EvaluateBatch)
+{
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 3000; ++i)
+  {
+    points.emplace_back(std::sin(i) * 10., std::cos(i * 0.7) * 5.,
+                        (i % 17) - 8.);
+  }
+  points.emplace_back(math::INF_D, 0., 1.);
+  points.emplace_back(-math::INF_D, -math::INF_D, -math::INF_D);
+
+  std::vector<double> x, y, z;
+  for (const math::Vector3d &point : points)
+  {
+    x.push_back(point.X());
+    y.push_back(point.Y());
+    z.push_back(point.Z());
+  }
+
+  // Polynomials are evaluated in blocks, other callables one at a time
+  const math::AdditivelySeparableScalarField3d<math::Polynomial3d>
+      polyField(2.5,
+          math::Polynomial3d(math::Vector4d(0., 1., 0., 0.)),
+          math::Polynomial3d(math::Vector4d(1., 0., -1., 0.)),
+          math::Polynomial3d(math::Vector4d(0., 0., 0.5, 2.)));
+  const math::AdditivelySeparableScalarField3d<std::function<double(double)>>
+      funcField(-1., [](double _v) { return std::sin(_v); },
+          [](double _v) { return _v * _v; },
+          [](double _v) { return 2. * _v; });
+
+  auto check = [&](const auto &_field)
+  {
+    for (const unsigned int threads : {1u, 3u})
+    {
+      std::vector<double> values;
+      _field.Evaluate(points, values, threads);
+      ASSERT_EQ(points.size(), values.size());
+
+      std::vector<double> soaValues(points.size());
+      _field.Evaluate(x.data(), y.data(), z.data(), soaValues.data(),
+          points.size(), threads);
+
+      // Results written over the z coordinates
+      std::vector<double> inPlace = z;
+      _field.Evaluate(x.data(), y.data(), inPlace.data(), inPlace.data(),
+          points.size(), threads);
+
+      for (std::size_t i = 0; i < points.size(); ++i)
+      {
+        const double expected = _field(points[i]);
+        if (std::isnan(expected))
+        {
+          EXPECT_TRUE(std::isnan(values[i])) << i;
+          continue;
+        }
+        EXPECT_DOUBLE_EQ(expected, values[i]) << i;
+        EXPECT_DOUBLE_EQ(expected, soaValues[i]) << i;
+        EXPECT_DOUBLE_EQ(expected, inPlace[i]) << i;
+      }
+    }
+  };
+  check(polyField);
+  check(funcField);
+}
+
 /////////////////////////////////////////////////
 TEST(AdditivelySeparableScalarField3Test, Minimum)
 {
@@ -0,0 +1,628 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include "gz/math/AxisAlignedBoxTree.hh"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "gz/math/detail/ParallelFor.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace
+{
+  /// \brief Maximum number of boxes in a leaf.
+  const std::size_t kLeafSize = 4;
+
+  /// \brief Number of bins used to evaluate the partitions of a node.
+  const std::size_t kBinCount = 16;
+
+  /// \brief Maximum depth of the tree. Deeper nodes are made leaves, which
+  /// also bounds the size of the traversal stacks.
+  const std::size_t kMaxDepth = 64;
+
+  /// \brief Minimum number of rays per thread in batch queries.
+  const std::size_t kRayGrain = 256;
+
+  /// \brief Lowest and highest values, used for empty bounds.
+  const double kLow = std::numeric_limits<double>::lowest();
+  const double kHigh = std::numeric_limits<double>::max();
+
+  /// \brief Ray prepared for the slab tests.
+  struct Ray
+  {
+    /// \brief Origin.
+    Vector3d origin;
+
+    /// \brief Normalized direction.
+    Vector3d dir;
+
+    /// \brief Inverse of each component of the direction, only used when
+    /// the component is not zero.
+    Vector3d inv;
+
+    /// \brief Minimum distance along the ray.
+    double min;
+  };
+
+  //////////////////////////////////////////////////
+  /// \brief Prepare a ray.
+  /// \param[in] _origin Origin.
+  /// \param[in] _dir Direction, normalized here.
+  /// \param[in] _min Minimum distance.
+  /// \return The ray.
+  Ray MakeRay(const Vector3d &_origin, const Vector3d &_dir, double _min)
+  {
+    Ray ray;
+    ray.origin = _origin;
+    ray.dir = _dir.Normalized();
+    for (int i = 0; i < 3; ++i)
+      ray.inv[i] = equal(ray.dir[i], 0.0, 0.0) ? 0.0 : 1.0 / ray.dir[i];
+    ray.min = _min;
+    return ray;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Slab test between a ray and a box.
+  /// \param[in] _ray The ray.
+  /// \param[in] _boxMin Minimum corner of the box.
+  /// \param[in] _boxMax Maximum corner of the box.
+  /// \param[in] _max Maximum distance along the ray.
+  /// \param[out] _enter Distance along the ray where it enters the box,
+  /// clamped to the minimum distance of the ray.
+  /// \return True if the ray hits the box between its minimum distance
+  /// and _max.
+  bool Slab(const Ray &_ray, const Vector3d &_boxMin, const Vector3d &_boxMax,
+            double _max, double &_enter)
+  {
+    double enter = _ray.min;
+    double exit = _max;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (equal(_ray.dir[i], 0.0, 0.0))
+      {
+        // Parallel to the slab, the origin has to be inside of it.
+        if (_ray.origin[i] < _boxMin[i] || _ray.origin[i] > _boxMax[i])
+          return false;
+        continue;
+      }
+
+      double near = (_boxMin[i] - _ray.origin[i]) * _ray.inv[i];
+      double far = (_boxMax[i] - _ray.origin[i]) * _ray.inv[i];
+      if (near > far)
+        std::swap(near, far);
+      enter = std::max(enter, near);
+      exit = std::min(exit, far);
+      if (enter > exit)
+        return false;
+    }
+    _enter = enter;
+    return true;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Whether two boxes overlap, with the same comparisons as
+  /// AxisAlignedBox::Intersects().
+  bool Overlap(const Vector3d &_min1, const Vector3d &_max1,
+               const Vector3d &_min2, const Vector3d &_max2)
+  {
+    return !(_max1.X() < _min2.X() || _max1.Y() < _min2.Y() ||
+             _max1.Z() < _min2.Z() || _min1.X() > _max2.X() ||
+             _min1.Y() > _max2.Y() || _min1.Z() > _max2.Z());
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Half of the surface area of a box.
+  /// \param[in] _min Minimum corner.
+  /// \param[in] _max Maximum corner.
+  /// \return The half area, or 0 if the box is empty.
+  double HalfArea(const Vector3d &_min, const Vector3d &_max)
+  {
+    const Vector3d d = _max - _min;
+    if (d.X() < 0 || d.Y() < 0 || d.Z() < 0)
+      return 0;
+    return d.X() * d.Y() + d.Y() * d.Z() + d.Z() * d.X();
+  }
+
+  /// \brief Bounds and number of boxes of a bin.
+  struct Bin
+  {
+    /// \brief Minimum corner.
+    Vector3d min{kHigh, kHigh, kHigh};
+
+    /// \brief Maximum corner.
+    Vector3d max{kLow, kLow, kLow};
+
+    /// \brief Number of boxes.
+    std::size_t count = 0;
+  };
+}
+
+/// \brief Private AxisAlignedBoxTree data class.
+class gz::math::AxisAlignedBoxTreePrivate
+{
+  /// \brief Node of the tree.
+  public: struct Node
+  {
+    /// \brief Minimum corner of the bounds.
+    Vector3d min;
+
+    /// \brief Maximum corner of the bounds.
+    Vector3d max;
+
+    /// \brief For a leaf, the first box slot. For an internal node, the
+    /// index of the first child, the second one follows it.
+    std::size_t first = 0;
+
+    /// \brief Number of boxes in a leaf, or 0 for an internal node.
+    std::size_t count = 0;
+  };
+
+  /// \brief Find the closest hit.
+  /// \param[in] _ray The ray.
+  /// \param[in] _max Maximum distance along the ray.
+  /// \param[out] _dist Distance along the ray of the hit.
+  /// \return Index of the box, or NoBox.
+  public: std::size_t ClosestHit(const Ray &_ray, double _max,
+                                 double &_dist) const;
+
+  /// \brief Recompute the bounds of the nodes from the boxes, children
+  /// first.
+  public: void UpdateNodes();
+
+  /// \brief The nodes. The root is the first one, and children are always
+  /// stored after their parent.
+  public: std::vector<Node> nodes;
+
+  /// \brief Index in the input of the box in each slot. Leaves own
+  /// contiguous ranges of slots.
+  public: std::vector<std::size_t> indices;
+
+  /// \brief Minimum corner of the box in each slot.
+  public: std::vector<Vector3d> boxMin;
+
+  /// \brief Maximum corner of the box in each slot.
+  public: std::vector<Vector3d> boxMax;
+};
+
+//////////////////////////////////////////////////
+std::size_t AxisAlignedBoxTreePrivate::ClosestHit(const Ray &_ray,
+    double _max, double &_dist) const
+{
+  std::size_t best = AxisAlignedBoxTree::NoBox;
+  double bestDist = _max;
+
+  double enter;
+  if (this->nodes.empty() ||
+      !Slab(_ray, this->nodes[0].min, this->nodes[0].max, bestDist, enter))
+  {
+    return best;
+  }
+
+  // Each entry is a node and the distance where the ray enters it.
+  std::array<std::pair<std::size_t, double>, 2 * kMaxDepth + 2> stack;
+  std::size_t size = 0;
+  stack[size++] = {0, enter};
+
+  while (size > 0)
+  {
+    const auto entry = stack[--size];
+    if (entry.second > bestDist)
+      continue;
+
+    const Node &node = this->nodes[entry.first];
+    if (node.count > 0)
+    {
+      for (std::size_t s = node.first; s < node.first + node.count; ++s)
+      {
+        const Vector3d &bMin = this->boxMin[s];
+        const Vector3d &bMax = this->boxMax[s];
+        if (bMin.X() > bMax.X() || bMin.Y() > bMax.Y() || bMin.Z() > bMax.Z())
+          continue;
+
+        // Ties go to the lowest index, like a linear search would do.
+        if (Slab(_ray, bMin, bMax, bestDist, enter) &&
+            (enter < bestDist || this->indices[s] < best))
+        {
+          bestDist = enter;
+          best = this->indices[s];
+        }
+      }
+      continue;
+    }
+
+    // Visit the closest child first.
+    const Node &left = this->nodes[node.first];
+    const Node &right = this->nodes[node.first + 1];
+    double leftEnter, rightEnter;
+    const bool hitLeft = Slab(_ray, left.min, left.max, bestDist, leftEnter);
+    const bool hitRight =
+      Slab(_ray, right.min, right.max, bestDist, rightEnter);
+    if (hitLeft && hitRight)
+    {
+      if (leftEnter <= rightEnter)
+      {
+        stack[size++] = {node.first + 1, rightEnter};
+        stack[size++] = {node.first, leftEnter};
+      }
+      else
+      {
+        stack[size++] = {node.first, leftEnter};
+        stack[size++] = {node.first + 1, rightEnter};
+      }
+    }
+    else if (hitLeft)
+    {
+      stack[size++] = {node.first, leftEnter};
+    }
+    else if (hitRight)
+    {
+      stack[size++] = {node.first + 1, rightEnter};
+    }
+  }
+
+  _dist = bestDist;
+  return best;
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTreePrivate::UpdateNodes()
+{
+  for (std::size_t i = this->nodes.size(); i-- > 0;)
+  {
+    Node &node = this->nodes[i];
+    node.min.Set(kHigh, kHigh, kHigh);
+    node.max.Set(kLow, kLow, kLow);
+    if (node.count > 0)
+    {
+      for (std::size_t s = node.first; s < node.first + node.count; ++s)
+      {
+        // Invalid boxes don't contribute to the bounds.
+        const Vector3d &bMin = this->boxMin[s];
+        const Vector3d &bMax = this->boxMax[s];
+        if (bMin.X() > bMax.X() || bMin.Y() > bMax.Y() || bMin.Z() > bMax.Z())
+          continue;
+        node.min.Min(bMin);
+        node.max.Max(bMax);
+      }
+    }
+    else
+    {
+      for (std::size_t c = node.first; c < node.first + 2; ++c)
+      {
+        node.min.Min(this->nodes[c].min);
+        node.max.Max(this->nodes[c].max);
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::AxisAlignedBoxTree()
+  : dataPtr(std::make_unique<AxisAlignedBoxTreePrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::AxisAlignedBoxTree(
+    const std::vector<AxisAlignedBox> &_boxes)
+  : AxisAlignedBoxTree()
+{
+  this->Build(_boxes);
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::AxisAlignedBoxTree(AxisAlignedBoxTree &&_tree) noexcept
+  = default;
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree::~AxisAlignedBoxTree() = default;
+
+//////////////////////////////////////////////////
+AxisAlignedBoxTree &AxisAlignedBoxTree::operator=(
+    AxisAlignedBoxTree &&_tree) noexcept = default;
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Build(const AxisAlignedBox *_boxes,
+    std::size_t _count)
+{
+  auto &d = *this->dataPtr;
+  d.nodes.clear();
+  d.indices.resize(_count);
+  d.boxMin.resize(_count);
+  d.boxMax.resize(_count);
+  if (_count == 0)
+    return;
+
+  std::vector<Vector3d> centroids(_count);
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    d.indices[i] = i;
+    centroids[i] = (_boxes[i].Min() + _boxes[i].Max()) * 0.5;
+  }
+
+  // A binary tree with at least one box per leaf has less than 2 * _count
+  // nodes.
+  d.nodes.reserve(2 * _count);
+  d.nodes.emplace_back();
+
+  // Nodes waiting to be split, with their depth.
+  std::vector<std::pair<std::size_t, std::size_t>> work;
+  d.nodes[0].count = _count;
+  work.emplace_back(0, 0);
+
+  std::array<Bin, kBinCount> bins;
+  std::array<double, kBinCount> rightCost;
+  while (!work.empty())
+  {
+    const std::size_t nodeIndex = work.back().first;
+    const std::size_t depth = work.back().second;
+    work.pop_back();
+
+    const std::size_t first = d.nodes[nodeIndex].first;
+    const std::size_t count = d.nodes[nodeIndex].count;
+    if (count <= kLeafSize || depth >= kMaxDepth)
+      continue;
+
+    // Bounds of the centroids, the bins split them evenly.
+    Vector3d cMin(kHigh, kHigh, kHigh);
+    Vector3d cMax(kLow, kLow, kLow);
+    for (std::size_t s = first; s < first + count; ++s)
+    {
+      cMin.Min(centroids[d.indices[s]]);
+      cMax.Max(centroids[d.indices[s]]);
+    }
+
+    // Pick the partition with the lowest surface area heuristic cost over
+    // all axes. The cost is the sum of the area of each side multiplied by
+    // its number of boxes.
+    double bestCost = std::numeric_limits<double>::infinity();
+    int bestAxis = -1;
+    std::size_t bestBin = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double extent = cMax[axis] - cMin[axis];
+      if (!(extent > 0) || !std::isfinite(extent))
+        continue;
+      const double scale = kBinCount / extent;
+
+      bins.fill(Bin());
+      for (std::size_t s = first; s < first + count; ++s)
+      {
+        const std::size_t i = d.indices[s];
+        const std::size_t b = std::min(kBinCount - 1, static_cast<std::size_t>(
+              (centroids[i][axis] - cMin[axis]) * scale));
+        bins[b].min.Min(_boxes[i].Min());
+        bins[b].max.Max(_boxes[i].Max());
+        ++bins[b].count;
+      }
+
+      // Sweep from the right to get the cost of each right side, then from
+      // the left to evaluate every partition.
+      Bin side;
+      for (std::size_t b = kBinCount - 1; b > 0; --b)
+      {
+        side.min.Min(bins[b].min);
+        side.max.Max(bins[b].max);
+        side.count += bins[b].count;
+        rightCost[b] = side.count > 0 ?
+          HalfArea(side.min, side.max) * side.count : 0;
+      }
+
+      side = Bin();
+      for (std::size_t b = 0; b + 1 < kBinCount; ++b)
+      {
+        side.min.Min(bins[b].min);
+        side.max.Max(bins[b].max);
+        side.count += bins[b].count;
+        if (side.count == 0 || side.count == count)
+          continue;
+
+        const double cost =
+          HalfArea(side.min, side.max) * side.count + rightCost[b + 1];
+        if (cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = b;
+        }
+      }
+    }
+
+    auto begin = d.indices.begin() + first;
+    auto end = begin + count;
+    std::size_t leftCount;
+    if (bestAxis >= 0)
+    {
+      const double scale = kBinCount / (cMax[bestAxis] - cMin[bestAxis]);
+      const double low = cMin[bestAxis];
+      auto mid = std::partition(begin, end, [&](std::size_t _i)
+      {
+        return std::min(kBinCount - 1, static_cast<std::size_t>(
+              (centroids[_i][bestAxis] - low) * scale)) <= bestBin;
+      });
+      leftCount = static_cast<std::size_t>(mid - begin);
+    }
+    else
+    {
+      // All the centroids are at the same position, any split is as good.
+      leftCount = count / 2;
+    }
+
+    const std::size_t left = d.nodes.size();
+    d.nodes[nodeIndex].first = left;
+    d.nodes[nodeIndex].count = 0;
+    d.nodes.emplace_back();
+    d.nodes.back().first = first;
+    d.nodes.back().count = leftCount;
+    d.nodes.emplace_back();
+    d.nodes.back().first = first + leftCount;
+    d.nodes.back().count = count - leftCount;
+    work.emplace_back(left, depth + 1);
+    work.emplace_back(left + 1, depth + 1);
+  }
+
+  for (std::size_t s = 0; s < _count; ++s)
+  {
+    d.boxMin[s] = _boxes[d.indices[s]].Min();
+    d.boxMax[s] = _boxes[d.indices[s]].Max();
+  }
+  d.UpdateNodes();
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Build(const std::vector<AxisAlignedBox> &_boxes)
+{
+  this->Build(_boxes.data(), _boxes.size());
+}
+
+//////////////////////////////////////////////////
+bool AxisAlignedBoxTree::Refit(const AxisAlignedBox *_boxes,
+    std::size_t _count)
+{
+  auto &d = *this->dataPtr;
+  if (_count != d.indices.size())
+    return false;
+
+  for (std::size_t s = 0; s < _count; ++s)
+  {
+    d.boxMin[s] = _boxes[d.indices[s]].Min();
+    d.boxMax[s] = _boxes[d.indices[s]].Max();
+  }
+  d.UpdateNodes();
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool AxisAlignedBoxTree::Refit(const std::vector<AxisAlignedBox> &_boxes)
+{
+  return this->Refit(_boxes.data(), _boxes.size());
+}
+
+//////////////////////////////////////////////////
+std::size_t AxisAlignedBoxTree::Size() const
+{
+  return this->dataPtr->indices.size();
+}
+
+//////////////////////////////////////////////////
+std::size_t AxisAlignedBoxTree::NodeCount() const
+{
+  return this->dataPtr->nodes.size();
+}
+
+//////////////////////////////////////////////////
+AxisAlignedBox AxisAlignedBoxTree::Bounds() const
+{
+  const auto &nodes = this->dataPtr->nodes;
+  AxisAlignedBox result;
+  if (!nodes.empty() && nodes[0].min.X() <= nodes[0].max.X())
+  {
+    result.Min() = nodes[0].min;
+    result.Max() = nodes[0].max;
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::tuple<bool, double, std::size_t> AxisAlignedBoxTree::Intersect(
+    const Vector3d &_origin, const Vector3d &_dir,
+    const double _min, const double _max) const
+{
+  double dist = 0;
+  const std::size_t index = this->dataPtr->ClosestHit(
+      MakeRay(_origin, _dir, _min), _max, dist);
+  if (index == NoBox)
+    return std::make_tuple(false, 0, NoBox);
+  return std::make_tuple(true, dist - _min, index);
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Intersect(const Vector3d *_origins,
+    const Vector3d *_dirs, std::size_t _count,
+    const double _min, const double _max,
+    std::size_t *_indices, double *_distances,
+    unsigned int _threads) const
+{
+  const auto &d = *this->dataPtr;
+  detail::ParallelFor(_count, _threads,
+    [&](std::size_t _begin, std::size_t _end)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        double dist = 0;
+        _indices[i] = d.ClosestHit(MakeRay(_origins[i], _dirs[i], _min),
+            _max, dist);
+        if (_distances)
+        {
+          _distances[i] = _indices[i] == NoBox ?
+            std::numeric_limits<double>::infinity() : dist - _min;
+        }
+      }
+    }, kRayGrain);
+}
+
+//////////////////////////////////////////////////
+void AxisAlignedBoxTree::Overlaps(const AxisAlignedBox &_box,
+    std::vector<std::size_t> &_indices) const
+{
+  _indices.clear();
+
+  const auto &d = *this->dataPtr;
+  if (d.nodes.empty())
+    return;
+
+  const Vector3d &qMin = _box.Min();
+  const Vector3d &qMax = _box.Max();
+
+  std::array<std::size_t, 2 * kMaxDepth + 2> stack;
+  std::size_t size = 0;
+  stack[size++] = 0;
+  while (size > 0)
+  {
+    const auto &node = d.nodes[stack[--size]];
+    if (!Overlap(node.min, node.max, qMin, qMax))
+      continue;
+
+    if (node.count == 0)
+    {
+      stack[size++] = node.first;
+      stack[size++] = node.first + 1;
+      continue;
+    }
+
+    for (std::size_t s = node.first; s < node.first + node.count; ++s)
+    {
+      if (Overlap(d.boxMin[s], d.boxMax[s], qMin, qMax))
+        _indices.push_back(d.indices[s]);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+std::vector<std::size_t> AxisAlignedBoxTree::Overlaps(
+    const AxisAlignedBox &_box) const
+{
+  std::vector<std::size_t> result;
+  this->Overlaps(_box, result);
+  return result;
+}
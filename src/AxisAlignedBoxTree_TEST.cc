@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "gz/math/AxisAlignedBoxTree.hh"
+
+using namespace gz;
+using namespace math;
+
+/////////////////////////////////////////////////
+/// \brief Generate random boxes in a 100 m cube.
+/// \param[in] _count Number of boxes.
+/// \param[in] _gen Random generator.
+std::vector<AxisAlignedBox> RandomBoxes(std::size_t _count,
+    std::mt19937 &_gen)
+{
+  std::uniform_real_distribution<double> pos(-50.0, 50.0);
+  std::uniform_real_distribution<double> size(0.1, 4.0);
+
+  std::vector<AxisAlignedBox> boxes;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d min(pos(_gen), pos(_gen), pos(_gen));
+    boxes.emplace_back(min, min + Vector3d(size(_gen), size(_gen), size(_gen)));
+  }
+  return boxes;
+}
+
+/////////////////////////////////////////////////
+/// \brief Closest hit found by testing every box.
+std::tuple<bool, double, std::size_t> BruteForceIntersect(
+    const std::vector<AxisAlignedBox> &_boxes, const Vector3d &_origin,
+    const Vector3d &_dir, double _min, double _max)
+{
+  auto result = std::make_tuple(false, 0.0, AxisAlignedBoxTree::NoBox);
+  for (std::size_t i = 0; i < _boxes.size(); ++i)
+  {
+    auto hit = _boxes[i].Intersect(_origin, _dir, _min, _max);
+    if (std::get<0>(hit) &&
+        (!std::get<0>(result) || std::get<1>(hit) < std::get<1>(result)))
+    {
+      result = std::make_tuple(true, std::get<1>(hit), i);
+    }
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Boxes intersecting a box found by testing every box, sorted.
+std::vector<std::size_t> BruteForceOverlaps(
+    const std::vector<AxisAlignedBox> &_boxes, const AxisAlignedBox &_box)
+{
+  std::vector<std::size_t> result;
+  for (std::size_t i = 0; i < _boxes.size(); ++i)
+  {
+    if (_boxes[i].Intersects(_box))
+      result.push_back(i);
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that the tree gives the same results as a brute force
+/// search.
+void ExpectBruteForce(const AxisAlignedBoxTree &_tree,
+    const std::vector<AxisAlignedBox> &_boxes, std::mt19937 &_gen)
+{
+  std::uniform_real_distribution<double> pos(-60.0, 60.0);
+  std::uniform_real_distribution<double> dir(-1.0, 1.0);
+
+  for (int i = 0; i < 200; ++i)
+  {
+    const Vector3d origin(pos(_gen), pos(_gen), pos(_gen));
+    const Vector3d d(dir(_gen), dir(_gen), dir(_gen));
+
+    auto expected = BruteForceIntersect(_boxes, origin, d, 1.0, 80.0);
+    auto hit = _tree.Intersect(origin, d, 1.0, 80.0);
+    ASSERT_EQ(std::get<0>(expected), std::get<0>(hit));
+    if (!std::get<0>(hit))
+    {
+      EXPECT_EQ(AxisAlignedBoxTree::NoBox, std::get<2>(hit));
+      continue;
+    }
+    EXPECT_NEAR(std::get<1>(expected), std::get<1>(hit), 1e-9);
+
+    // Boxes at the same distance are equally valid answers.
+    ASSERT_LT(std::get<2>(hit), _boxes.size());
+    auto boxHit =
+      _boxes[std::get<2>(hit)].Intersect(origin, d, 1.0, 80.0);
+    EXPECT_TRUE(std::get<0>(boxHit));
+    EXPECT_NEAR(std::get<1>(expected), std::get<1>(boxHit), 1e-9);
+  }
+
+  std::vector<std::size_t> indices;
+  for (int i = 0; i < 100; ++i)
+  {
+    const Vector3d p(pos(_gen), pos(_gen), pos(_gen));
+    const AxisAlignedBox query(p, p + Vector3d(5, 10, 15) * (i % 3));
+
+    _tree.Overlaps(query, indices);
+    std::sort(indices.begin(), indices.end());
+    EXPECT_EQ(BruteForceOverlaps(_boxes, query), indices);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Empty)
+{
+  AxisAlignedBoxTree tree;
+  EXPECT_EQ(0u, tree.Size());
+  EXPECT_EQ(0u, tree.NodeCount());
+  EXPECT_FALSE(tree.Bounds().Intersects(tree.Bounds()));
+
+  auto hit = tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 0, 10);
+  EXPECT_FALSE(std::get<0>(hit));
+  EXPECT_EQ(AxisAlignedBoxTree::NoBox, std::get<2>(hit));
+  EXPECT_TRUE(tree.Overlaps(AxisAlignedBox(-Vector3d::One,
+          Vector3d::One)).empty());
+
+  EXPECT_TRUE(tree.Refit(std::vector<AxisAlignedBox>()));
+  EXPECT_FALSE(tree.Refit({AxisAlignedBox()}));
+
+  // Building with no boxes clears the tree.
+  tree.Build({AxisAlignedBox(Vector3d::Zero, Vector3d::One)});
+  EXPECT_EQ(1u, tree.Size());
+  tree.Build(std::vector<AxisAlignedBox>());
+  EXPECT_EQ(0u, tree.Size());
+  EXPECT_EQ(0u, tree.NodeCount());
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Simple)
+{
+  std::vector<AxisAlignedBox> boxes =
+  {
+    AxisAlignedBox(Vector3d(2, -1, -1), Vector3d(3, 1, 1)),
+    AxisAlignedBox(Vector3d(5, -1, -1), Vector3d(6, 1, 1)),
+    AxisAlignedBox(Vector3d(-3, -1, -1), Vector3d(-2, 1, 1)),
+  };
+  AxisAlignedBoxTree tree(boxes);
+  EXPECT_EQ(3u, tree.Size());
+  EXPECT_EQ(Vector3d(-3, -1, -1), tree.Bounds().Min());
+  EXPECT_EQ(Vector3d(6, 1, 1), tree.Bounds().Max());
+
+  auto hit = tree.Intersect(Vector3d::Zero, Vector3d(2, 0, 0), 0, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_DOUBLE_EQ(2.0, std::get<1>(hit));
+  EXPECT_EQ(0u, std::get<2>(hit));
+
+  // The distance is measured from the minimum distance along the ray.
+  hit = tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 4, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_DOUBLE_EQ(1.0, std::get<1>(hit));
+  EXPECT_EQ(1u, std::get<2>(hit));
+
+  // Starting inside of a box.
+  hit = tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 2.5, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_DOUBLE_EQ(0.0, std::get<1>(hit));
+  EXPECT_EQ(0u, std::get<2>(hit));
+
+  hit = tree.Intersect(Vector3d::Zero, -Vector3d::UnitX, 0, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_EQ(2u, std::get<2>(hit));
+
+  // Too short, and parallel to the boxes.
+  EXPECT_FALSE(std::get<0>(
+        tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 0, 1.5)));
+  EXPECT_FALSE(std::get<0>(
+        tree.Intersect(Vector3d(0, 2, 0), Vector3d::UnitX, 0, 10)));
+
+  EXPECT_EQ((std::vector<std::size_t>{1}), tree.Overlaps(
+        AxisAlignedBox(Vector3d(4, 0, 0), Vector3d(5, 2, 2))));
+  EXPECT_TRUE(tree.Overlaps(
+        AxisAlignedBox(Vector3d(0, 0, 0), Vector3d(1, 2, 2))).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, InvalidBoxes)
+{
+  std::vector<AxisAlignedBox> boxes =
+  {
+    AxisAlignedBox(),
+    AxisAlignedBox(Vector3d(2, -1, -1), Vector3d(3, 1, 1)),
+    AxisAlignedBox(),
+  };
+  AxisAlignedBoxTree tree(boxes);
+  EXPECT_EQ(Vector3d(2, -1, -1), tree.Bounds().Min());
+
+  auto hit = tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 0, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_EQ(1u, std::get<2>(hit));
+  EXPECT_FALSE(std::get<0>(
+        tree.Intersect(Vector3d::Zero, -Vector3d::UnitX, 0, 10)));
+  EXPECT_EQ((std::vector<std::size_t>{1}), tree.Overlaps(
+        AxisAlignedBox(Vector3d(-10, -10, -10), Vector3d(10, 10, 10))));
+
+  // Only invalid boxes.
+  tree.Build({AxisAlignedBox(), AxisAlignedBox()});
+  EXPECT_EQ(2u, tree.Size());
+  EXPECT_FALSE(std::get<0>(
+        tree.Intersect(Vector3d::Zero, Vector3d::UnitX, 0, 10)));
+  EXPECT_FALSE(tree.Bounds().Intersects(tree.Bounds()));
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, BruteForce)
+{
+  std::mt19937 gen(12345u);
+  for (std::size_t count : {1u, 5u, 100u, 2000u})
+  {
+    auto boxes = RandomBoxes(count, gen);
+    AxisAlignedBoxTree tree(boxes);
+    EXPECT_EQ(count, tree.Size());
+    EXPECT_LT(tree.NodeCount(), 2 * count);
+    ExpectBruteForce(tree, boxes, gen);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Coincident)
+{
+  // All the boxes are the same, which can't be split by the heuristic.
+  std::vector<AxisAlignedBox> boxes(100,
+      AxisAlignedBox(Vector3d(1, 1, 1), Vector3d(2, 2, 2)));
+  AxisAlignedBoxTree tree(boxes);
+  EXPECT_EQ(100u, tree.Overlaps(boxes[0]).size());
+
+  auto hit = tree.Intersect(Vector3d::Zero, Vector3d::One, 0, 10);
+  EXPECT_TRUE(std::get<0>(hit));
+  EXPECT_NEAR(std::sqrt(3.0), std::get<1>(hit), 1e-12);
+
+  // Ties go to the lowest index.
+  EXPECT_EQ(0u, std::get<2>(hit));
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Refit)
+{
+  std::mt19937 gen(54321u);
+  auto boxes = RandomBoxes(500, gen);
+  AxisAlignedBoxTree tree(boxes);
+  const std::size_t nodes = tree.NodeCount();
+
+  // Move every box, the structure is kept and the queries are still exact.
+  std::uniform_real_distribution<double> offset(-20.0, 20.0);
+  for (auto &box : boxes)
+  {
+    const Vector3d v(offset(gen), offset(gen), offset(gen));
+    box = AxisAlignedBox(box.Min() + v, box.Max() + v);
+  }
+  EXPECT_TRUE(tree.Refit(boxes));
+  EXPECT_EQ(nodes, tree.NodeCount());
+  ExpectBruteForce(tree, boxes, gen);
+
+  boxes.pop_back();
+  EXPECT_FALSE(tree.Refit(boxes));
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Batch)
+{
+  std::mt19937 gen(777u);
+  auto boxes = RandomBoxes(1000, gen);
+  AxisAlignedBoxTree tree(boxes);
+
+  std::uniform_real_distribution<double> pos(-60.0, 60.0);
+  std::uniform_real_distribution<double> dir(-1.0, 1.0);
+  std::vector<Vector3d> origins, dirs;
+  for (int i = 0; i < 1000; ++i)
+  {
+    origins.emplace_back(pos(gen), pos(gen), pos(gen));
+    dirs.emplace_back(dir(gen), dir(gen), dir(gen));
+  }
+
+  for (unsigned int threads : {1u, 4u})
+  {
+    std::vector<std::size_t> indices(origins.size());
+    std::vector<double> distances(origins.size());
+    tree.Intersect(origins.data(), dirs.data(), origins.size(), 0.5, 50.0,
+        indices.data(), distances.data(), threads);
+
+    for (std::size_t i = 0; i < origins.size(); ++i)
+    {
+      auto hit = tree.Intersect(origins[i], dirs[i], 0.5, 50.0);
+      EXPECT_EQ(std::get<2>(hit), indices[i]);
+      if (std::get<0>(hit))
+        EXPECT_DOUBLE_EQ(std::get<1>(hit), distances[i]);
+      else
+        EXPECT_TRUE(std::isinf(distances[i]));
+    }
+  }
+
+  // The distances are optional.
+  std::vector<std::size_t> indices(origins.size());
+  tree.Intersect(origins.data(), dirs.data(), origins.size(), 0.5, 50.0,
+      indices.data());
+  EXPECT_EQ(std::get<2>(tree.Intersect(origins[0], dirs[0], 0.5, 50.0)),
+      indices[0]);
+}
+
+/////////////////////////////////////////////////
+TEST(AxisAlignedBoxTreeTest, Move)
+{
+  AxisAlignedBoxTree tree(
+      {AxisAlignedBox(Vector3d(2, -1, -1), Vector3d(3, 1, 1))});
+  AxisAlignedBoxTree moved(std::move(tree));
+  EXPECT_EQ(1u, moved.Size());
+
+  AxisAlignedBoxTree assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(1u, assigned.Size());
+  EXPECT_TRUE(std::get<0>(
+        assigned.Intersect(Vector3d::Zero, Vector3d::UnitX, 0, 10)));
+}
@@ -15,15 +15,142 @@
  *
 */
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 #include "gz/math/AxisAlignedBox.hh"
 #include "gz/math/Frustum.hh"
 #include "gz/math/Matrix4.hh"
+#include "FrustumCullerPrivate.hh"
 #include "FrustumPrivate.hh"
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+  /////////////////////////////////////////////////
+  /// \brief Compute the corners, edges and planes of a frustum.
+  /// \param[in] _data The frustum properties.
+  /// \return The snapshot data.
+  std::shared_ptr<FrustumCullerPrivate> ComputePlanes(
+      const FrustumPrivate &_data)
+  {
+    auto data = std::make_shared<FrustumCullerPrivate>();
+
+    // Tangent of half the field of view.
+    double tanFOV2 = std::tan(_data.fov() * 0.5);
+
+    // Width of near plane
+    double nearWidth = 2.0 * tanFOV2 * _data.near;
+
+    // Height of near plane
+    double nearHeight = nearWidth / _data.aspectRatio;
+
+    // Width of far plane
+    double farWidth = 2.0 * tanFOV2 * _data.far;
+
+    // Height of far plane
+    double farHeight = farWidth / _data.aspectRatio;
+
+    // Up, right, and forward unit vectors.
+    Vector3d forward = _data.pose.Rot().RotateVector(Vector3d::UnitX);
+    Vector3d up = _data.pose.Rot().RotateVector(Vector3d::UnitZ);
+    Vector3d right = _data.pose.Rot().RotateVector(-Vector3d::UnitY);
+
+    // Near plane center
+    Vector3d nearCenter = _data.pose.Pos() + forward *
+      _data.near;
+
+    // Far plane center
+    Vector3d farCenter = _data.pose.Pos() + forward *
+      _data.far;
+
+    // These four variables are here for convenience.
+    Vector3d upNearHeight2 = up * (nearHeight * 0.5);
+    Vector3d rightNearWidth2 = right * (nearWidth * 0.5);
+    Vector3d upFarHeight2 = up * (farHeight * 0.5);
+    Vector3d rightFarWidth2 = right * (farWidth * 0.5);
+
+    // Compute the vertices of the near plane
+    Vector3d nearTopLeft = nearCenter + upNearHeight2 - rightNearWidth2;
+    Vector3d nearTopRight = nearCenter + upNearHeight2 + rightNearWidth2;
+    Vector3d nearBottomLeft = nearCenter - upNearHeight2 - rightNearWidth2;
+    Vector3d nearBottomRight = nearCenter - upNearHeight2 + rightNearWidth2;
+
+    // Compute the vertices of the far plane
+    Vector3d farTopLeft = farCenter + upFarHeight2 - rightFarWidth2;
+    Vector3d farTopRight = farCenter + upFarHeight2 + rightFarWidth2;
+    Vector3d farBottomLeft = farCenter - upFarHeight2 - rightFarWidth2;
+    Vector3d farBottomRight = farCenter - upFarHeight2 + rightFarWidth2;
+
+    // Save these vertices
+    data->points[0] = nearTopLeft;
+    data->points[1] = nearTopRight;
+    data->points[2] = nearBottomLeft;
+    data->points[3] = nearBottomRight;
+    data->points[4] = farTopLeft;
+    data->points[5] = farTopRight;
+    data->points[6] = farBottomLeft;
+    data->points[7] = farBottomRight;
+
+    // Save the edges
+    data->edges[0] = {nearTopLeft, nearTopRight};
+    data->edges[1] = {nearTopLeft, nearBottomLeft};
+    data->edges[2] = {nearTopLeft, farTopLeft};
+    data->edges[3] = {nearTopRight, nearBottomRight};
+    data->edges[4] = {nearTopRight, farTopRight};
+    data->edges[5] = {nearBottomLeft, nearBottomRight};
+    data->edges[6] = {nearBottomLeft, farBottomLeft};
+    data->edges[7] = {farTopLeft, farTopRight};
+    data->edges[8] = {farTopLeft, farBottomLeft};
+    data->edges[9] = {farTopRight, farBottomRight};
+    data->edges[10] = {farBottomLeft, farBottomRight};
+    data->edges[11] = {farBottomRight, nearBottomRight};
+
+    Vector3d leftCenter =
+      (farTopLeft + nearTopLeft + farBottomLeft + nearBottomLeft) / 4.0;
+
+    Vector3d rightCenter =
+      (farTopRight + nearTopRight + farBottomRight + nearBottomRight) / 4.0;
+
+    Vector3d topCenter =
+      (farTopRight + nearTopRight + farTopLeft + nearTopLeft) / 4.0;
+
+    Vector3d bottomCenter =
+      (farBottomRight + nearBottomRight + farBottomLeft + nearBottomLeft) / 4.0;
+
+    // Compute plane offsets
+    // Set the planes, where the first value is the plane normal and the
+    // second the plane offset
+    Vector3d norm =
+      Vector3d::Normal(nearTopLeft, nearTopRight, nearBottomLeft);
+    data->planes[Frustum::FRUSTUM_PLANE_NEAR].Set(norm, nearCenter.Dot(norm));
+
+    norm = Vector3d::Normal(farTopRight, farTopLeft, farBottomLeft);
+    data->planes[Frustum::FRUSTUM_PLANE_FAR].Set(norm, farCenter.Dot(norm));
+
+    norm = Vector3d::Normal(farTopLeft, nearTopLeft, nearBottomLeft);
+    data->planes[Frustum::FRUSTUM_PLANE_LEFT].Set(norm, leftCenter.Dot(norm));
+
+    norm = Vector3d::Normal(nearTopRight, farTopRight, farBottomRight);
+    data->planes[Frustum::FRUSTUM_PLANE_RIGHT].Set(norm,
+        rightCenter.Dot(norm));
+
+    norm = Vector3d::Normal(nearTopLeft, farTopLeft, nearTopRight);
+    data->planes[Frustum::FRUSTUM_PLANE_TOP].Set(norm, topCenter.Dot(norm));
+
+    norm = Vector3d::Normal(nearBottomLeft, nearBottomRight, farBottomRight);
+    data->planes[Frustum::FRUSTUM_PLANE_BOTTOM].Set(norm,
+        bottomCenter.Dot(norm));
+
+    data->Pack();
+    return data;
+  }
+}
+
 /////////////////////////////////////////////////
 Frustum::Frustum()
   : dataPtr(new FrustumPrivate(0, 1, IGN_DTOR(45), 1, Pose3d::Zero))
@@ -39,8 +166,8 @@ Frustum::Frustum(const double _near,
   : dataPtr(new FrustumPrivate(_near, _far, _fov, _aspectRatio, _pose))
 {
   // Compute plane based on near distance, far distance, field of view,
-  // aspect ratio, and pose
-  this->ComputePlanes();
+  // aspect ratio, and pose, when they are first needed.
+  this->dataPtr->dirty = true;
 }
 
 /////////////////////////////////////////////////
@@ -55,112 +182,46 @@ Frustum::Frustum(const Frustum &_p)
   : dataPtr(new FrustumPrivate(_p.Near(), _p.Far(), _p.FOV(),
         _p.AspectRatio(), _p.Pose()))
 {
-  for (int i = 0; i < 6; ++i)
-    this->dataPtr->planes[i] = _p.dataPtr->planes[i];
+  this->dataPtr->culler = _p.Culler();
 }
 
 /////////////////////////////////////////////////
 Planed Frustum::Plane(const FrustumPlane _plane) const
 {
-  return this->dataPtr->planes[_plane];
+  this->Update();
+  return this->dataPtr->culler.dataPtr->planes[_plane];
 }
 
 /////////////////////////////////////////////////
 bool Frustum::Contains(const AxisAlignedBox &_b) const
 {
-  // This is a fast test used for culling.
-  // If the box is on the negative side of a plane, then the box is not
-  // visible.
-  int overlapping = 0;
-  for (auto const &plane : this->dataPtr->planes)
-  {
-    auto const sign = plane.Side(_b);
-    if (sign == Planed::NEGATIVE_SIDE)
-      return false;
-    else if (sign == Planed::BOTH_SIDE)
-      ++overlapping;
-  }
-
-  // it is possible to be outside of frustum and overlapping multiple planes
-  if (overlapping >= 2)
-  {
-    // return true if any box point is inside the frustum
-    auto const &min = _b.Min();
-    auto const &max = _b.Max();
-    for (int p = 0; p < 8; ++p)
-    {
-      const double &x = (p & 4) ? min.X() : max.X();
-      const double &y = (p & 2) ? min.Y() : max.Y();
-      const double &z = (p & 1) ? min.Z() : max.Z();
-      if (this->Contains(Vector3d(x, y, z)))
-        return true;
-    }
-    // return true if any frustum point is inside the box
-    for (auto const &pt : this->dataPtr->points)
-    {
-      if (_b.Contains(pt))
-        return true;
-    }
-
-    // Return true if any edge of the frustum passes through the AABB
-    for (const auto &edge : this->dataPtr->edges)
-    {
-      // If the edge projected onto a world axis does not overlapp with the AABB
-      // then the edge could not be passing through the AABB.
-      if (edge.first.X() < min.X() && edge.second.X() < min.X())
-      {
-        // both frustum edge points are below AABB on x axis
-        continue;
-      }
-      else if (edge.first.X() > max.X() && edge.second.X() > max.X())
-      {
-        // both frustum edge points are above AABB on x axis
-        continue;
-      }
-      else if (edge.first.Y() < min.Y() && edge.second.Y() < min.Y())
-      {
-        // both frustum edge points are below AABB on y axis
-        continue;
-      }
-      else if (edge.first.Y() > max.Y() && edge.second.Y() > max.Y())
-      {
-        // both frustum edge points are above AABB on y axis
-        continue;
-      }
-      else if (edge.first.Z() < min.Z() && edge.second.Z() < min.Z())
-      {
-        // both frustum edge points are below AABB on z axis
-        continue;
-      }
-      else if (edge.first.Z() > max.Z() && edge.second.Z() > max.Z())
-      {
-        // both frustum edge points are above AABB on z axis
-        continue;
-      }
-      else
-      {
-        // TODO(anyone) prove or disprove that Frustum must penetrate AABB???
-        return true;
-      }
-    }
-    return false;
-  }
+  this->Update();
+  return this->dataPtr->culler.Contains(_b);
+}
 
-  return true;
+/////////////////////////////////////////////////
+void Frustum::Contains(const double *_minX, const double *_minY,
+    const double *_minZ, const double *_maxX, const double *_maxY,
+    const double *_maxZ, const std::size_t _count, std::uint64_t *_visible,
+    const unsigned int _threads) const
+{
+  this->Update();
+  this->dataPtr->culler.Contains(_minX, _minY, _minZ, _maxX, _maxY, _maxZ,
+      _count, _visible, _threads);
 }
 
 /////////////////////////////////////////////////
 bool Frustum::Contains(const Vector3d &_p) const
 {
-  // If the point is on the negative side of a plane, then the point is not
-  // visible.
-  for (auto const &plane : this->dataPtr->planes)
-  {
-    if (plane.Side(_p) == Planed::NEGATIVE_SIDE)
-      return false;
-  }
+  this->Update();
+  return this->dataPtr->culler.Contains(_p);
+}
 
-  return true;
+/////////////////////////////////////////////////
+FrustumCuller Frustum::Culler() const
+{
+  this->Update();
+  return this->dataPtr->culler;
 }
 
 /////////////////////////////////////////////////
@@ -173,7 +234,7 @@ double Frustum::Near() const
 void Frustum::SetNear(const double _near)
 {
   this->dataPtr->near = _near;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 }
 
 /////////////////////////////////////////////////
@@ -186,7 +247,7 @@ double Frustum::Far() const
 void Frustum::SetFar(const double _far)
 {
   this->dataPtr->far = _far;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 }
 
 /////////////////////////////////////////////////
@@ -199,7 +260,7 @@ Angle Frustum::FOV() const
 void Frustum::SetFOV(const Angle &_angle)
 {
   this->dataPtr->fov = _angle;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 }
 
 /////////////////////////////////////////////////
@@ -212,7 +273,7 @@ Pose3d Frustum::Pose() const
 void Frustum::SetPose(const Pose3d &_pose)
 {
   this->dataPtr->pose = _pose;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 }
 
 /////////////////////////////////////////////////
@@ -225,114 +286,23 @@ double Frustum::AspectRatio() const
 void Frustum::SetAspectRatio(const double _aspectRatio)
 {
   this->dataPtr->aspectRatio = _aspectRatio;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 }
 
-/////////////////////////////////////////////////
-void Frustum::ComputePlanes()
+//////////////////////////////////////////////////
+void Frustum::Update() const
 {
-  // Tangent of half the field of view.
-  double tanFOV2 = std::tan(this->dataPtr->fov() * 0.5);
-
-  // Width of near plane
-  double nearWidth = 2.0 * tanFOV2 * this->dataPtr->near;
-
-  // Height of near plane
-  double nearHeight = nearWidth / this->dataPtr->aspectRatio;
-
-  // Width of far plane
-  double farWidth = 2.0 * tanFOV2 * this->dataPtr->far;
-
-  // Height of far plane
-  double farHeight = farWidth / this->dataPtr->aspectRatio;
-
-  // Up, right, and forward unit vectors.
-  Vector3d forward = this->dataPtr->pose.Rot().RotateVector(Vector3d::UnitX);
-  Vector3d up = this->dataPtr->pose.Rot().RotateVector(Vector3d::UnitZ);
-  Vector3d right = this->dataPtr->pose.Rot().RotateVector(-Vector3d::UnitY);
-
-  // Near plane center
-  Vector3d nearCenter = this->dataPtr->pose.Pos() + forward *
-    this->dataPtr->near;
-
-  // Far plane center
-  Vector3d farCenter = this->dataPtr->pose.Pos() + forward *
-    this->dataPtr->far;
-
-  // These four variables are here for convenience.
-  Vector3d upNearHeight2 = up * (nearHeight * 0.5);
-  Vector3d rightNearWidth2 = right * (nearWidth * 0.5);
-  Vector3d upFarHeight2 = up * (farHeight * 0.5);
-  Vector3d rightFarWidth2 = right * (farWidth * 0.5);
-
-  // Compute the vertices of the near plane
-  Vector3d nearTopLeft = nearCenter + upNearHeight2 - rightNearWidth2;
-  Vector3d nearTopRight = nearCenter + upNearHeight2 + rightNearWidth2;
-  Vector3d nearBottomLeft = nearCenter - upNearHeight2 - rightNearWidth2;
-  Vector3d nearBottomRight = nearCenter - upNearHeight2 + rightNearWidth2;
-
-  // Compute the vertices of the far plane
-  Vector3d farTopLeft = farCenter + upFarHeight2 - rightFarWidth2;
-  Vector3d farTopRight = farCenter + upFarHeight2 + rightFarWidth2;
-  Vector3d farBottomLeft = farCenter - upFarHeight2 - rightFarWidth2;
-  Vector3d farBottomRight = farCenter - upFarHeight2 + rightFarWidth2;
-
-  // Save these vertices
-  this->dataPtr->points[0] = nearTopLeft;
-  this->dataPtr->points[1] = nearTopRight;
-  this->dataPtr->points[2] = nearBottomLeft;
-  this->dataPtr->points[3] = nearBottomRight;
-  this->dataPtr->points[4] = farTopLeft;
-  this->dataPtr->points[5] = farTopRight;
-  this->dataPtr->points[6] = farBottomLeft;
-  this->dataPtr->points[7] = farBottomRight;
-
-  // Save the edges
-  this->dataPtr->edges[0] = {nearTopLeft, nearTopRight};
-  this->dataPtr->edges[1] = {nearTopLeft, nearBottomLeft};
-  this->dataPtr->edges[2] = {nearTopLeft, farTopLeft};
-  this->dataPtr->edges[3] = {nearTopRight, nearBottomRight};
-  this->dataPtr->edges[4] = {nearTopRight, farTopRight};
-  this->dataPtr->edges[5] = {nearBottomLeft, nearBottomRight};
-  this->dataPtr->edges[6] = {nearBottomLeft, farBottomLeft};
-  this->dataPtr->edges[7] = {farTopLeft, farTopRight};
-  this->dataPtr->edges[8] = {farTopLeft, farBottomLeft};
-  this->dataPtr->edges[9] = {farTopRight, farBottomRight};
-  this->dataPtr->edges[10] = {farBottomLeft, farBottomRight};
-  this->dataPtr->edges[11] = {farBottomRight, nearBottomRight};
-
-  Vector3d leftCenter =
-    (farTopLeft + nearTopLeft + farBottomLeft + nearBottomLeft) / 4.0;
-
-  Vector3d rightCenter =
-    (farTopRight + nearTopRight + farBottomRight + nearBottomRight) / 4.0;
-
-  Vector3d topCenter =
-    (farTopRight + nearTopRight + farTopLeft + nearTopLeft) / 4.0;
-
-  Vector3d bottomCenter =
-    (farBottomRight + nearBottomRight + farBottomLeft + nearBottomLeft) / 4.0;
-
-  // Compute plane offsets
-  // Set the planes, where the first value is the plane normal and the
-  // second the plane offset
-  Vector3d norm = Vector3d::Normal(nearTopLeft, nearTopRight, nearBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_NEAR].Set(norm, nearCenter.Dot(norm));
-
-  norm = Vector3d::Normal(farTopRight, farTopLeft, farBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_FAR].Set(norm, farCenter.Dot(norm));
-
-  norm = Vector3d::Normal(farTopLeft, nearTopLeft, nearBottomLeft);
-  this->dataPtr->planes[FRUSTUM_PLANE_LEFT].Set(norm, leftCenter.Dot(norm));
-
-  norm = Vector3d::Normal(nearTopRight, farTopRight, farBottomRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_RIGHT].Set(norm, rightCenter.Dot(norm));
-
-  norm = Vector3d::Normal(nearTopLeft, farTopLeft, nearTopRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_TOP].Set(norm, topCenter.Dot(norm));
-
-  norm = Vector3d::Normal(nearBottomLeft, nearBottomRight, farBottomRight);
-  this->dataPtr->planes[FRUSTUM_PLANE_BOTTOM].Set(norm, bottomCenter.Dot(norm));
+  // Const functions may be called from several threads, only one of them
+  // recomputes the planes.
+  if (!this->dataPtr->dirty.load(std::memory_order_acquire))
+    return;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (!this->dataPtr->dirty.load(std::memory_order_relaxed))
+    return;
+
+  this->dataPtr->culler = FrustumCuller(ComputePlanes(*this->dataPtr));
+  this->dataPtr->dirty.store(false, std::memory_order_release);
 }
 
 //////////////////////////////////////////////////
@@ -343,7 +313,7 @@ Frustum &Frustum::operator =(const Frustum &_f)
   this->dataPtr->fov = _f.dataPtr->fov;
   this->dataPtr->aspectRatio = _f.dataPtr->aspectRatio;
   this->dataPtr->pose = _f.dataPtr->pose;
-  this->ComputePlanes();
+  this->dataPtr->dirty = true;
 
   return *this;
 }
@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "gz/math/Frustum.hh"
+#include "gz/math/FrustumCuller.hh"
+#include "gz/math/detail/ParallelFor.hh"
+#include "gz/math/detail/Simd.hh"
+#include "FrustumCullerPrivate.hh"
+
+using namespace gz;
+using namespace math;
+
+namespace
+{
+  /// \brief Number of boxes evaluated together by the batch test. Must be
+  /// even, each SIMD register holds two boxes.
+  const std::size_t kLanes = 8;
+
+  /// \brief Number of bits in a word of the visibility mask.
+  const std::size_t kWordBits = 64;
+
+  /// \brief Minimum number of visibility mask words per thread.
+  const std::size_t kGrainWords = 64;
+
+  /////////////////////////////////////////////////
+  /// \brief Classify up to kLanes boxes against the planes, with the
+  /// same arithmetic as Planed::Side(const AxisAlignedBox &). The half
+  /// sizes are not negative, so multiplying them by the absolute normals
+  /// gives the same radius as Vector3::AbsDot.
+  /// \param[in] _data The snapshot data.
+  /// \param[in] _minX Minimum X of the boxes.
+  /// \param[in] _minY Minimum Y of the boxes.
+  /// \param[in] _minZ Minimum Z of the boxes.
+  /// \param[in] _maxX Maximum X of the boxes.
+  /// \param[in] _maxY Maximum Y of the boxes.
+  /// \param[in] _maxZ Maximum Z of the boxes.
+  /// \param[in] _count Number of boxes, at most kLanes.
+  /// \param[out] _sides For each box, -1 if it is on the negative side of
+  /// a plane, or else the number of planes it straddles.
+  void Sides(const FrustumCullerPrivate &_data,
+      const double *_minX, const double *_minY, const double *_minZ,
+      const double *_maxX, const double *_maxY, const double *_maxZ,
+      const std::size_t _count, std::array<int, kLanes> &_sides)
+  {
+    // Centers and half sizes, padded with empty boxes at the origin so
+    // that the planes are always tested against a full set of lanes.
+    std::array<double, kLanes> cx{}, cy{}, cz{}, ex{}, ey{}, ez{};
+    for (std::size_t j = 0; j < _count; ++j)
+    {
+      cx[j] = 0.5 * _minX[j] + 0.5 * _maxX[j];
+      cy[j] = 0.5 * _minY[j] + 0.5 * _maxY[j];
+      cz[j] = 0.5 * _minZ[j] + 0.5 * _maxZ[j];
+      ex[j] = std::max(0.0, _maxX[j] - _minX[j]) / 2.0;
+      ey[j] = std::max(0.0, _maxY[j] - _minY[j]) / 2.0;
+      ez[j] = std::max(0.0, _maxZ[j] - _minZ[j]) / 2.0;
+    }
+
+    std::array<int, kLanes> outside{}, overlapping{};
+#if defined(IGNITION_MATH_ENABLE_SIMD) && defined(IGNITION_MATH_HAVE_SIMD)
+    using namespace detail::simd;
+    const Double2 zero = Splat(0.0);
+    for (std::size_t p = 0; p < 6; ++p)
+    {
+      const Double2 nX = Splat(_data.nx[p]);
+      const Double2 nY = Splat(_data.ny[p]);
+      const Double2 nZ = Splat(_data.nz[p]);
+      const Double2 aX = Splat(_data.ax[p]);
+      const Double2 aY = Splat(_data.ay[p]);
+      const Double2 aZ = Splat(_data.az[p]);
+      const Double2 offset = Splat(_data.d[p]);
+      for (std::size_t j = 0; j < kLanes; j += 2)
+      {
+        // Same operations, in the same order, as the scalar code below.
+        const Double2 dist = Sub(Add(Add(Mul(nX, Load(&cx[j])),
+                Mul(nY, Load(&cy[j]))), Mul(nZ, Load(&cz[j]))), offset);
+        const Double2 radius = Add(Add(Mul(aX, Load(&ex[j])),
+              Mul(aY, Load(&ey[j]))), Mul(aZ, Load(&ez[j])));
+        const int negative = LessMask(dist, Sub(zero, radius));
+        const int positive = LessMask(radius, dist);
+        outside[j] |= negative & 1;
+        outside[j + 1] |= negative >> 1;
+        overlapping[j] += !(positive & 1);
+        overlapping[j + 1] += !(positive >> 1);
+      }
+    }
+#else
+    for (std::size_t p = 0; p < 6; ++p)
+    {
+      for (std::size_t j = 0; j < kLanes; ++j)
+      {
+        const double dist = _data.nx[p] * cx[j] + _data.ny[p] * cy[j] +
+          _data.nz[p] * cz[j] - _data.d[p];
+        const double radius = _data.ax[p] * ex[j] + _data.ay[p] * ey[j] +
+          _data.az[p] * ez[j];
+        outside[j] |= dist < -radius;
+        overlapping[j] += !(dist > radius);
+      }
+    }
+#endif
+
+    for (std::size_t j = 0; j < kLanes; ++j)
+      _sides[j] = outside[j] ? -1 : overlapping[j];
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Check if a point lies inside the frustum.
+  /// \param[in] _data The snapshot data.
+  /// \param[in] _p Point to check.
+  /// \return True if the point is inside the frustum.
+  bool ContainsPoint(const FrustumCullerPrivate &_data, const Vector3d &_p)
+  {
+    // If the point is on the negative side of a plane, then the point is not
+    // visible.
+    for (auto const &plane : _data.planes)
+    {
+      if (plane.Side(_p) == Planed::NEGATIVE_SIDE)
+        return false;
+    }
+
+    return true;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Exact test for a box that straddles several planes of the
+  /// frustum, which may still be outside of it.
+  /// \param[in] _data The snapshot data.
+  /// \param[in] _min Minimum corner of the box.
+  /// \param[in] _max Maximum corner of the box.
+  /// \return True if the box is inside the frustum.
+  bool ContainsOverlapping(const FrustumCullerPrivate &_data,
+      const Vector3d &_min, const Vector3d &_max)
+  {
+    // return true if any box point is inside the frustum
+    for (int p = 0; p < 8; ++p)
+    {
+      const double &x = (p & 4) ? _min.X() : _max.X();
+      const double &y = (p & 2) ? _min.Y() : _max.Y();
+      const double &z = (p & 1) ? _min.Z() : _max.Z();
+      if (ContainsPoint(_data, Vector3d(x, y, z)))
+        return true;
+    }
+    // return true if any frustum point is inside the box
+    for (auto const &pt : _data.points)
+    {
+      if (pt.X() >= _min.X() && pt.X() <= _max.X() &&
+          pt.Y() >= _min.Y() && pt.Y() <= _max.Y() &&
+          pt.Z() >= _min.Z() && pt.Z() <= _max.Z())
+      {
+        return true;
+      }
+    }
+
+    // Return true if any edge of the frustum passes through the AABB
+    for (const auto &edge : _data.edges)
+    {
+      // If the edge projected onto a world axis does not overlapp with the AABB
+      // then the edge could not be passing through the AABB.
+      if (edge.first.X() < _min.X() && edge.second.X() < _min.X())
+      {
+        // both frustum edge points are below AABB on x axis
+        continue;
+      }
+      else if (edge.first.X() > _max.X() && edge.second.X() > _max.X())
+      {
+        // both frustum edge points are above AABB on x axis
+        continue;
+      }
+      else if (edge.first.Y() < _min.Y() && edge.second.Y() < _min.Y())
+      {
+        // both frustum edge points are below AABB on y axis
+        continue;
+      }
+      else if (edge.first.Y() > _max.Y() && edge.second.Y() > _max.Y())
+      {
+        // both frustum edge points are above AABB on y axis
+        continue;
+      }
+      else if (edge.first.Z() < _min.Z() && edge.second.Z() < _min.Z())
+      {
+        // both frustum edge points are below AABB on z axis
+        continue;
+      }
+      else if (edge.first.Z() > _max.Z() && edge.second.Z() > _max.Z())
+      {
+        // both frustum edge points are above AABB on z axis
+        continue;
+      }
+      else
+      {
+        // TODO(anyone) prove or disprove that Frustum must penetrate AABB???
+        return true;
+      }
+    }
+    return false;
+  }
+}
+
+//////////////////////////////////////////////////
+FrustumCuller::FrustumCuller()
+  : dataPtr(std::make_shared<FrustumCullerPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+FrustumCuller::FrustumCuller(const Frustum &_frustum)
+  : FrustumCuller(_frustum.Culler())
+{
+}
+
+//////////////////////////////////////////////////
+FrustumCuller::FrustumCuller(
+    std::shared_ptr<const FrustumCullerPrivate> _data)
+  : dataPtr(std::move(_data))
+{
+}
+
+//////////////////////////////////////////////////
+bool FrustumCuller::Contains(const AxisAlignedBox &_b) const
+{
+  const auto &data = *this->dataPtr;
+  const Vector3d &min = _b.Min();
+  const Vector3d &max = _b.Max();
+
+  // Center and half size, like AxisAlignedBox::Center() and
+  // AxisAlignedBox::Size() / 2.
+  const double cx = 0.5 * min.X() + 0.5 * max.X();
+  const double cy = 0.5 * min.Y() + 0.5 * max.Y();
+  const double cz = 0.5 * min.Z() + 0.5 * max.Z();
+  const double ex = std::max(0.0, max.X() - min.X()) / 2.0;
+  const double ey = std::max(0.0, max.Y() - min.Y()) / 2.0;
+  const double ez = std::max(0.0, max.Z() - min.Z()) / 2.0;
+
+  // If the box is on the negative side of a plane, then the box is not
+  // visible.
+  int overlapping = 0;
+  for (std::size_t p = 0; p < 6; ++p)
+  {
+    const double dist = data.nx[p] * cx + data.ny[p] * cy + data.nz[p] * cz -
+      data.d[p];
+    const double radius = data.ax[p] * ex + data.ay[p] * ey + data.az[p] * ez;
+    if (dist < -radius)
+      return false;
+    if (!(dist > radius))
+      ++overlapping;
+  }
+
+  // it is possible to be outside of frustum and overlapping multiple planes
+  if (overlapping >= 2)
+    return ContainsOverlapping(data, min, max);
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool FrustumCuller::Contains(const Vector3d &_p) const
+{
+  return ContainsPoint(*this->dataPtr, _p);
+}
+
+//////////////////////////////////////////////////
+void FrustumCuller::Contains(const double *_minX, const double *_minY,
+    const double *_minZ, const double *_maxX, const double *_maxY,
+    const double *_maxZ, const std::size_t _count, std::uint64_t *_visible,
+    const unsigned int _threads) const
+{
+  const auto &data = *this->dataPtr;
+  const std::size_t words = (_count + kWordBits - 1) / kWordBits;
+
+  detail::ParallelFor(words, _threads,
+    [&](std::size_t _begin, std::size_t _end)
+    {
+      for (std::size_t w = _begin; w < _end; ++w)
+      {
+        std::uint64_t bits = 0;
+        const std::size_t first = w * kWordBits;
+        const std::size_t last = std::min(_count, first + kWordBits);
+        for (std::size_t b = first; b < last; b += kLanes)
+        {
+          const std::size_t lanes = std::min(kLanes, last - b);
+          std::array<int, kLanes> sides;
+          Sides(data, _minX + b, _minY + b, _minZ + b,
+              _maxX + b, _maxY + b, _maxZ + b, lanes, sides);
+
+          for (std::size_t j = 0; j < lanes; ++j)
+          {
+            const bool visible = sides[j] < 0 ? false :
+              sides[j] < 2 ? true : ContainsOverlapping(data,
+                  Vector3d(_minX[b + j], _minY[b + j], _minZ[b + j]),
+                  Vector3d(_maxX[b + j], _maxY[b + j], _maxZ[b + j]));
+            if (visible)
+              bits |= std::uint64_t(1) << (b + j - first);
+          }
+        }
+        _visible[w] = bits;
+      }
+    }, kGrainWords);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_MATH_FRUSTUMCULLERPRIVATE_HH_
+#define GZ_MATH_FRUSTUMCULLERPRIVATE_HH_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <gz/math/Plane.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/math/config.hh>
+
+namespace ignition
+{
+  namespace math
+  {
+    inline namespace IGNITION_MATH_VERSION_NAMESPACE
+    {
+    /// \internal
+    /// \brief Private data for the FrustumCuller class
+    class FrustumCullerPrivate
+    {
+      /// \brief Fill the packed plane arrays from the planes. Must be
+      /// called after the planes are changed.
+      public: void Pack()
+      {
+        for (std::size_t p = 0; p < 6; ++p)
+        {
+          const Vector3d &n = this->planes[p].Normal();
+          this->nx[p] = n.X();
+          this->ny[p] = n.Y();
+          this->nz[p] = n.Z();
+          this->ax[p] = std::abs(n.X());
+          this->ay[p] = std::abs(n.Y());
+          this->az[p] = std::abs(n.Z());
+          this->d[p] = this->planes[p].Offset();
+        }
+      }
+
+      /// \brief Each plane of the frustum.
+      /// \sa Frustum::FrustumPlane
+      public: std::array<Planed, 6> planes;
+
+      /// \brief Each corner of the frustum.
+      public: std::array<Vector3d, 8> points;
+
+      /// \brief each edge of the frustum.
+      public: std::array<std::pair<Vector3d, Vector3d>, 12> edges;
+
+      /// \brief Plane normals, packed.
+      public: double nx[6] = {}, ny[6] = {}, nz[6] = {};
+
+      /// \brief Absolute values of the plane normals, packed.
+      public: double ax[6] = {}, ay[6] = {}, az[6] = {};
+
+      /// \brief Plane offsets, packed.
+      public: double d[6] = {};
+    };
+    }
+  }
+}
+#endif
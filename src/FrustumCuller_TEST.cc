@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "gz/math/Frustum.hh"
+#include "gz/math/FrustumCuller.hh"
+
+using namespace gz;
+using namespace math;
+
+/////////////////////////////////////////////////
+/// \brief Generate random boxes of all sizes around the origin.
+std::vector<AxisAlignedBox> RandomBoxes(std::size_t _count)
+{
+  std::mt19937 gen(12345u);
+  std::uniform_real_distribution<double> pos(-25.0, 25.0);
+  std::uniform_real_distribution<double> size(0.0, 10.0);
+  std::vector<AxisAlignedBox> boxes;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d min(pos(gen), pos(gen), pos(gen));
+    boxes.emplace_back(min,
+        min + Vector3d(size(gen), size(gen), size(gen)) / (1.0 + i % 8));
+  }
+  return boxes;
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumCullerTest, Default)
+{
+  // Same as a default frustum, whose planes pass through the origin.
+  Frustum frustum;
+  FrustumCuller culler;
+  for (auto const &box : RandomBoxes(100))
+  {
+    EXPECT_EQ(frustum.Contains(box), culler.Contains(box));
+    EXPECT_EQ(frustum.Contains(box.Center()), culler.Contains(box.Center()));
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumCullerTest, MatchesFrustum)
+{
+  Frustum frustum(0.55, 20, Angle(1.05), 1.8,
+      Pose3d(1, -2, 2, 0.1, 0.2, 0.7));
+  const FrustumCuller culler = frustum.Culler();
+  const FrustumCuller fromFrustum(frustum);
+
+  const auto boxes = RandomBoxes(1000);
+  std::vector<double> minX, minY, minZ, maxX, maxY, maxZ;
+  for (auto const &box : boxes)
+  {
+    minX.push_back(box.Min().X());
+    minY.push_back(box.Min().Y());
+    minZ.push_back(box.Min().Z());
+    maxX.push_back(box.Max().X());
+    maxY.push_back(box.Max().Y());
+    maxZ.push_back(box.Max().Z());
+  }
+
+  std::vector<std::uint64_t> visible((boxes.size() + 63) / 64);
+  culler.Contains(minX.data(), minY.data(), minZ.data(),
+      maxX.data(), maxY.data(), maxZ.data(), boxes.size(), visible.data(), 4);
+
+  int visibleCount = 0;
+  for (std::size_t i = 0; i < boxes.size(); ++i)
+  {
+    const bool expected = frustum.Contains(boxes[i]);
+    EXPECT_EQ(expected, culler.Contains(boxes[i])) << "box " << i;
+    EXPECT_EQ(expected, fromFrustum.Contains(boxes[i])) << "box " << i;
+    EXPECT_EQ(expected, ((visible[i / 64] >> (i % 64)) & 1u) != 0)
+      << "box " << i;
+    EXPECT_EQ(frustum.Contains(boxes[i].Min()),
+        culler.Contains(boxes[i].Min()));
+    visibleCount += expected;
+  }
+  EXPECT_GT(visibleCount, 10);
+  EXPECT_LT(visibleCount, 990);
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumCullerTest, Snapshot)
+{
+  Frustum frustum(1, 10, Angle(IGN_DTOR(45)), 1.0, Pose3d::Zero);
+  const FrustumCuller culler = frustum.Culler();
+  FrustumCuller copy = culler;
+
+  const AxisAlignedBox box(Vector3d(4, -0.5, -0.5), Vector3d(5, 0.5, 0.5));
+  EXPECT_TRUE(culler.Contains(box));
+  EXPECT_TRUE(culler.Contains(Vector3d(5, 0, 0)));
+
+  // The snapshot does not follow the frustum.
+  frustum.SetPose(Pose3d(0, 0, 0, 0, 0, IGN_PI));
+  EXPECT_FALSE(frustum.Contains(box));
+  EXPECT_TRUE(culler.Contains(box));
+  EXPECT_TRUE(copy.Contains(box));
+
+  copy = frustum.Culler();
+  EXPECT_FALSE(copy.Contains(box));
+  EXPECT_TRUE(copy.Contains(Vector3d(-5, 0, 0)));
+  EXPECT_TRUE(culler.Contains(Vector3d(5, 0, 0)));
+}
+
+/////////////////////////////////////////////////
+TEST(FrustumCullerTest, Threads)
+{
+  const Frustum frustum(0.55, 20, Angle(1.05), 1.8,
+      Pose3d(1, -2, 2, 0.1, 0.2, 0.7));
+  const FrustumCuller culler = frustum.Culler();
+  const auto boxes = RandomBoxes(1000);
+
+  std::vector<char> expected;
+  for (auto const &box : boxes)
+    expected.push_back(frustum.Contains(box));
+
+  // The same snapshot is used from several threads.
+  std::vector<std::vector<char>> results(4);
+  std::vector<std::thread> threads;
+  for (auto &result : results)
+  {
+    threads.emplace_back([&culler, &boxes, &result]()
+    {
+      for (auto const &box : boxes)
+        result.push_back(culler.Contains(box));
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto const &result : results)
+    EXPECT_EQ(expected, result);
+}
@@ -17,11 +17,11 @@
 #ifndef GZ_MATH_FRUSTUMPRIVATE_HH_
 #define GZ_MATH_FRUSTUMPRIVATE_HH_
 
-#include <array>
-#include <utility>
+#include <atomic>
+#include <mutex>
 #include <gz/math/Pose3.hh>
 #include <gz/math/Angle.hh>
-#include <gz/math/Plane.hh>
+#include <gz/math/FrustumCuller.hh>
 #include <gz/math/config.hh>
 
 namespace ignition
@@ -72,15 +72,17 @@ namespace ignition
       /// \brief Pose of the frustum
       public: math::Pose3d pose;
 
-      /// \brief Each plane of the frustum.
-      /// \sa Frustum::FrustumPlane
-      public: std::array<Planed, 6> planes;
+      /// \brief Snapshot with the planes, corners and edges of the
+      /// frustum. Only valid when dirty is false.
+      public: FrustumCuller culler;
 
-      /// \brief Each corner of the frustum.
-      public: std::array<Vector3d, 8> points;
+      /// \brief True when a property changed since the planes were last
+      /// computed. The planes are computed when they are next needed, so
+      /// that several changes in a row only pay for it once.
+      public: std::atomic<bool> dirty{false};
 
-      /// \brief each edge of the frustum.
-      public: std::array<std::pair<Vector3d, Vector3d>, 12> edges;
+      /// \brief Serializes the computation of the planes.
+      public: std::mutex mutex;
     };
     }
   }
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
 #include "gz/math/Helpers.hh"
 #include "gz/math/Frustum.hh"
 
@@ -659,3 +665,135 @@ TEST(FrustumTest, AABBBFWall)
   EXPECT_TRUE(frustum.Contains(
         AxisAlignedBox(Vector3d(-10, -10, 1.95), Vector3d(10, 10, 2.05))));
 }
+
+//////////////////////////////////////////////////
+TEST(FrustumTest, ContainsBatch)
+{
+  Frustum frustum;
+  frustum.SetNear(0.55);
+  frustum.SetFar(20);
+  frustum.SetFOV(1.05);
+  frustum.SetAspectRatio(1.8);
+  frustum.SetPose(Pose3d(1, -2, 2, 0.1, 0.2, 0.7));
+
+  // Random boxes of all sizes around the frustum, plus some invalid ones.
+  std::mt19937 gen(12345u);
+  std::uniform_real_distribution<double> pos(-25.0, 25.0);
+  std::uniform_real_distribution<double> size(0.0, 10.0);
+  std::vector<double> minX, minY, minZ, maxX, maxY, maxZ;
+  std::vector<AxisAlignedBox> boxes;
+  for (int i = 0; i < 1000; ++i)
+  {
+    AxisAlignedBox box;
+    if (i % 100 != 0)
+    {
+      const Vector3d min(pos(gen), pos(gen), pos(gen));
+      box = AxisAlignedBox(min,
+          min + Vector3d(size(gen), size(gen), size(gen)) / (1 + i % 8));
+    }
+    boxes.push_back(box);
+    minX.push_back(box.Min().X());
+    minY.push_back(box.Min().Y());
+    minZ.push_back(box.Min().Z());
+    maxX.push_back(box.Max().X());
+    maxY.push_back(box.Max().Y());
+    maxZ.push_back(box.Max().Z());
+  }
+
+  int visibleCount = 0;
+  for (std::size_t count : {0u, 1u, 63u, 64u, 65u, 1000u})
+  {
+    for (unsigned int threads : {1u, 4u})
+    {
+      std::vector<std::uint64_t> visible((count + 63) / 64 + 1, ~0ull);
+      frustum.Contains(minX.data(), minY.data(), minZ.data(),
+          maxX.data(), maxY.data(), maxZ.data(), count, visible.data(),
+          threads);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const bool expected = frustum.Contains(boxes[i]);
+        EXPECT_EQ(expected, ((visible[i / 64] >> (i % 64)) & 1u) != 0)
+          << "box " << i;
+        if (count == 1000u && threads == 1u && expected)
+          ++visibleCount;
+      }
+
+      // Unused bits are cleared, and nothing is written past the mask.
+      if (count % 64 != 0)
+      {
+        EXPECT_EQ(0u, visible[count / 64] >> (count % 64));
+      }
+      EXPECT_EQ(~0ull, visible.back());
+    }
+  }
+
+  // Make sure both results are represented.
+  EXPECT_GT(visibleCount, 10);
+  EXPECT_LT(visibleCount, 990);
+}
+
+//////////////////////////////////////////////////
+TEST(FrustumTest, DeferredUpdate)
+{
+  const Pose3d pose(1, -2, 2, 0.1, 0.2, 0.7);
+  const Frustum expected(0.55, 20, Angle(1.05), 1.8, pose);
+
+  // Several changes in a row are the same as setting everything at once.
+  Frustum frustum;
+  frustum.SetNear(0.55);
+  frustum.SetFar(20);
+  frustum.SetFOV(1.05);
+  frustum.SetAspectRatio(1.8);
+  frustum.SetPose(pose);
+
+  for (int p = Frustum::FRUSTUM_PLANE_NEAR;
+       p <= Frustum::FRUSTUM_PLANE_BOTTOM; ++p)
+  {
+    auto plane = static_cast<Frustum::FrustumPlane>(p);
+    EXPECT_EQ(expected.Plane(plane).Normal(), frustum.Plane(plane).Normal());
+    EXPECT_DOUBLE_EQ(expected.Plane(plane).Offset(),
+        frustum.Plane(plane).Offset());
+  }
+
+  // A copy of an out of date frustum gets the same planes.
+  frustum.SetFar(10);
+  Frustum copy(frustum);
+  EXPECT_EQ(frustum.Plane(Frustum::FRUSTUM_PLANE_FAR).Normal(),
+      copy.Plane(Frustum::FRUSTUM_PLANE_FAR).Normal());
+  EXPECT_DOUBLE_EQ(frustum.Plane(Frustum::FRUSTUM_PLANE_FAR).Offset(),
+      copy.Plane(Frustum::FRUSTUM_PLANE_FAR).Offset());
+
+  // The copy also gets the corners and edges, used by boxes that overlap
+  // several planes.
+  const AxisAlignedBox wall(Vector3d(2, -10, -10), Vector3d(3, 10, 10));
+  EXPECT_EQ(frustum.Contains(wall), copy.Contains(wall));
+}
+
+//////////////////////////////////////////////////
+TEST(FrustumTest, ConcurrentUpdate)
+{
+  Frustum frustum;
+  frustum.SetNear(0.55);
+  frustum.SetFar(20);
+  frustum.SetFOV(1.05);
+  frustum.SetAspectRatio(1.8);
+  frustum.SetPose(Pose3d(1, -2, 2, 0.1, 0.2, 0.7));
+
+  // Const functions update the planes, which is safe from several threads.
+  const Frustum &constFrustum = frustum;
+  std::vector<char> results(8, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    threads.emplace_back([&constFrustum, &results, i]()
+    {
+      results[i] = constFrustum.Contains(Vector3d(5, -2, 2));
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto result : results)
+    EXPECT_EQ(frustum.Contains(Vector3d(5, -2, 2)), result != 0);
+}
@@ -17,14 +17,329 @@
 
 #include <gz/math/Kmeans.hh>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <iostream>
+#include <mutex>
 
 #include <gz/math/Rand.hh>
+#include "gz/math/detail/ParallelFor.hh"
 #include "KmeansPrivate.hh"
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+  /// \brief Minimum number of observations per thread.
+  const std::size_t kGrain = 4096;
+
+  /// \brief Relative tolerance of the bound checks in AssignHamerly().
+  const double kBoundTolerance = 1e-10;
+
+  //////////////////////////////////////////////////
+  /// \brief Get the index of the closest centroid to a point.
+  /// \param[in] _p Point to check.
+  /// \param[in] _centroids The centroids.
+  /// \return The index of the closest centroid.
+  unsigned int Closest(const Vector3d &_p,
+                       const std::vector<Vector3d> &_centroids)
+  {
+    // Squared distances give the same order without the square roots.
+    double min = HUGE_VAL;
+    unsigned int minIdx = 0;
+    for (auto i = 0u; i < _centroids.size(); ++i)
+    {
+      const double d = (_p - _centroids[i]).SquaredLength();
+      if (d < min)
+      {
+        min = d;
+        minIdx = i;
+      }
+    }
+    return minIdx;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Check the arguments of the clustering functions.
+  /// \param[in] _data Private data.
+  /// \param[in] _k Number of clusters.
+  /// \return True if the arguments are valid.
+  bool Valid(const KmeansPrivate &_data, int _k)
+  {
+    if (_data.obs.empty())
+    {
+      std::cerr << "Kmeans error: The set of observations is empty"
+                << std::endl;
+      return false;
+    }
+
+    if (_k <= 0)
+    {
+      std::cerr << "Kmeans error: The number of clusters has to"
+                << " be positive but its value is [" << _k << "]"
+                << std::endl;
+      return false;
+    }
+
+    if (_k > static_cast<int>(_data.obs.size()))
+    {
+      std::cerr << "Kmeans error: The number of clusters [" << _k
+                << "] has to be lower or equal to the number of observations ["
+                << _data.obs.size() << "]" << std::endl;
+      return false;
+    }
+
+    return true;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Choose the initial centroids.
+  /// \param[in, out] _data Private data.
+  /// \param[in] _k Number of clusters.
+  void Seed(KmeansPrivate &_data, unsigned int _k)
+  {
+    auto &obs = _data.obs;
+    auto &centroids = _data.centroids;
+    centroids.clear();
+
+    if (_data.seeding == Kmeans::FIRST_OBSERVATIONS)
+    {
+      // Note: This is not really random but it's faster than choosing a
+      // random one and verifying that it was not taken before.
+      centroids.assign(obs.begin(), obs.begin() + _k);
+      return;
+    }
+
+    // k-means++. The first centroid is chosen uniformly.
+    const int n = static_cast<int>(obs.size());
+    centroids.push_back(obs[Rand::IntUniform(0, n - 1)]);
+
+    // Squared distance from each observation to its closest centroid.
+    std::vector<double> minDist(obs.size(), HUGE_VAL);
+    double total = 0;
+    std::mutex mutex;
+
+    while (centroids.size() < _k)
+    {
+      // Update the distances with the last centroid.
+      total = 0;
+      detail::ParallelFor(obs.size(), _data.threads,
+          [&](const std::size_t _begin, const std::size_t _end)
+      {
+        double partial = 0;
+        for (std::size_t i = _begin; i < _end; ++i)
+        {
+          minDist[i] = std::min(minDist[i],
+              (obs[i] - centroids.back()).SquaredLength());
+          partial += minDist[i];
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        total += partial;
+      }, kGrain);
+
+      // All the observations are already centroids.
+      if (total <= 0)
+      {
+        centroids.push_back(obs[Rand::IntUniform(0, n - 1)]);
+        continue;
+      }
+
+      // Choose the next centroid with probability proportional to minDist.
+      const double target = Rand::DblUniform(0, total);
+      double sum = 0;
+      std::size_t next = 0;
+      for (; next + 1 < obs.size(); ++next)
+      {
+        sum += minDist[next];
+        if (sum >= target && minDist[next] > 0)
+          break;
+      }
+      centroids.push_back(obs[next]);
+    }
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Assign each observation to its closest centroid, and add up the
+  /// observations of each cluster in _data.sums and _data.counters.
+  /// \param[in, out] _data Private data.
+  /// \return Number of labels that changed.
+  std::size_t Assign(KmeansPrivate &_data)
+  {
+    const std::size_t k = _data.centroids.size();
+    _data.sums.assign(k, Vector3d::Zero);
+    _data.counters.assign(k, 0);
+
+    std::size_t changed = 0;
+    std::mutex mutex;
+    detail::ParallelFor(_data.obs.size(), _data.threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      // Partial sums of this thread.
+      std::vector<Vector3d> sums(k, Vector3d::Zero);
+      std::vector<unsigned int> counters(k, 0);
+      std::size_t partialChanged = 0;
+
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        // Update the labels containing the closest centroid for each point.
+        auto label = Closest(_data.obs[i], _data.centroids);
+        if (_data.labels[i] != label)
+        {
+          _data.labels[i] = label;
+          ++partialChanged;
+        }
+        sums[label] += _data.obs[i];
+        ++counters[label];
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      for (std::size_t c = 0; c < k; ++c)
+      {
+        _data.sums[c] += sums[c];
+        _data.counters[c] += counters[c];
+      }
+      changed += partialChanged;
+    }, kGrain);
+
+    return changed;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Same as Assign(), but skip the observations whose bounds in
+  /// _data.upper and _data.lower prove that their label did not change.
+  /// \param[in, out] _data Private data.
+  /// \return Number of labels that changed.
+  std::size_t AssignHamerly(KmeansPrivate &_data)
+  {
+    const auto &centroids = _data.centroids;
+    const std::size_t k = centroids.size();
+
+    // Half the distance from each centroid to the closest other centroid.
+    // An observation closer than this to its centroid can't be closer to
+    // another one.
+    std::vector<double> half(k, HUGE_VAL);
+    for (std::size_t a = 0; a < k; ++a)
+    {
+      for (std::size_t b = a + 1; b < k; ++b)
+      {
+        const double d = 0.5 * centroids[a].Distance(centroids[b]);
+        half[a] = std::min(half[a], d);
+        half[b] = std::min(half[b], d);
+      }
+    }
+
+    _data.sums.assign(k, Vector3d::Zero);
+    _data.counters.assign(k, 0);
+
+    std::size_t changed = 0;
+    std::mutex mutex;
+    detail::ParallelFor(_data.obs.size(), _data.threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      // Partial sums of this thread.
+      std::vector<Vector3d> sums(k, Vector3d::Zero);
+      std::vector<unsigned int> counters(k, 0);
+      std::size_t partialChanged = 0;
+
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        const auto &p = _data.obs[i];
+        auto label = _data.labels[i];
+
+        // The bounds are compared with a small tolerance, so rounding
+        // errors can only cause extra distance computations.
+        const double bound = std::max(half[label], _data.lower[i]);
+        if (_data.upper[i] * (1 + kBoundTolerance) >= bound)
+        {
+          // Tighten the upper bound and try again.
+          _data.upper[i] = p.Distance(centroids[label]);
+          if (_data.upper[i] * (1 + kBoundTolerance) >= bound)
+          {
+            // Compute all the distances, like Closest().
+            double min = HUGE_VAL;
+            double second = HUGE_VAL;
+            for (auto c = 0u; c < k; ++c)
+            {
+              const double d = (p - centroids[c]).SquaredLength();
+              if (d < min)
+              {
+                second = min;
+                min = d;
+                label = c;
+              }
+              else if (d < second)
+              {
+                second = d;
+              }
+            }
+            _data.upper[i] = std::sqrt(min);
+            _data.lower[i] = std::sqrt(second);
+
+            if (_data.labels[i] != label)
+            {
+              _data.labels[i] = label;
+              ++partialChanged;
+            }
+          }
+        }
+
+        sums[label] += p;
+        ++counters[label];
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      for (std::size_t c = 0; c < k; ++c)
+      {
+        _data.sums[c] += sums[c];
+        _data.counters[c] += counters[c];
+      }
+      changed += partialChanged;
+    }, kGrain);
+
+    return changed;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Update the bounds used by AssignHamerly() after the centroids
+  /// moved.
+  /// \param[in, out] _data Private data.
+  /// \param[in] _previous Centroids before they moved.
+  void UpdateBounds(KmeansPrivate &_data,
+                    const std::vector<Vector3d> &_previous)
+  {
+    // Distance moved by each centroid, and the two largest ones.
+    std::vector<double> moves(_previous.size());
+    std::size_t largest = 0;
+    double secondMove = 0;
+    for (std::size_t c = 0; c < moves.size(); ++c)
+    {
+      moves[c] = _previous[c].Distance(_data.centroids[c]);
+      if (moves[c] > moves[largest])
+      {
+        secondMove = moves[largest];
+        largest = c;
+      }
+      else if (c != largest && moves[c] > secondMove)
+      {
+        secondMove = moves[c];
+      }
+    }
+
+    detail::ParallelFor(_data.obs.size(), _data.threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+      {
+        const auto label = _data.labels[i];
+        _data.upper[i] += moves[label];
+        _data.lower[i] -= label == largest ? secondMove : moves[largest];
+      }
+    }, kGrain);
+  }
+}
+
 //////////////////////////////////////////////////
 Kmeans::Kmeans(const std::vector<Vector3d> &_obs)
 : dataPtr(new KmeansPrivate)
@@ -77,98 +392,161 @@ bool Kmeans::Cluster(int _k,
                      std::vector<unsigned int> &_labels)
 {
   // Sanity check.
-  if (this->dataPtr->obs.empty())
-  {
-    std::cerr << "Kmeans error: The set of observations is empty" << std::endl;
-    return false;
-  }
-
-  if (_k <= 0)
-  {
-    std::cerr << "Kmeans error: The number of clusters has to"
-              << " be positive but its value is [" << _k << "]"
-              << std::endl;
-    return false;
-  }
-
-  if (_k > static_cast<int>(this->dataPtr->obs.size()))
-  {
-    std::cerr << "Kmeans error: The number of clusters [" << _k << "] has to be"
-              << " lower or equal to the number of observations ["
-              << this->dataPtr->obs.size() << "]" << std::endl;
+  if (!Valid(*this->dataPtr, _k))
     return false;
-  }
 
   size_t changed = 0;
 
-  // Initialize the size of the vectors;
-  this->dataPtr->centroids.clear();
-  this->dataPtr->labels.resize(this->dataPtr->obs.size());
-  this->dataPtr->sums.resize(_k);
-  this->dataPtr->counters.resize(_k);
+  const bool hamerly = this->dataPtr->assignment == HAMERLY;
+
+  // Initialize labels.
+  this->dataPtr->labels.assign(this->dataPtr->obs.size(), 0);
 
-  for (auto i = 0; i < _k; ++i)
+  // Initialize the bounds so the first assignment computes the distances.
+  if (hamerly)
   {
-    // Choose a random observation and make sure it has not been chosen before.
-    // Note: This is not really random but it's faster than choosing a random
-    // one and verifying that it was not taken before.
-    this->dataPtr->centroids.push_back(this->dataPtr->obs[i]);
+    this->dataPtr->upper.assign(this->dataPtr->obs.size(), HUGE_VAL);
+    this->dataPtr->lower.assign(this->dataPtr->obs.size(), 0.0);
   }
 
-  // Initialize labels.
-  for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
-    this->dataPtr->labels[i] = 0;
+  Seed(*this->dataPtr, _k);
 
+  std::vector<Vector3d> previous;
   do
   {
-    // Reset sums and counters.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
-    {
-      this->dataPtr->sums[i] = Vector3d::Zero;
-      this->dataPtr->counters[i] = 0;
-    }
-    changed = 0;
+    changed = hamerly ? AssignHamerly(*this->dataPtr) :
+      Assign(*this->dataPtr);
 
-    for (auto i = 0u; i < this->dataPtr->obs.size(); ++i)
+    // Update the centroids. Empty clusters keep their centroid.
+    previous = this->dataPtr->centroids;
+    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
     {
-      // Update the labels containing the closest centroid for each point.
-      auto label = this->ClosestCentroid(this->dataPtr->obs[i]);
-      if (this->dataPtr->labels[i] != label)
+      if (this->dataPtr->counters[i] > 0)
       {
-        this->dataPtr->labels[i] = label;
-        changed++;
+        this->dataPtr->centroids[i] =
+          this->dataPtr->sums[i] / this->dataPtr->counters[i];
       }
-      this->dataPtr->sums[label] += this->dataPtr->obs[i];
-      this->dataPtr->counters[label]++;
     }
 
-    // Update the centroids.
-    for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
-    {
-      this->dataPtr->centroids[i] =
-        this->dataPtr->sums[i] / this->dataPtr->counters[i];
-    }
+    if (hamerly)
+      UpdateBounds(*this->dataPtr, previous);
   }
   while (changed > (this->dataPtr->obs.size() >> 10)); // NOLINT
 
+  // Each centroid summarizes its observations, for MiniBatchCluster().
+  this->dataPtr->batchCounters.assign(this->dataPtr->counters.begin(),
+      this->dataPtr->counters.end());
+
   _centroids = this->dataPtr->centroids;
   _labels = this->dataPtr->labels;
   return true;
 }
 
 //////////////////////////////////////////////////
-unsigned int Kmeans::ClosestCentroid(const Vector3d &_p) const
+bool Kmeans::MiniBatchCluster(int _k,
+                              unsigned int _batchSize,
+                              unsigned int _iterations,
+                              std::vector<Vector3d> &_centroids,
+                              std::vector<unsigned int> &_labels)
 {
-  double min = HUGE_VAL;
-  unsigned int minIdx = 0;
-  for (auto i = 0u; i < this->dataPtr->centroids.size(); ++i)
+  // Sanity check.
+  if (!Valid(*this->dataPtr, _k))
+    return false;
+
+  if (_batchSize == 0)
+  {
+    std::cerr << "Kmeans error: The batch size has to be positive"
+              << std::endl;
+    return false;
+  }
+
+  auto &obs = this->dataPtr->obs;
+  auto &centroids = this->dataPtr->centroids;
+  auto &batchCounters = this->dataPtr->batchCounters;
+
+  // Start from the previous centroids if possible.
+  if (centroids.size() != static_cast<std::size_t>(_k) ||
+      batchCounters.size() != centroids.size())
   {
-    double d = _p.Distance(this->dataPtr->centroids[i]);
-    if (d < min)
+    Seed(*this->dataPtr, _k);
+    batchCounters.assign(_k, 0.0);
+  }
+
+  std::vector<std::size_t> batch(_batchSize);
+  std::vector<unsigned int> batchLabels(_batchSize);
+  const int n = static_cast<int>(obs.size());
+
+  for (auto it = 0u; it < _iterations; ++it)
+  {
+    for (auto &index : batch)
+      index = Rand::IntUniform(0, n - 1);
+
+    // Assign the batch with the centroids of the previous iteration.
+    detail::ParallelFor(batch.size(), this->dataPtr->threads,
+        [&](const std::size_t _begin, const std::size_t _end)
+    {
+      for (std::size_t i = _begin; i < _end; ++i)
+        batchLabels[i] = Closest(obs[batch[i]], centroids);
+    }, kGrain);
+
+    // Move each centroid towards its observations, with a learning rate
+    // that decreases with the number of observations it has seen.
+    for (std::size_t i = 0; i < batch.size(); ++i)
     {
-      min = d;
-      minIdx = i;
+      const auto label = batchLabels[i];
+      batchCounters[label] += 1.0;
+      centroids[label] +=
+        (obs[batch[i]] - centroids[label]) / batchCounters[label];
     }
   }
-  return minIdx;
+
+  // Label all the observations.
+  this->dataPtr->labels.resize(obs.size());
+  Assign(*this->dataPtr);
+
+  _centroids = centroids;
+  _labels = this->dataPtr->labels;
+  return true;
+}
+
+//////////////////////////////////////////////////
+Kmeans::SeedingMethod Kmeans::Seeding() const
+{
+  return this->dataPtr->seeding;
+}
+
+//////////////////////////////////////////////////
+void Kmeans::Seeding(SeedingMethod _method)
+{
+  this->dataPtr->seeding = _method;
+}
+
+//////////////////////////////////////////////////
+Kmeans::AssignmentMethod Kmeans::Assignment() const
+{
+  return this->dataPtr->assignment;
+}
+
+//////////////////////////////////////////////////
+void Kmeans::Assignment(AssignmentMethod _method)
+{
+  this->dataPtr->assignment = _method;
+}
+
+//////////////////////////////////////////////////
+unsigned int Kmeans::Threads() const
+{
+  return this->dataPtr->threads;
+}
+
+//////////////////////////////////////////////////
+void Kmeans::Threads(unsigned int _threads)
+{
+  this->dataPtr->threads = _threads;
+}
+
+//////////////////////////////////////////////////
+unsigned int Kmeans::ClosestCentroid(const Vector3d &_p) const
+{
+  return Closest(_p, this->dataPtr->centroids);
 }
@@ -18,6 +18,7 @@
 #define GZ_MATH_KMEANSPRIVATE_HH_
 
 #include <vector>
+#include <gz/math/Kmeans.hh>
 #include <gz/math/Vector3.hh>
 #include <gz/math/Helpers.hh>
 #include <gz/math/config.hh>
@@ -46,6 +47,27 @@ namespace ignition
 
       /// \brief Counts the number of observations contained in each partition.
       public: std::vector<unsigned int> counters;
+
+      /// \brief Method used to choose the initial centroids.
+      public: Kmeans::SeedingMethod seeding = Kmeans::FIRST_OBSERVATIONS;
+
+      /// \brief Method used to find the closest centroid.
+      public: Kmeans::AssignmentMethod assignment = Kmeans::BRUTE_FORCE;
+
+      /// \brief Upper bound of the distance from each observation to its
+      /// centroid, used by the HAMERLY assignment.
+      public: std::vector<double> upper;
+
+      /// \brief Lower bound of the distance from each observation to its
+      /// second closest centroid, used by the HAMERLY assignment.
+      public: std::vector<double> lower;
+
+      /// \brief Maximum number of threads used in the assignment step.
+      public: unsigned int threads = 1;
+
+      /// \brief Number of observations used to update each centroid by
+      /// MiniBatchCluster().
+      public: std::vector<double> batchCounters;
     };
     }
   }
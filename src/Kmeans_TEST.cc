@@ -16,8 +16,11 @@
 */
 
 #include <gtest/gtest.h>
+#include <cstddef>
+#include <set>
 #include <vector>
 #include "gz/math/Kmeans.hh"
+#include "gz/math/Rand.hh"
 
 using namespace gz;
 
@@ -140,3 +143,171 @@ TEST(KmeansTest, Append)
   std::vector<math::Vector3d> emptyVector;
   EXPECT_FALSE(kmeans.AppendObservations(emptyVector));
 }
+
+/////////////////////////////////////////////////
+/// \brief Generate observations around three centers.
+/// \param[in] _count Number of observations per center.
+/// \return The observations, grouped by center.
+std::vector<math::Vector3d> Blobs(std::size_t _count)
+{
+  const std::vector<math::Vector3d> centers =
+    {{0, 0, 0}, {10, 0, 0}, {0, 10, 0}};
+
+  std::vector<math::Vector3d> obs;
+  for (auto const &center : centers)
+  {
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+      obs.push_back(center + math::Vector3d(math::Rand::DblUniform(-1, 1),
+            math::Rand::DblUniform(-1, 1), math::Rand::DblUniform(-1, 1)));
+    }
+  }
+  return obs;
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that each group of _count observations has its own label,
+/// and that the centroids are close to the centers used by Blobs().
+void ExpectBlobs(std::size_t _count,
+                 const std::vector<math::Vector3d> &_centroids,
+                 const std::vector<unsigned int> &_labels,
+                 double _tol)
+{
+  ASSERT_EQ(3u, _centroids.size());
+  ASSERT_EQ(3 * _count, _labels.size());
+
+  std::set<unsigned int> groupLabels;
+  for (std::size_t g = 0; g < 3; ++g)
+  {
+    const auto label = _labels[g * _count];
+    groupLabels.insert(label);
+    for (std::size_t i = 0; i < _count; ++i)
+      EXPECT_EQ(label, _labels[g * _count + i]);
+
+    const math::Vector3d center(g == 1 ? 10 : 0, g == 2 ? 10 : 0, 0);
+    EXPECT_LT(_centroids[label].Distance(center), _tol);
+  }
+  EXPECT_EQ(3u, groupLabels.size());
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, KmeansPlusPlus)
+{
+  math::Rand::Seed(1234);
+  const auto obs = Blobs(100);
+
+  math::Kmeans kmeans(obs);
+  EXPECT_EQ(math::Kmeans::FIRST_OBSERVATIONS, kmeans.Seeding());
+  kmeans.Seeding(math::Kmeans::KMEANS_PLUS_PLUS);
+  EXPECT_EQ(math::Kmeans::KMEANS_PLUS_PLUS, kmeans.Seeding());
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.Cluster(3, centroids, labels));
+  ExpectBlobs(100, centroids, labels, 0.3);
+
+  // Repeated observations.
+  math::Kmeans repeated({{1, 0, 0}, {1, 0, 0}, {2, 0, 0}});
+  repeated.Seeding(math::Kmeans::KMEANS_PLUS_PLUS);
+  EXPECT_TRUE(repeated.Cluster(3, centroids, labels));
+  EXPECT_EQ(3u, centroids.size());
+  EXPECT_EQ(labels[0], labels[1]);
+  EXPECT_NE(labels[0], labels[2]);
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, Threads)
+{
+  math::Rand::Seed(1234);
+  const auto obs = Blobs(10000);
+
+  math::Kmeans kmeans(obs);
+  EXPECT_EQ(1u, kmeans.Threads());
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.Cluster(3, centroids, labels));
+  ExpectBlobs(10000, centroids, labels, 0.05);
+
+  kmeans.Threads(4);
+  EXPECT_EQ(4u, kmeans.Threads());
+  std::vector<math::Vector3d> parallelCentroids;
+  std::vector<unsigned int> parallelLabels;
+  EXPECT_TRUE(kmeans.Cluster(3, parallelCentroids, parallelLabels));
+  EXPECT_EQ(labels, parallelLabels);
+  ASSERT_EQ(centroids.size(), parallelCentroids.size());
+  for (std::size_t i = 0; i < centroids.size(); ++i)
+    EXPECT_EQ(centroids[i], parallelCentroids[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, MiniBatch)
+{
+  math::Rand::Seed(1234);
+  auto obs = Blobs(1000);
+
+  math::Kmeans kmeans(obs);
+  kmeans.Seeding(math::Kmeans::KMEANS_PLUS_PLUS);
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  EXPECT_TRUE(kmeans.MiniBatchCluster(3, 64, 50, centroids, labels));
+  ExpectBlobs(1000, centroids, labels, 0.3);
+
+  // Stream more observations and continue from the previous centroids.
+  auto more = Blobs(1000);
+  EXPECT_TRUE(kmeans.AppendObservations(more));
+  std::vector<math::Vector3d> updated;
+  EXPECT_TRUE(kmeans.MiniBatchCluster(3, 64, 10, updated, labels));
+  ASSERT_EQ(6000u, labels.size());
+  for (std::size_t i = 0; i < 3; ++i)
+    EXPECT_LT(updated[i].Distance(centroids[i]), 0.3);
+
+  // Invalid arguments.
+  EXPECT_FALSE(kmeans.MiniBatchCluster(3, 0, 10, centroids, labels));
+  EXPECT_FALSE(kmeans.MiniBatchCluster(0, 64, 10, centroids, labels));
+  EXPECT_FALSE(kmeans.MiniBatchCluster(6001, 64, 10, centroids, labels));
+}
+
+/////////////////////////////////////////////////
+TEST(KmeansTest, Hamerly)
+{
+  math::Rand::Seed(1234);
+  std::vector<math::Vector3d> obs(20000);
+  for (auto &p : obs)
+  {
+    p.Set(math::Rand::DblUniform(-10, 10), math::Rand::DblUniform(-10, 10),
+          math::Rand::DblUniform(-10, 10));
+  }
+
+  math::Kmeans kmeans(obs);
+  EXPECT_EQ(math::Kmeans::BRUTE_FORCE, kmeans.Assignment());
+
+  for (unsigned int threads : {1u, 4u})
+  {
+    kmeans.Threads(threads);
+    for (int k : {1, 2, 20})
+    {
+      kmeans.Assignment(math::Kmeans::BRUTE_FORCE);
+      std::vector<math::Vector3d> centroids;
+      std::vector<unsigned int> labels;
+      EXPECT_TRUE(kmeans.Cluster(k, centroids, labels));
+
+      kmeans.Assignment(math::Kmeans::HAMERLY);
+      EXPECT_EQ(math::Kmeans::HAMERLY, kmeans.Assignment());
+      std::vector<math::Vector3d> hamerlyCentroids;
+      std::vector<unsigned int> hamerlyLabels;
+      EXPECT_TRUE(kmeans.Cluster(k, hamerlyCentroids, hamerlyLabels));
+
+      // The results are exactly the same.
+      EXPECT_EQ(labels, hamerlyLabels);
+      ASSERT_EQ(centroids.size(), hamerlyCentroids.size());
+      for (std::size_t i = 0; i < centroids.size(); ++i)
+      {
+        EXPECT_DOUBLE_EQ(centroids[i].X(), hamerlyCentroids[i].X());
+        EXPECT_DOUBLE_EQ(centroids[i].Y(), hamerlyCentroids[i].Y());
+        EXPECT_DOUBLE_EQ(centroids[i].Z(), hamerlyCentroids[i].Z());
+      }
+    }
+  }
+}
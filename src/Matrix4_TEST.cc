@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "gz/math/Pose3.hh"
 #include "gz/math/Quaternion.hh"
 #include "gz/math/Matrix4.hh"
@@ -722,3 +724,37 @@ TEST(Matrix4dTest, LookAt)
                 .Pose(),
             math::Pose3d(1, 1, 1, IGN_PI_4, 0, IGN_PI));
 }
+
+/////////////////////////////////////////////////
+TEST(Matrix4dTest, TransformAffineBatch)
+{
+  math::Matrix4d mat(math::Pose3d(1, 2, 3, 0.1, 0.2, 0.3));
+
+  std::vector<math::Vector3d> points;
+  std::vector<double> x, y, z;
+  for (int i = 0; i < 100; ++i)
+  {
+    points.emplace_back(i, -i * 2.0, i * 0.5);
+    x.push_back(points.back().X());
+    y.push_back(points.back().Y());
+    z.push_back(points.back().Z());
+  }
+
+  std::vector<math::Vector3d> out(points.size());
+  EXPECT_TRUE(mat.TransformAffine(points.data(), out.data(), points.size()));
+  EXPECT_TRUE(mat.TransformAffine(x.data(), y.data(), z.data(), x.size(), 2));
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    math::Vector3d expected;
+    EXPECT_TRUE(mat.TransformAffine(points[i], expected));
+    EXPECT_EQ(expected, out[i]);
+    EXPECT_EQ(expected, math::Vector3d(x[i], y[i], z[i]));
+  }
+
+  // Not affine, output is unchanged
+  mat(3, 0) = 1.0;
+  std::vector<math::Vector3d> unchanged = out;
+  EXPECT_FALSE(mat.TransformAffine(points.data(), out.data(), points.size()));
+  EXPECT_EQ(unchanged, out);
+  EXPECT_FALSE(mat.TransformAffine(x.data(), y.data(), z.data(), x.size()));
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <vector>
+
+#include <gz/math/MovingWindowFilter.hh>
+#include <gz/math/MultiChannelMovingWindowFilter.hh>
+#include <gz/math/Rand.hh>
+
+using namespace gz;
+
+using Filter = math::MultiChannelMovingWindowFilter<double>;
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, Construct)
+{
+  Filter filter(3);
+  EXPECT_EQ(filter.Channels(), 3u);
+  EXPECT_EQ(filter.WindowSize(), 4u);
+  EXPECT_EQ(filter.WindowKernel(), Filter::MEAN);
+  EXPECT_FALSE(filter.WindowFilled());
+  ASSERT_EQ(filter.Values().size(), 3u);
+  for (std::size_t c = 0; c < 3; ++c)
+    EXPECT_DOUBLE_EQ(filter.Value(c), 0.0);
+
+  filter.SetWindowSize(0);
+  EXPECT_EQ(filter.WindowSize(), 1u);
+
+  // Input with too few values is ignored.
+  filter.Update(std::vector<double>{1.0, 2.0});
+  EXPECT_DOUBLE_EQ(filter.Value(0), 0.0);
+  filter.Update(std::vector<double>{1.0, 2.0, 3.0});
+  EXPECT_TRUE(filter.WindowFilled());
+  EXPECT_DOUBLE_EQ(filter.Value(2), 3.0);
+
+  Filter empty(0, 5, Filter::MEDIAN);
+  empty.Update(nullptr);
+  EXPECT_TRUE(empty.Values().empty());
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, MeanMatchesMovingWindowFilter)
+{
+  const std::size_t channels = 7;
+  const unsigned int window = 10;
+  Filter filter(channels, window);
+  std::vector<math::MovingWindowFilter<double>> single(channels);
+  for (auto &f : single)
+    f.SetWindowSize(window);
+
+  std::vector<double> values(channels);
+  for (int i = 0; i < 500; ++i)
+  {
+    for (std::size_t c = 0; c < channels; ++c)
+    {
+      values[c] = math::Rand::DblUniform(-100.0, 100.0) * (c + 1);
+      single[c].Update(values[c]);
+    }
+    filter.Update(values);
+    EXPECT_EQ(filter.WindowFilled(), single[0].WindowFilled());
+
+    for (std::size_t c = 0; c < channels; ++c)
+    {
+      EXPECT_NEAR(filter.Value(c), single[c].Value(),
+          1e-9 * (c + 1)) << "step " << i << " channel " << c;
+    }
+  }
+
+  filter.Reset();
+  EXPECT_FALSE(filter.WindowFilled());
+  EXPECT_DOUBLE_EQ(filter.Value(0), 0.0);
+  const double ones[channels] = {1, 1, 1, 1, 1, 1, 1};
+  filter.Update(ones);
+  EXPECT_DOUBLE_EQ(filter.Value(6), 1.0);
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, MeanRefresh)
+{
+  // A large value leaves the window, which would leave a rounding error in
+  // a running sum that is never recomputed.
+  Filter filter(1, 2);
+  const double big = 1e17;
+  filter.Update(&big);
+  for (int i = 0; i < 100; ++i)
+  {
+    const double one = 1.0;
+    filter.Update(&one);
+  }
+  EXPECT_DOUBLE_EQ(filter.Value(0), 1.0);
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, Median)
+{
+  const std::size_t channels = 5;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (const unsigned int window : {1u, 2u, 5u, 8u})
+  {
+    Filter filter(channels, window, Filter::MEDIAN);
+    std::vector<std::deque<double>> history(channels);
+    std::vector<double> values(channels);
+    for (int i = 0; i < 200; ++i)
+    {
+      for (std::size_t c = 0; c < channels; ++c)
+      {
+        // Repeated values and, on the last channel, NaN samples.
+        values[c] = std::round(math::Rand::DblUniform(-5.0, 5.0));
+        if (c == channels - 1 && i % 7 == 3)
+          values[c] = nan;
+        history[c].push_back(values[c]);
+        if (history[c].size() > window)
+          history[c].pop_front();
+      }
+      filter.Update(values.data());
+
+      for (std::size_t c = 0; c < channels; ++c)
+      {
+        std::vector<double> sorted(history[c].begin(), history[c].end());
+        std::sort(sorted.begin(), sorted.end(), [](double _a, double _b)
+            {
+              return _a < _b || (!std::isnan(_a) && std::isnan(_b));
+            });
+        const std::size_t n = sorted.size();
+        const double expected = n % 2 == 1 ? sorted[n / 2] :
+          (sorted[n / 2 - 1] + sorted[n / 2]) / 2.0;
+        if (std::isnan(expected))
+        {
+          EXPECT_TRUE(std::isnan(filter.Value(c)));
+        }
+        else
+        {
+          EXPECT_DOUBLE_EQ(filter.Value(c), expected)
+            << "window " << window << " step " << i << " channel " << c;
+        }
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, MedianRejectsOutliers)
+{
+  Filter filter(2, 3, Filter::MEDIAN);
+  filter.Update({1.0, -1.0});
+  filter.Update({1000.0, -1.0});
+  filter.Update({2.0, -1000.0});
+  EXPECT_DOUBLE_EQ(filter.Value(0), 2.0);
+  EXPECT_DOUBLE_EQ(filter.Value(1), -1.0);
+  EXPECT_TRUE(filter.WindowFilled());
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, Exponential)
+{
+  const unsigned int window = 9;
+  Filter filter(3, window, Filter::EXPONENTIAL);
+  EXPECT_EQ(filter.WindowKernel(), Filter::EXPONENTIAL);
+
+  const double alpha = 2.0 / (window + 1.0);
+  std::vector<double> expected(3);
+  std::vector<double> values(3);
+  for (unsigned int i = 0; i < 50; ++i)
+  {
+    for (std::size_t c = 0; c < 3; ++c)
+    {
+      values[c] = math::Rand::DblUniform(-1.0, 1.0);
+      expected[c] = i == 0 ? values[c] :
+        expected[c] + alpha * (values[c] - expected[c]);
+    }
+    filter.Update(values);
+    EXPECT_EQ(filter.WindowFilled(), i + 1 >= window);
+    for (std::size_t c = 0; c < 3; ++c)
+      EXPECT_NEAR(filter.Value(c), expected[c], 1e-12);
+  }
+
+  // A constant signal is followed exactly.
+  filter.Reset();
+  for (int i = 0; i < 20; ++i)
+    filter.Update({4.0, 4.0, 4.0});
+  EXPECT_DOUBLE_EQ(filter.Value(1), 4.0);
+}
+
+//////////////////////////////////////////////////
+TEST(MultiChannelMovingWindowFilterTest, Float)
+{
+  math::MultiChannelMovingWindowFilter<float> filter(3, 2);
+  filter.Update({1.0f, 2.0f, 3.0f});
+  filter.Update({3.0f, 4.0f, 5.0f});
+  filter.Update({5.0f, 6.0f, 7.0f});
+  EXPECT_FLOAT_EQ(filter.Value(0), 4.0f);
+  EXPECT_FLOAT_EQ(filter.Value(1), 5.0f);
+  EXPECT_FLOAT_EQ(filter.Value(2), 6.0f);
+}
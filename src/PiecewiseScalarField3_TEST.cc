@@ -17,7 +17,10 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include "gz/math/AdditivelySeparableScalarField3.hh"
 #include "gz/math/PiecewiseScalarField3.hh"
@@ -82,6 +85,113 @@ TEST(PiecewiseScalarField3Test, Evaluate)
   }
 }
 
+/////////////////////////////////////////////////
+TEST(PiecewiseScalarField3Test, EvaluateManyPieces)
+{
+  using ScalarField3dT = std::function<double(const math::Vector3d&)>;
+  using PiecewiseScalarField3dT = math::PiecewiseScalarField3d<ScalarField3dT>;
+
+  // A 12 x 10 grid of boxes, alternately closed and left closed, a slab
+  // above them that is unbounded in x and y, an empty region, and a box
+  // overlapping the others, which only takes effect outside of them.
+  std::vector<PiecewiseScalarField3dT::Piece> pieces;
+  auto field = [](double _value)
+  {
+    return [_value](const math::Vector3d &) { return _value; };
+  };
+  for (int i = 0; i < 12; ++i)
+  {
+    for (int j = 0; j < 10; ++j)
+    {
+      const double value = static_cast<double>(pieces.size());
+      if ((i + j) % 2 == 0)
+      {
+        pieces.push_back({math::Region3d::Closed(
+            i, j * 1.5, -5., i + 1., j * 1.5 + 1.5, 5.), field(value)});
+      }
+      else
+      {
+        pieces.push_back({math::Region3d(
+            math::Intervald::LeftClosed(i, i + 1.),
+            math::Intervald::LeftClosed(j * 1.5, j * 1.5 + 1.5),
+            math::Intervald::LeftClosed(-5., 5.)), field(value)});
+      }
+    }
+  }
+  const double inf = std::numeric_limits<double>::infinity();
+  pieces.push_back({math::Region3d(
+      math::Intervald::Unbounded, math::Intervald::Unbounded,
+      math::Intervald::Open(5., inf)), field(-1.)});
+  pieces.push_back({math::Region3d::Open(3., 3., 3., 3., 3., 3.),
+      field(-2.)});
+  pieces.push_back({math::Region3d::Closed(-2., -2., -6., 2., 2., 6.),
+      field(-3.)});
+
+  const PiecewiseScalarField3dT scalarField(pieces);
+
+  // Same as a linear search through the pieces
+  auto expected = [&](const math::Vector3d &_p)
+  {
+    for (const auto &piece : pieces)
+    {
+      if (piece.region.Contains(_p))
+        return piece.field(_p);
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+  };
+
+  std::vector<math::Vector3d> points;
+  for (int i = 0; i < 4000; ++i)
+  {
+    points.emplace_back(std::sin(i * 1.3) * 10. + 5.,
+                        std::cos(i * 0.7) * 10. + 7.,
+                        std::sin(i * 0.3) * 8.);
+  }
+  // Region boundaries
+  for (int i = -1; i <= 13; ++i)
+  {
+    for (int j = -1; j <= 11; ++j)
+    {
+      for (const double z : {-6., -5., 0., 5., 6.})
+        points.emplace_back(i, j * 1.5, z);
+    }
+  }
+  points.emplace_back(inf, 0., 6.);
+  points.emplace_back(-inf, inf, 0.);
+  points.emplace_back(0., 0., inf);
+  points.emplace_back(std::numeric_limits<double>::quiet_NaN(), 1., 1.);
+
+  std::vector<double> values;
+  scalarField.Evaluate(points, values);
+  ASSERT_EQ(points.size(), values.size());
+  std::size_t defined = 0;
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    const double value = expected(points[i]);
+    if (std::isnan(value))
+    {
+      EXPECT_TRUE(std::isnan(scalarField(points[i]))) << points[i];
+      EXPECT_TRUE(std::isnan(values[i])) << points[i];
+      continue;
+    }
+    ++defined;
+    EXPECT_EQ(value, scalarField(points[i])) << points[i];
+    EXPECT_EQ(value, values[i]) << points[i];
+  }
+  EXPECT_GT(defined, points.size() / 4);
+
+  std::vector<double> threaded;
+  scalarField.Evaluate(points, threaded, 4);
+  ASSERT_EQ(values.size(), threaded.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    if (!std::isnan(values[i]))
+    {
+      EXPECT_EQ(values[i], threaded[i]);
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 TEST(PiecewiseScalarField3Test, Minimum)
 {
@@ -15,7 +15,9 @@
  *
 */
 #include <gtest/gtest.h>
+#include <cmath>
 #include <ostream>
+#include <vector>
 
 #include "gz/math/Polynomial3.hh"
 
@@ -64,6 +66,60 @@ TEST(Polynomial3Test, Evaluate)
   }
 }
 
+/////////////////////////////////////////////////
+TEST(Polynomial3Test, EvaluateBatch)
+{
+  const std::vector<math::Vector4d> coeffs = {
+    math::Vector4d(0., 0., 0., 1.),
+    math::Vector4d(0., 0., -2., 1.),
+    math::Vector4d(0., 1.5, 0., -1.),
+    math::Vector4d(-0.5, 1., 2., 3.)};
+  std::vector<double> x = {
+    -math::INF_D, -1e3, -1., -0.25, 0., 0.3, 1., 7.5, 1e3, math::INF_D,
+    math::NAN_D};
+  for (int i = 0; i < 5000; ++i)
+    x.push_back(std::sin(i) * 100.);
+
+  for (const math::Vector4d &c : coeffs)
+  {
+    const math::Polynomial3d p(c);
+    for (const unsigned int threads : {1u, 4u})
+    {
+      std::vector<double> y(x.size());
+      p.Evaluate(x.data(), y.data(), x.size(), threads);
+
+      std::vector<double> inPlace = x;
+      p.Evaluate(inPlace, threads);
+
+      for (std::size_t i = 0; i < x.size(); ++i)
+      {
+        if (std::isnan(x[i]))
+        {
+          EXPECT_TRUE(std::isnan(y[i]));
+          EXPECT_TRUE(std::isnan(inPlace[i]));
+          continue;
+        }
+        EXPECT_DOUBLE_EQ(p(x[i]), y[i]) << c << " " << x[i];
+        EXPECT_DOUBLE_EQ(p(x[i]), inPlace[i]) << c << " " << x[i];
+      }
+    }
+  }
+
+  // Single precision
+  const math::Polynomial3f pf(math::Vector4f(1.f, -2.f, 0.5f, 3.f));
+  std::vector<float> xf = {-math::INF_F, -2.f, 0.f, 0.25f, 3.f, math::INF_F};
+  std::vector<float> yf = xf;
+  pf.Evaluate(yf);
+  for (std::size_t i = 0; i < xf.size(); ++i)
+    EXPECT_FLOAT_EQ(pf(xf[i]), yf[i]) << xf[i];
+
+  // Empty input
+  const math::Polynomial3d p(math::Vector4d::One);
+  std::vector<double> empty;
+  p.Evaluate(empty);
+  EXPECT_TRUE(empty.empty());
+}
+
 /////////////////////////////////////////////////
 TEST(Polynomial3Test, Minimum)
 {
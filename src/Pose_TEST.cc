@@ -17,6 +17,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "gz/math/Helpers.hh"
 #include "gz/math/Pose3.hh"
 
@@ -230,3 +232,41 @@ TEST(PoseTest, SetPoseElements)
   EXPECT_DOUBLE_EQ(pose.Y(), 12);
   EXPECT_DOUBLE_EQ(pose.Z(), 13);
 }
+
+/////////////////////////////////////////////////
+TEST(PoseTest, CoordPositionAddBatch)
+{
+  const math::Pose3d pose(1, -2, 3, 0.3, -1.2, 2.5);
+
+  std::vector<math::Vector3d> points;
+  std::vector<double> x, y, z;
+  for (int i = 0; i < 10000; ++i)
+  {
+    math::Vector3d point(i * 0.01, -i * 0.02, 5.0 - i * 0.003);
+    points.push_back(point);
+    x.push_back(point.X());
+    y.push_back(point.Y());
+    z.push_back(point.Z());
+  }
+
+  // Array of structures, out of place
+  std::vector<math::Vector3d> out(points.size());
+  pose.CoordPositionAdd(points.data(), out.data(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(pose.CoordPositionAdd(points[i]), out[i]);
+
+  // Array of structures, in place and split across threads
+  std::vector<math::Vector3d> inPlace = points;
+  pose.CoordPositionAdd(inPlace, 4);
+  EXPECT_EQ(out, inPlace);
+
+  // Structure of arrays, split across threads
+  pose.CoordPositionAdd(x.data(), y.data(), z.data(), x.size(), 3);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    EXPECT_EQ(out[i], math::Vector3d(x[i], y[i], z[i]));
+
+  // Non-normalized rotation
+  math::Pose3d scaled(pose.Pos(), pose.Rot() * 3.0);
+  scaled.CoordPositionAdd(points);
+  EXPECT_EQ(out, points);
+}
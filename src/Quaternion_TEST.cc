@@ -687,3 +687,21 @@ TEST(QuaternionTest, From2Axes)
   EXPECT_TRUE(math::equal(q2.Z(), 0.0));
 }
 
+/////////////////////////////////////////////////
+TEST(QuaternionTest, MultiplyMatchesGeneric)
+{
+  // Quaternion<double> may use a SIMD specialization of operator*, compare
+  // it with the generic implementation used by other types.
+  const math::Quaterniond q1(0.1, -0.7, 0.3, 2.5);
+  const math::Quaterniond q2(-1.2, 0.4, 0.9, -0.05);
+  const math::Quaterniond result = q1 * q2;
+
+  const math::Quaternion<long double> l1(q1.W(), q1.X(), q1.Y(), q1.Z());
+  const math::Quaternion<long double> l2(q2.W(), q2.X(), q2.Y(), q2.Z());
+  const math::Quaternion<long double> expected = l1 * l2;
+
+  EXPECT_NEAR(result.W(), static_cast<double>(expected.W()), 1e-12);
+  EXPECT_NEAR(result.X(), static_cast<double>(expected.X()), 1e-12);
+  EXPECT_NEAR(result.Y(), static_cast<double>(expected.Y()), 1e-12);
+  EXPECT_NEAR(result.Z(), static_cast<double>(expected.Z()), 1e-12);
+}
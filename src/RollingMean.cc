@@ -15,29 +15,317 @@
  *
 */
 
-#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
-#include <deque>
+#include <vector>
 #include "gz/math/RollingMean.hh"
 
 using namespace gz::math;
 
+namespace
+{
+/// \brief Number of times the window is replaced between two refreshes of
+/// the running sums.
+constexpr size_t kRefreshWindows = 16;
+
+/// \brief A value of the window and its sample number.
+struct Sample
+{
+  /// \brief The value.
+  double value;
+
+  /// \brief Number of values pushed before this one since the last clear.
+  uint64_t number;
+};
+
+/// \brief Fixed capacity double ended queue of samples, used as the
+/// monotonic queue that tracks the minimum or maximum of the window.
+class SampleQueue
+{
+  /// \brief Set the capacity and remove all the samples.
+  /// \param[in] _capacity The capacity.
+  public: void Reset(const size_t _capacity)
+  {
+    this->items.assign(_capacity, Sample{0.0, 0});
+    this->Clear();
+  }
+
+  /// \brief Remove all the samples.
+  public: void Clear()
+  {
+    this->head = 0;
+    this->size = 0;
+  }
+
+  /// \brief Check if the queue is empty.
+  /// \return True if there are no samples.
+  public: bool Empty() const
+  {
+    return this->size == 0;
+  }
+
+  /// \brief Get the oldest sample.
+  /// \return The oldest sample.
+  public: const Sample &Front() const
+  {
+    return this->items[this->head];
+  }
+
+  /// \brief Get the newest sample.
+  /// \return The newest sample.
+  public: const Sample &Back() const
+  {
+    return this->items[this->Index(this->size - 1)];
+  }
+
+  /// \brief Remove the oldest sample.
+  public: void PopFront()
+  {
+    this->head = this->Index(1);
+    --this->size;
+  }
+
+  /// \brief Remove the newest sample.
+  public: void PopBack()
+  {
+    --this->size;
+  }
+
+  /// \brief Add a sample, there must be room for it.
+  /// \param[in] _sample The sample.
+  public: void PushBack(const Sample &_sample)
+  {
+    this->items[this->Index(this->size)] = _sample;
+    ++this->size;
+  }
+
+  /// \brief Get the storage index of a position in the queue.
+  /// \param[in] _offset Position from the front, at most the capacity.
+  /// \return The index in items.
+  private: size_t Index(const size_t _offset) const
+  {
+    const size_t index = this->head + _offset;
+    return index >= this->items.size() ? index - this->items.size() : index;
+  }
+
+  /// \brief Ring buffer of samples.
+  private: std::vector<Sample> items;
+
+  /// \brief Index of the oldest sample.
+  private: size_t head{0};
+
+  /// \brief Number of samples.
+  private: size_t size{0};
+};
+
+/// \brief Add a value to a compensated sum (Neumaier's variant of Kahan
+/// summation), which stays accurate when large values leave the window.
+/// \param[in,out] _sum The sum.
+/// \param[in,out] _compensation The accumulated rounding error of _sum.
+/// \param[in] _value The value to add.
+void CompensatedAdd(double &_sum, double &_compensation, const double _value)
+{
+  const double t = _sum + _value;
+  if (std::abs(_sum) >= std::abs(_value))
+    _compensation += (_sum - t) + _value;
+  else
+    _compensation += (_value - t) + _sum;
+  _sum = t;
+}
+}
+
 /// \brief Private data
 class gz::math::RollingMeanPrivate
 {
+  /// \brief Allocate the buffers for a window size and clear the data.
+  /// \param[in] _windowSize The window size.
+  public: void Reset(const size_t _windowSize)
+  {
+    this->windowSize = _windowSize;
+    this->values.assign(_windowSize, 0.0);
+    this->minQueue.Reset(_windowSize);
+    this->maxQueue.Reset(_windowSize);
+    this->Clear();
+  }
+
+  /// \brief Remove all the values.
+  public: void Clear()
+  {
+    this->count = 0;
+    this->next = 0;
+    this->pushed = 0;
+    this->pushesSinceRefresh = 0;
+    this->nanCount = 0;
+    this->posInfCount = 0;
+    this->negInfCount = 0;
+    this->finiteCount = 0;
+    this->ClearSums();
+    this->minQueue.Clear();
+    this->maxQueue.Clear();
+  }
+
+  /// \brief Add a value that entered the window to the running sums.
+  /// \param[in] _value The value.
+  public: void Insert(const double _value)
+  {
+    if (std::isfinite(_value))
+    {
+      if (this->finiteCount++ == 0)
+        this->shift = _value;
+      CompensatedAdd(this->sum, this->compensation, _value);
+      const double delta = _value - this->shift;
+      this->shiftedSum += delta;
+      this->shiftedSquares += delta * delta;
+    }
+    else if (std::isnan(_value))
+    {
+      ++this->nanCount;
+    }
+    else
+    {
+      ++(_value > 0 ? this->posInfCount : this->negInfCount);
+    }
+  }
+
+  /// \brief Remove a value that left the window from the running sums.
+  /// \param[in] _value The value.
+  public: void Remove(const double _value)
+  {
+    if (std::isfinite(_value))
+    {
+      if (--this->finiteCount == 0)
+      {
+        this->ClearSums();
+        return;
+      }
+      CompensatedAdd(this->sum, this->compensation, -_value);
+      const double delta = _value - this->shift;
+      this->shiftedSum -= delta;
+      this->shiftedSquares -= delta * delta;
+    }
+    else if (std::isnan(_value))
+    {
+      --this->nanCount;
+    }
+    else
+    {
+      --(_value > 0 ? this->posInfCount : this->negInfCount);
+    }
+  }
+
+  /// \brief Reset the running sums.
+  public: void ClearSums()
+  {
+    this->sum = 0.0;
+    this->compensation = 0.0;
+    this->shift = 0.0;
+    this->shiftedSum = 0.0;
+    this->shiftedSquares = 0.0;
+  }
+
+  /// \brief Recompute the running sums from the values in the window, to
+  /// discard the rounding errors accumulated by Insert and Remove. This is
+  /// done once every kRefreshWindows * windowSize pushes, so it costs O(1)
+  /// per push.
+  public: void Refresh()
+  {
+    this->pushesSinceRefresh = 0;
+    this->ClearSums();
+    if (this->finiteCount == 0)
+      return;
+
+    for (size_t i = 0; i < this->count; ++i)
+    {
+      if (std::isfinite(this->values[i]))
+        CompensatedAdd(this->sum, this->compensation, this->values[i]);
+    }
+    this->shift = (this->sum + this->compensation) / this->finiteCount;
+    for (size_t i = 0; i < this->count; ++i)
+    {
+      if (std::isfinite(this->values[i]))
+      {
+        const double delta = this->values[i] - this->shift;
+        this->shiftedSum += delta;
+        this->shiftedSquares += delta * delta;
+      }
+    }
+  }
+
+  /// \brief Check if the window holds values that are not finite.
+  /// \return True if there are NaN or infinite values.
+  public: bool HasNonFinite() const
+  {
+    return this->nanCount + this->posInfCount + this->negInfCount > 0;
+  }
+
   /// \brief The window size
   public: size_t windowSize{10};
 
-  /// \brief The values.
-  public: std::deque<double> values;
+  /// \brief Ring buffer holding the values of the window.
+  public: std::vector<double> values;
+
+  /// \brief Number of values in the window.
+  public: size_t count{0};
+
+  /// \brief Index in values where the next value is written, which is
+  /// the index of the oldest value once the window is full.
+  public: size_t next{0};
+
+  /// \brief Number of values pushed since the last clear.
+  public: uint64_t pushed{0};
+
+  /// \brief Number of values pushed since the running sums were last
+  /// recomputed.
+  public: size_t pushesSinceRefresh{0};
+
+  /// \brief Number of NaN values in the window.
+  public: size_t nanCount{0};
+
+  /// \brief Number of positive infinite values in the window.
+  public: size_t posInfCount{0};
+
+  /// \brief Number of negative infinite values in the window.
+  public: size_t negInfCount{0};
+
+  /// \brief Number of finite values in the window.
+  public: size_t finiteCount{0};
+
+  /// \brief Compensated sum of the finite values in the window.
+  public: double sum{0.0};
+
+  /// \brief Rounding error of sum.
+  public: double compensation{0.0};
+
+  /// \brief Value subtracted from the finite values in the window before
+  /// summing them and their squares for the variance, which avoids
+  /// cancellation when their mean is large compared to their spread. It is
+  /// set to the mean whenever the sums are recomputed.
+  public: double shift{0.0};
+
+  /// \brief Sum of the finite values in the window minus shift.
+  public: double shiftedSum{0.0};
+
+  /// \brief Sum of the squares of the finite values in the window minus
+  /// shift.
+  public: double shiftedSquares{0.0};
+
+  /// \brief Samples that may become the minimum of the window, with
+  /// increasing values from front to back.
+  public: SampleQueue minQueue;
+
+  /// \brief Samples that may become the maximum of the window, with
+  /// decreasing values from front to back.
+  public: SampleQueue maxQueue;
 };
 
 //////////////////////////////////////////////////
 RollingMean::RollingMean(size_t _windowSize)
   : dataPtr(new RollingMeanPrivate)
 {
-  if (_windowSize > 0)
-    this->dataPtr->windowSize = _windowSize;
+  this->dataPtr->Reset(_windowSize > 0 ? _windowSize :
+      this->dataPtr->windowSize);
 }
 
 //////////////////////////////////////////////////
@@ -48,47 +336,107 @@ RollingMean::~RollingMean()
 //////////////////////////////////////////////////
 double RollingMean::Mean() const
 {
-  if (!this->dataPtr->values.empty())
+  const RollingMeanPrivate &d = *this->dataPtr;
+  if (d.count == 0 || d.nanCount > 0 ||
+      (d.posInfCount > 0 && d.negInfCount > 0))
   {
-    return std::accumulate(
-        this->dataPtr->values.begin(), this->dataPtr->values.end(), 0.0) /
-      this->dataPtr->values.size();
+    return std::numeric_limits<double>::quiet_NaN();
   }
+  if (d.posInfCount > 0)
+    return std::numeric_limits<double>::infinity();
+  if (d.negInfCount > 0)
+    return -std::numeric_limits<double>::infinity();
 
-  return std::numeric_limits<double>::quiet_NaN();
+  return (d.sum + d.compensation) / d.count;
+}
+
+//////////////////////////////////////////////////
+double RollingMean::Variance() const
+{
+  const RollingMeanPrivate &d = *this->dataPtr;
+  if (d.count == 0 || d.HasNonFinite())
+    return std::numeric_limits<double>::quiet_NaN();
+  if (d.count < 2)
+    return 0.0;
+
+  // Rounding errors may make the sum of squared deviations slightly
+  // negative
+  const double m2 =
+      d.shiftedSquares - d.shiftedSum * d.shiftedSum / d.count;
+  return std::max(0.0, m2) / (d.count - 1);
+}
+
+//////////////////////////////////////////////////
+double RollingMean::Min() const
+{
+  const RollingMeanPrivate &d = *this->dataPtr;
+  if (d.count == 0 || d.nanCount > 0)
+    return std::numeric_limits<double>::quiet_NaN();
+  return d.minQueue.Front().value;
+}
+
+//////////////////////////////////////////////////
+double RollingMean::Max() const
+{
+  const RollingMeanPrivate &d = *this->dataPtr;
+  if (d.count == 0 || d.nanCount > 0)
+    return std::numeric_limits<double>::quiet_NaN();
+  return d.maxQueue.Front().value;
 }
 
 //////////////////////////////////////////////////
 size_t RollingMean::Count() const
 {
-  return this->dataPtr->values.size();
+  return this->dataPtr->count;
 }
 
 //////////////////////////////////////////////////
 void RollingMean::Push(double _value)
 {
-  this->dataPtr->values.push_back(_value);
-  while (this->dataPtr->values.size() > this->dataPtr->windowSize &&
-         !this->dataPtr->values.empty())
+  RollingMeanPrivate &d = *this->dataPtr;
+  if (d.count == d.windowSize)
+    d.Remove(d.values[d.next]);
+  else
+    ++d.count;
+
+  d.values[d.next] = _value;
+  if (++d.next == d.windowSize)
+    d.next = 0;
+  d.Insert(_value);
+
+  // Drop the samples that left the window from the monotonic queues, then
+  // the ones that can no longer be the minimum or maximum.
+  const Sample sample{_value, d.pushed++};
+  const uint64_t oldest = d.pushed - d.count;
+  if (!d.minQueue.Empty() && d.minQueue.Front().number < oldest)
+    d.minQueue.PopFront();
+  if (!d.maxQueue.Empty() && d.maxQueue.Front().number < oldest)
+    d.maxQueue.PopFront();
+  if (!std::isnan(_value))
   {
-    this->dataPtr->values.pop_front();
+    while (!d.minQueue.Empty() && d.minQueue.Back().value >= _value)
+      d.minQueue.PopBack();
+    d.minQueue.PushBack(sample);
+    while (!d.maxQueue.Empty() && d.maxQueue.Back().value <= _value)
+      d.maxQueue.PopBack();
+    d.maxQueue.PushBack(sample);
   }
+
+  if (++d.pushesSinceRefresh >= kRefreshWindows * d.windowSize)
+    d.Refresh();
 }
 
 //////////////////////////////////////////////////
 void RollingMean::Clear()
 {
-  this->dataPtr->values.clear();
+  this->dataPtr->Clear();
 }
 
 //////////////////////////////////////////////////
 void RollingMean::SetWindowSize(size_t _windowSize)
 {
   if (_windowSize > 0)
-  {
-    this->dataPtr->windowSize = _windowSize;
-    this->Clear();
-  }
+    this->dataPtr->Reset(_windowSize);
 }
 
 //////////////////////////////////////////////////
@@ -17,6 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <numeric>
+
 #include "gz/math/Helpers.hh"
 #include "gz/math/RollingMean.hh"
 
@@ -55,3 +61,106 @@ TEST(RollingMeanTest, RollingMean)
   mean.SetWindowSize(2);
   EXPECT_EQ(0u, mean.Count());
 }
+
+/////////////////////////////////////////////////
+TEST(RollingMeanTest, Statistics)
+{
+  math::RollingMean mean(3);
+  EXPECT_TRUE(math::isnan(mean.Variance()));
+  EXPECT_TRUE(math::isnan(mean.Min()));
+  EXPECT_TRUE(math::isnan(mean.Max()));
+
+  mean.Push(2.0);
+  EXPECT_DOUBLE_EQ(0.0, mean.Variance());
+  EXPECT_DOUBLE_EQ(2.0, mean.Min());
+  EXPECT_DOUBLE_EQ(2.0, mean.Max());
+
+  mean.Push(4.0);
+  mean.Push(9.0);
+  EXPECT_DOUBLE_EQ(5.0, mean.Mean());
+  EXPECT_DOUBLE_EQ(13.0, mean.Variance());
+  EXPECT_DOUBLE_EQ(2.0, mean.Min());
+  EXPECT_DOUBLE_EQ(9.0, mean.Max());
+
+  // 2 leaves the window
+  mean.Push(3.0);
+  EXPECT_DOUBLE_EQ(16.0 / 3.0, mean.Mean());
+  EXPECT_DOUBLE_EQ(3.0, mean.Min());
+  EXPECT_DOUBLE_EQ(9.0, mean.Max());
+
+  // Non-finite values, until they leave the window
+  const double inf = std::numeric_limits<double>::infinity();
+  mean.Push(inf);
+  EXPECT_EQ(inf, mean.Mean());
+  EXPECT_TRUE(math::isnan(mean.Variance()));
+  EXPECT_DOUBLE_EQ(3.0, mean.Min());
+  EXPECT_EQ(inf, mean.Max());
+  mean.Push(-inf);
+  EXPECT_TRUE(math::isnan(mean.Mean()));
+  EXPECT_EQ(-inf, mean.Min());
+  mean.Push(math::NAN_D);
+  EXPECT_TRUE(math::isnan(mean.Mean()));
+  EXPECT_TRUE(math::isnan(mean.Min()));
+  EXPECT_TRUE(math::isnan(mean.Max()));
+  mean.Push(1.0);
+  mean.Push(2.0);
+  EXPECT_TRUE(math::isnan(mean.Mean()));
+  mean.Push(6.0);
+  EXPECT_DOUBLE_EQ(3.0, mean.Mean());
+  EXPECT_DOUBLE_EQ(7.0, mean.Variance());
+  EXPECT_DOUBLE_EQ(1.0, mean.Min());
+  EXPECT_DOUBLE_EQ(6.0, mean.Max());
+}
+
+/////////////////////////////////////////////////
+TEST(RollingMeanTest, MatchesWindow)
+{
+  for (const size_t windowSize : {1u, 2u, 7u, 64u})
+  {
+    math::RollingMean mean(windowSize);
+    std::deque<double> window;
+    for (int i = 0; i < 1000; ++i)
+    {
+      const double value = std::sin(i * 0.37) * 100.0 + (i % 11);
+      mean.Push(value);
+      window.push_back(value);
+      if (window.size() > windowSize)
+        window.pop_front();
+
+      ASSERT_EQ(window.size(), mean.Count());
+      const double expectedMean =
+          std::accumulate(window.begin(), window.end(), 0.0) / window.size();
+      double m2 = 0.0;
+      for (const double v : window)
+        m2 += (v - expectedMean) * (v - expectedMean);
+      const double expectedVariance =
+          window.size() > 1 ? m2 / (window.size() - 1) : 0.0;
+
+      EXPECT_NEAR(expectedMean, mean.Mean(), 1e-11) << windowSize << " " << i;
+      EXPECT_NEAR(expectedVariance, mean.Variance(), 1e-8)
+        << windowSize << " " << i;
+      EXPECT_EQ(*std::min_element(window.begin(), window.end()), mean.Min());
+      EXPECT_EQ(*std::max_element(window.begin(), window.end()), mean.Max());
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(RollingMeanTest, Precision)
+{
+  // A large value leaving the window does not leave a rounding error
+  // behind in the running sum.
+  math::RollingMean mean(4);
+  mean.Push(1e17);
+  for (int i = 0; i < 3; ++i)
+    mean.Push(0.1);
+  mean.Push(0.1);
+  EXPECT_DOUBLE_EQ(0.1, mean.Mean());
+  EXPECT_NEAR(0.0, mean.Variance(), 1e-15);
+
+  // No drift over many values
+  mean.SetWindowSize(100);
+  for (int i = 0; i < 1000000; ++i)
+    mean.Push(0.1 * (i % 100));
+  EXPECT_NEAR(4.95, mean.Mean(), 1e-12);
+}
@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+
 #include "gz/math/Quaternion.hh"
 #include "gz/math/RotationSpline.hh"
 #include "RotationSplinePrivate.hh"
@@ -21,6 +23,117 @@
 using namespace gz;
 using namespace math;
 
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Check if a rotation spline is closed.
+/// \param[in] _data Rotation spline data, with at least one point.
+/// \return True if the first and last points are the same.
+bool IsClosed(const RotationSplinePrivate &_data)
+{
+  return _data.points.front() == _data.points.back();
+}
+
+/////////////////////////////////////////////////
+/// \brief Compute the tangent of one point, see
+/// RotationSpline::RecalcTangents.
+/// \param[in,out] _data Rotation spline data, with at least two points and
+/// as many tangents.
+/// \param[in] _i Index of the point.
+/// \param[in] _isClosed Whether the spline is closed.
+void ComputeTangent(RotationSplinePrivate &_data, const size_t _i,
+    const bool _isClosed)
+{
+  const size_t numPoints = _data.points.size();
+  const Quaterniond &p = _data.points[_i];
+  const Quaterniond invp = p.Inverse();
+  Quaterniond part1, part2;
+
+  if (_i == 0)
+  {
+    // special case start
+    part1 = (invp * _data.points[_i+1]).Log();
+    if (_isClosed)
+    {
+      // Use numPoints-2 since numPoints-1 == end == start == this one
+      part2 = (invp * _data.points[numPoints-2]).Log();
+    }
+    else
+    {
+      part2 = (invp * p).Log();
+    }
+  }
+  else if (_i == numPoints-1)
+  {
+    // special case end
+    if (_isClosed)
+    {
+      // Wrap to [1] (not [0], this is the same as end == this one)
+      part1 = (invp * _data.points[1]).Log();
+    }
+    else
+    {
+      part1 = (invp * p).Log();
+    }
+    part2 = (invp * _data.points[_i-1]).Log();
+  }
+  else
+  {
+    part1 = (invp * _data.points[_i+1]).Log();
+    part2 = (invp * _data.points[_i-1]).Log();
+  }
+
+  const Quaterniond preExp = (part1 + part2) * -0.25;
+  _data.tangents[_i] = p * preExp.Exp();
+}
+
+/////////////////////////////////////////////////
+/// \brief Update the tangents after a control point was added or changed.
+/// Only the tangents that depend on the point are recomputed: the ones of
+/// its neighbours, and the ones of the end points, which depend on each
+/// other when the spline is closed.
+/// \param[in,out] _data Rotation spline data.
+/// \param[in] _index Index of the point that changed.
+void PointChanged(RotationSplinePrivate &_data, const size_t _index)
+{
+  if (!_data.autoCalc)
+  {
+    _data.tangentsDirty = true;
+    return;
+  }
+
+  const size_t numPoints = _data.points.size();
+  if (numPoints < 2)
+    return;
+
+  if (_data.tangentsDirty || _data.tangents.size() + 1 < numPoints)
+  {
+    // Points changed while tangents were not computed
+    _data.tangents.resize(numPoints);
+    const bool isClosed = IsClosed(_data);
+    for (size_t i = 0; i < numPoints; ++i)
+      ComputeTangent(_data, i, isClosed);
+    _data.tangentsDirty = false;
+    return;
+  }
+
+  _data.tangents.resize(numPoints);
+  const bool isClosed = IsClosed(_data);
+  const size_t candidates[] =
+    {0, _index > 0 ? _index - 1 : 0, _index,
+     std::min(_index + 1, numPoints - 1), numPoints - 1};
+  size_t last = numPoints;
+  for (const size_t i : candidates)
+  {
+    // The candidates are sorted, skip duplicates.
+    if (i == last)
+      continue;
+    ComputeTangent(_data, i, isClosed);
+    last = i;
+  }
+}
+}
+
 /////////////////////////////////////////////////
 RotationSpline::RotationSpline()
 : dataPtr(new RotationSplinePrivate)
@@ -38,8 +151,7 @@ RotationSpline::~RotationSpline()
 void RotationSpline::AddPoint(const Quaterniond &_p)
 {
   this->dataPtr->points.push_back(_p);
-  if (this->dataPtr->autoCalc)
-    this->RecalcTangents();
+  PointChanged(*this->dataPtr, this->dataPtr->points.size() - 1);
 }
 
 /////////////////////////////////////////////////
@@ -101,9 +213,6 @@ void RotationSpline::RecalcTangents()
   //
   // Assume endpoint tangents are parallel with line with neighbour
 
-  unsigned int i;
-  bool isClosed;
-
   size_t numPoints = this->dataPtr->points.size();
 
   if (numPoints < 2)
@@ -113,55 +222,11 @@ void RotationSpline::RecalcTangents()
   }
 
   this->dataPtr->tangents.resize(numPoints);
+  const bool isClosed = IsClosed(*this->dataPtr);
 
-  if (this->dataPtr->points[0] == this->dataPtr->points[numPoints-1])
-    isClosed = true;
-  else
-    isClosed = false;
-
-  Quaterniond invp, part1, part2, preExp;
-  for (i = 0; i < numPoints; ++i)
-  {
-    Quaterniond &p = this->dataPtr->points[i];
-    invp = p.Inverse();
-
-    if (i == 0)
-    {
-      // special case start
-      part1 = (invp * this->dataPtr->points[i+1]).Log();
-      if (isClosed)
-      {
-        // Use numPoints-2 since numPoints-1 == end == start == this one
-        part2 = (invp * this->dataPtr->points[numPoints-2]).Log();
-      }
-      else
-      {
-        part2 = (invp * p).Log();
-      }
-    }
-    else if (i == numPoints-1)
-    {
-      // special case end
-      if (isClosed)
-      {
-        // Wrap to [1] (not [0], this is the same as end == this one)
-        part1 = (invp * this->dataPtr->points[1]).Log();
-      }
-      else
-      {
-        part1 = (invp * p).Log();
-      }
-      part2 = (invp * this->dataPtr->points[i-1]).Log();
-    }
-    else
-    {
-      part1 = (invp * this->dataPtr->points[i+1]).Log();
-      part2 = (invp * this->dataPtr->points[i-1]).Log();
-    }
-
-    preExp = (part1 + part2) * -0.25;
-    this->dataPtr->tangents[i] = p * preExp.Exp();
-  }
+  for (size_t i = 0; i < numPoints; ++i)
+    ComputeTangent(*this->dataPtr, i, isClosed);
+  this->dataPtr->tangentsDirty = false;
 }
 
 /////////////////////////////////////////////////
@@ -188,6 +253,7 @@ void RotationSpline::Clear()
 {
   this->dataPtr->points.clear();
   this->dataPtr->tangents.clear();
+  this->dataPtr->tangentsDirty = false;
 }
 
 /////////////////////////////////////////////////
@@ -198,8 +264,7 @@ bool RotationSpline::UpdatePoint(const unsigned int _index,
     return false;
 
   this->dataPtr->points[_index] = _value;
-  if (this->dataPtr->autoCalc)
-    this->RecalcTangents();
+  PointChanged(*this->dataPtr, _index);
 
   return true;
 }
@@ -21,6 +21,6 @@ using namespace math;
 
 /////////////////////////////////////////////////
 RotationSplinePrivate::RotationSplinePrivate()
-: autoCalc(true)
+: autoCalc(true), tangentsDirty(false)
 {
 }
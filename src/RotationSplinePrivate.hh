@@ -38,6 +38,10 @@ namespace ignition
       /// updated
       public: bool autoCalc;
 
+      /// \brief True if the control points changed since the tangents were
+      /// last recalculated, while autoCalc was disabled.
+      public: bool tangentsDirty;
+
       /// \brief the control points
       public: std::vector<Quaterniond> points;
 
@@ -97,3 +97,67 @@ TEST(RotationSplineTest, RecalcTangents)
   EXPECT_EQ(s.Interpolate(1, 0.5),
       math::Quaterniond(0.987225, 0.077057, 0.11624, 0.077057));
 }
+
+/////////////////////////////////////////////////
+/// \brief Check that a spline built point by point is the same as one whose
+/// tangents are computed once after all the points are added.
+/// \param[in] _s Spline built point by point.
+void ExpectSameAsRecalc(math::RotationSpline &_s)
+{
+  math::RotationSpline ref;
+  ref.AutoCalculate(false);
+  for (unsigned int i = 0; i < _s.PointCount(); ++i)
+    ref.AddPoint(_s.Point(i));
+  ref.RecalcTangents();
+
+  ASSERT_EQ(ref.PointCount(), _s.PointCount());
+  for (unsigned int i = 0; i + 1 < _s.PointCount(); ++i)
+  {
+    for (const double t : {0.25, 0.5, 0.75})
+    {
+      const math::Quaterniond expected = ref.Interpolate(i, t);
+      const math::Quaterniond actual = _s.Interpolate(i, t);
+      EXPECT_DOUBLE_EQ(expected.W(), actual.W()) << i << " " << t;
+      EXPECT_DOUBLE_EQ(expected.X(), actual.X()) << i << " " << t;
+      EXPECT_DOUBLE_EQ(expected.Y(), actual.Y()) << i << " " << t;
+      EXPECT_DOUBLE_EQ(expected.Z(), actual.Z()) << i << " " << t;
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(RotationSplineTest, IncrementalTangents)
+{
+  math::RotationSpline s;
+  for (int i = 0; i < 20; ++i)
+  {
+    s.AddPoint(math::Quaterniond(0.1 * i, 0.05 * (i % 3), -0.07 * i));
+    if (i > 0)
+      ExpectSameAsRecalc(s);
+  }
+
+  // Update the ends and points in the middle
+  for (const unsigned int index : {0u, 1u, 10u, 18u, 19u})
+  {
+    EXPECT_TRUE(s.UpdatePoint(index, math::Quaterniond(0.2, -0.1, index)));
+    ExpectSameAsRecalc(s);
+  }
+
+  // Close the loop, then update its ends and their neighbours
+  s.AddPoint(s.Point(0));
+  ExpectSameAsRecalc(s);
+  for (const unsigned int index : {1u, 19u, 0u})
+  {
+    EXPECT_TRUE(s.UpdatePoint(index, math::Quaterniond(-0.3, 0.1, index)));
+    EXPECT_TRUE(s.UpdatePoint(20, s.Point(0)));
+    ExpectSameAsRecalc(s);
+  }
+
+  // Changes made while tangents are not calculated automatically
+  s.AutoCalculate(false);
+  s.UpdatePoint(5, math::Quaterniond(0.5, 0.5, 0.5));
+  s.AddPoint(math::Quaterniond(0, 0, 1));
+  s.AutoCalculate(true);
+  s.UpdatePoint(21, math::Quaterniond(0, 0.1, 1));
+  ExpectSameAsRecalc(s);
+}
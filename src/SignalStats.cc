@@ -14,14 +14,376 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <typeinfo>
+#include <utility>
 #include <gz/math/SignalStats.hh>
+#include <gz/math/detail/ParallelFor.hh>
 #include "SignalStatsPrivate.hh"
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+  /// \brief Number of samples that SignalStats::InsertData passes to each
+  /// statistic at a time. The block stays in the L1 cache while every
+  /// statistic reads it.
+  constexpr std::size_t kBlockSize = 1024;
+
+  /// \brief Minimum number of samples per thread in
+  /// SignalStats::InsertData, below which starting a thread costs more
+  /// than it saves.
+  constexpr std::size_t kParallelGrain = 65536;
+
+  /// \brief Combine the variance data of a statistic with the mean and the
+  /// sum of squared deviations of another set of samples, using the formula
+  /// of Chan et al.
+  /// wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+  /// \param[in,out] _data Data of a SignalVariance: data holds the sum of
+  /// squared deviations and extraData holds the mean.
+  /// \param[in] _mean Mean of the other samples.
+  /// \param[in] _m2 Sum of squared deviations of the other samples.
+  /// \param[in] _count Number of other samples.
+  void CombineVariance(SignalStatisticPrivate &_data, const double _mean,
+      const double _m2, const std::size_t _count)
+  {
+    if (_count == 0)
+      return;
+
+    // delta = mean_b - mean_a
+    const double countA = _data.count;
+    const double countB = static_cast<double>(_count);
+    const double total = countA + countB;
+    const double delta = _mean - _data.extraData;
+
+    // mean = mean_a + delta * n_b / n
+    _data.extraData += delta * countB / total;
+
+    // M2 = M2_a + M2_b + delta^2 * n_a * n_b / n
+    _data.data += _m2 + delta * delta * countA * countB / total;
+
+    _data.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to statistics, one block at a time.
+  /// \param[in,out] _stats The statistics.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertBlocks(SignalStatistic_V &_stats, const double *_data,
+      const std::size_t _count)
+  {
+    for (std::size_t begin = 0; begin < _count; begin += kBlockSize)
+    {
+      const std::size_t n = std::min(kBlockSize, _count - begin);
+      for (auto &statistic : _stats)
+        SignalStatsPrivate::InsertData(*statistic, _data + begin, n);
+    }
+  }
+
+  /// \brief Relative accuracy of the quantiles of SignalQuantile.
+  constexpr double kSketchAccuracy = 0.01;
+
+  /// \brief Ratio between the bounds of each bucket of SignalQuantile.
+  constexpr double kSketchGamma = (1.0 + kSketchAccuracy) /
+    (1.0 - kSketchAccuracy);
+
+  /// \brief Natural logarithm of kSketchGamma, which is
+  /// 2 atanh(kSketchAccuracy). The series is summed until its terms are
+  /// below the precision of a double, so that this is a constant.
+  constexpr double kSketchLogGamma = 2.0 * (kSketchAccuracy +
+      kSketchAccuracy * kSketchAccuracy * kSketchAccuracy / 3.0 +
+      kSketchAccuracy * kSketchAccuracy * kSketchAccuracy *
+      kSketchAccuracy * kSketchAccuracy / 5.0 +
+      kSketchAccuracy * kSketchAccuracy * kSketchAccuracy *
+      kSketchAccuracy * kSketchAccuracy * kSketchAccuracy *
+      kSketchAccuracy / 7.0);
+
+  /// \brief Inverse of kSketchLogGamma.
+  constexpr double kSketchInvLogGamma = 1.0 / kSketchLogGamma;
+
+  /// \brief Largest number of buckets accepted in the short name of a
+  /// SignalHistogram.
+  constexpr unsigned long kMaxHistogramBuckets = 1ul << 20;
+
+  /// \brief Add a sample to a SignalQuantile sketch. Bucket i holds the
+  /// magnitudes in (gamma^(i-1), gamma^i].
+  /// \param[in] _sketch The sketch.
+  /// \param[in] _x The sample.
+  void InsertSketch(SignalQuantilePrivate &_sketch, const double _x)
+  {
+    if (!std::isfinite(_x))
+      return;
+
+    if (_x > 0)
+    {
+      _sketch.positive.Add(static_cast<int>(
+            std::ceil(std::log(_x) * kSketchInvLogGamma)));
+    }
+    else if (_x < 0)
+    {
+      _sketch.negative.Add(static_cast<int>(
+            std::ceil(std::log(-_x) * kSketchInvLogGamma)));
+    }
+    else
+    {
+      ++_sketch.zeroCount;
+    }
+  }
+
+  /// \brief Get the value that represents a bucket of a SignalQuantile
+  /// sketch, which is within kSketchAccuracy of every magnitude in it.
+  /// \param[in] _index Index of the bucket.
+  /// \return The value.
+  double SketchValue(const int _index)
+  {
+    return 2.0 * std::exp(_index * kSketchLogGamma) / (kSketchGamma + 1.0);
+  }
+
+  /// \brief Format a parameter of a short name with the default precision
+  /// of a stream, or with more digits if that is needed to read back
+  /// exactly the number that is written or the parameter.
+  /// \param[in] _value The parameter.
+  /// \param[in] _scale Factor between the parameter and the number that
+  /// is written, such as 100 for a quantile written as a percentage.
+  /// \return The number.
+  std::string ShortNameNumber(const double _value, const double _scale = 1.0)
+  {
+    const double scaled = _value * _scale;
+    std::ostringstream number;
+    for (int precision = 6;
+         precision <= std::numeric_limits<double>::max_digits10;
+         ++precision)
+    {
+      number.str("");
+      number << std::setprecision(precision) << scaled;
+      const double parsed = std::strtod(number.str().c_str(), nullptr);
+      if (equal(parsed, scaled, 0.0) || equal(parsed / _scale, _value, 0.0))
+        break;
+    }
+    return number.str();
+  }
+
+  /// \brief Parse the short name of a SignalQuantile, such as "p99.9".
+  /// \param[in] _name The name.
+  /// \param[out] _quantile The quantile, in [0, 1].
+  /// \return True if the name is valid.
+  bool ParseQuantileName(const std::string &_name, double &_quantile)
+  {
+    if (_name.size() < 2 || _name[0] != 'p' ||
+        !std::isdigit(static_cast<unsigned char>(_name[1])))
+    {
+      return false;
+    }
+
+    char *end = nullptr;
+    const double percent = std::strtod(_name.c_str() + 1, &end);
+    if (*end != '\0' || percent < 0.0 || percent > 100.0)
+      return false;
+
+    _quantile = percent / 100.0;
+    return true;
+  }
+
+  /// \brief Parse the short name of a SignalHistogram, such as
+  /// "hist[0:100:50]".
+  /// \param[in] _name The name.
+  /// \param[out] _min Lower bound of the first bucket.
+  /// \param[out] _max Upper bound of the last bucket.
+  /// \param[out] _buckets Number of buckets.
+  /// \return True if the name is valid.
+  bool ParseHistogramName(const std::string &_name, double &_min,
+      double &_max, std::size_t &_buckets)
+  {
+    const std::string prefix = "hist[";
+    if (_name.compare(0, prefix.size(), prefix) != 0 || _name.back() != ']')
+      return false;
+
+    const char *str = _name.c_str() + prefix.size();
+    char *end = nullptr;
+    _min = std::strtod(str, &end);
+    if (end == str || *end != ':')
+      return false;
+
+    str = end + 1;
+    _max = std::strtod(str, &end);
+    if (end == str || *end != ':')
+      return false;
+
+    str = end + 1;
+    if (!std::isdigit(static_cast<unsigned char>(*str)))
+      return false;
+    const unsigned long buckets = std::strtoul(str, &end, 10);
+    if (*end != ']' || end + 1 != _name.c_str() + _name.size())
+      return false;
+
+    if (!std::isfinite(_min) || !std::isfinite(_max) || !(_min < _max) ||
+        buckets == 0 || buckets > kMaxHistogramBuckets)
+    {
+      return false;
+    }
+
+    _buckets = buckets;
+    return true;
+  }
+
+  /// \brief Add a batch of samples to the data of a SignalMaximum.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertMaximum(SignalStatisticPrivate &_stat, const double *_data,
+      const std::size_t _count)
+  {
+    if (_count == 0)
+      return;
+
+    std::size_t i = 0;
+    double max = _stat.count == 0 ? _data[i++] : _stat.data;
+    for (; i < _count; ++i)
+    {
+      if (_data[i] > max)
+        max = _data[i];
+    }
+    _stat.data = max;
+    _stat.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to the data of a SignalMinimum.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertMinimum(SignalStatisticPrivate &_stat, const double *_data,
+      const std::size_t _count)
+  {
+    if (_count == 0)
+      return;
+
+    std::size_t i = 0;
+    double min = _stat.count == 0 ? _data[i++] : _stat.data;
+    for (; i < _count; ++i)
+    {
+      if (_data[i] < min)
+        min = _data[i];
+    }
+    _stat.data = min;
+    _stat.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to the data of a SignalMean.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertMean(SignalStatisticPrivate &_stat, const double *_data,
+      const std::size_t _count)
+  {
+    double sum = _stat.data;
+    for (std::size_t i = 0; i < _count; ++i)
+      sum += _data[i];
+    _stat.data = sum;
+    _stat.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to the data of a SignalRootMeanSquare.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertRootMeanSquare(SignalStatisticPrivate &_stat,
+      const double *_data, const std::size_t _count)
+  {
+    double sumSquares = _stat.data;
+    for (std::size_t i = 0; i < _count; ++i)
+      sumSquares += _data[i] * _data[i];
+    _stat.data = sumSquares;
+    _stat.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to the data of a
+  /// SignalMaxAbsoluteValue.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertMaxAbsoluteValue(SignalStatisticPrivate &_stat,
+      const double *_data, const std::size_t _count)
+  {
+    double max = _stat.data;
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+      const double absData = std::abs(_data[i]);
+      if (absData > max)
+        max = absData;
+    }
+    _stat.data = max;
+    _stat.count += static_cast<unsigned int>(_count);
+  }
+
+  /// \brief Add a batch of samples to the data of a SignalVariance. Each
+  /// block is reduced with the two-pass algorithm, then combined with the
+  /// previous data using the formula of Chan et al.
+  /// \param[in,out] _stat Data of the statistic.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertVariance(SignalStatisticPrivate &_stat, const double *_data,
+      const std::size_t _count)
+  {
+    for (std::size_t begin = 0; begin < _count; begin += kBlockSize)
+    {
+      const double *block = _data + begin;
+      const std::size_t n = std::min(kBlockSize, _count - begin);
+
+      double sum = 0.0;
+      for (std::size_t i = 0; i < n; ++i)
+        sum += block[i];
+      const double blockMean = sum / n;
+
+      double blockM2 = 0.0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        const double d = block[i] - blockMean;
+        blockM2 += d * d;
+      }
+
+      CombineVariance(_stat, blockMean, blockM2, n);
+    }
+  }
+
+  /// \brief Add a batch of samples to the buckets of a SignalHistogram.
+  /// The count of the statistic is not changed.
+  /// \param[in,out] _hist The buckets.
+  /// \param[in] _data Pointer to the samples.
+  /// \param[in] _count Number of samples.
+  void InsertHistogram(SignalHistogramPrivate &_hist, const double *_data,
+      const std::size_t _count)
+  {
+    const std::size_t last = _hist.counts.size() - 1;
+    for (std::size_t i = 0; i < _count; ++i)
+    {
+      const double x = _data[i];
+      if (x < _hist.min)
+      {
+        ++_hist.underflow;
+      }
+      else if (x > _hist.max)
+      {
+        ++_hist.overflow;
+      }
+      else if (x >= _hist.min)
+      {
+        // The upper bound belongs to the last bucket.
+        const std::size_t bucket =
+          static_cast<std::size_t>((x - _hist.min) * _hist.scale);
+        ++_hist.counts[std::min(bucket, last)];
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 SignalStatistic::SignalStatistic()
   : dataPtr(new SignalStatisticPrivate)
@@ -204,6 +566,402 @@ void SignalVariance::InsertData(const double _data)
   this->dataPtr->data += delta * (_data - this->dataPtr->extraData);
 }
 
+//////////////////////////////////////////////////
+SignalQuantile::SignalQuantile(const double _quantile)
+  : sketchPtr(new SignalQuantilePrivate)
+{
+  this->sketchPtr->quantile = std::clamp(_quantile, 0.0, 1.0);
+}
+
+//////////////////////////////////////////////////
+SignalQuantile::SignalQuantile(const SignalQuantile &_ss)
+  : SignalStatistic(_ss),
+    sketchPtr(new SignalQuantilePrivate(*_ss.sketchPtr))
+{
+}
+
+//////////////////////////////////////////////////
+SignalQuantile::~SignalQuantile()
+{
+}
+
+//////////////////////////////////////////////////
+double SignalQuantile::Value() const
+{
+  return this->Quantile(this->sketchPtr->quantile);
+}
+
+//////////////////////////////////////////////////
+std::string SignalQuantile::ShortName() const
+{
+  std::ostringstream name;
+  name << "p" << ShortNameNumber(this->sketchPtr->quantile, 100.0);
+  return name.str();
+}
+
+//////////////////////////////////////////////////
+void SignalQuantile::InsertData(const double _data)
+{
+  InsertSketch(*this->sketchPtr, _data);
+  this->dataPtr->count++;
+}
+
+//////////////////////////////////////////////////
+void SignalQuantile::Reset()
+{
+  SignalStatistic::Reset();
+  const double quantile = this->sketchPtr->quantile;
+  *this->sketchPtr = SignalQuantilePrivate();
+  this->sketchPtr->quantile = quantile;
+}
+
+//////////////////////////////////////////////////
+// Same rank as the DDSketch paper: the estimate is the value of the bucket
+// that holds the sample of rank q * (n - 1), counting from 0.
+double SignalQuantile::Quantile(const double _quantile) const
+{
+  const SignalQuantilePrivate &sketch = *this->sketchPtr;
+  const auto &negative = sketch.negative.counts;
+  const auto &positive = sketch.positive.counts;
+  const std::uint64_t total =
+    std::accumulate(negative.begin(), negative.end(), sketch.zeroCount) +
+    std::accumulate(positive.begin(), positive.end(), std::uint64_t(0));
+  if (total == 0)
+    return 0.0;
+
+  const double rank =
+    std::clamp(_quantile, 0.0, 1.0) * static_cast<double>(total - 1);
+
+  // Negative samples, from the largest magnitude down.
+  std::uint64_t cumulative = 0;
+  for (std::size_t i = negative.size(); i-- > 0;)
+  {
+    cumulative += negative[i];
+    if (cumulative > rank)
+      return -SketchValue(sketch.negative.offset + static_cast<int>(i));
+  }
+
+  cumulative += sketch.zeroCount;
+  if (cumulative > rank)
+    return 0.0;
+
+  for (std::size_t i = 0; i < positive.size(); ++i)
+  {
+    cumulative += positive[i];
+    if (cumulative > rank)
+      return SketchValue(sketch.positive.offset + static_cast<int>(i));
+  }
+
+  // Only reached if _quantile is NaN.
+  return 0.0;
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::SignalHistogram(const double _min, const double _max,
+    const std::size_t _buckets)
+  : histogramPtr(new SignalHistogramPrivate)
+{
+  SignalHistogramPrivate &hist = *this->histogramPtr;
+  hist.min = _min;
+  hist.max = _max > _min ? _max : _min + 1.0;
+  hist.counts.assign(std::max<std::size_t>(1, _buckets), 0u);
+  hist.scale = hist.counts.size() / (hist.max - hist.min);
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::SignalHistogram(const SignalHistogram &_ss)
+  : SignalStatistic(_ss),
+    histogramPtr(new SignalHistogramPrivate(*_ss.histogramPtr))
+{
+}
+
+//////////////////////////////////////////////////
+SignalHistogram::~SignalHistogram()
+{
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Value() const
+{
+  return this->Quantile(0.5);
+}
+
+//////////////////////////////////////////////////
+std::string SignalHistogram::ShortName() const
+{
+  std::ostringstream name;
+  name << "hist[" << ShortNameNumber(this->histogramPtr->min) << ":"
+       << ShortNameNumber(this->histogramPtr->max) << ":"
+       << this->histogramPtr->counts.size() << "]";
+  return name.str();
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::InsertData(const double _data)
+{
+  InsertHistogram(*this->histogramPtr, &_data, 1);
+  this->dataPtr->count++;
+}
+
+//////////////////////////////////////////////////
+void SignalHistogram::Reset()
+{
+  SignalStatistic::Reset();
+  SignalHistogramPrivate &hist = *this->histogramPtr;
+  std::fill(hist.counts.begin(), hist.counts.end(), 0u);
+  hist.underflow = 0;
+  hist.overflow = 0;
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Min() const
+{
+  return this->histogramPtr->min;
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Max() const
+{
+  return this->histogramPtr->max;
+}
+
+//////////////////////////////////////////////////
+const std::vector<std::uint64_t> &SignalHistogram::Counts() const
+{
+  return this->histogramPtr->counts;
+}
+
+//////////////////////////////////////////////////
+std::uint64_t SignalHistogram::Underflow() const
+{
+  return this->histogramPtr->underflow;
+}
+
+//////////////////////////////////////////////////
+std::uint64_t SignalHistogram::Overflow() const
+{
+  return this->histogramPtr->overflow;
+}
+
+//////////////////////////////////////////////////
+double SignalHistogram::Quantile(const double _quantile) const
+{
+  const SignalHistogramPrivate &hist = *this->histogramPtr;
+  const std::uint64_t total = std::accumulate(hist.counts.begin(),
+      hist.counts.end(), hist.underflow + hist.overflow);
+  if (total == 0)
+    return 0.0;
+
+  const double rank =
+    std::clamp(_quantile, 0.0, 1.0) * static_cast<double>(total);
+  if (hist.underflow > 0 && rank <= hist.underflow)
+    return hist.min;
+
+  double cumulative = static_cast<double>(hist.underflow);
+  for (std::size_t i = 0; i < hist.counts.size(); ++i)
+  {
+    const double count = static_cast<double>(hist.counts[i]);
+    if (count > 0 && cumulative + count >= rank)
+    {
+      const double fraction = std::max(0.0, rank - cumulative) / count;
+      return hist.min + (i + fraction) / hist.scale;
+    }
+    cumulative += count;
+  }
+  return hist.max;
+}
+
+//////////////////////////////////////////////////
+void SignalStatsPrivate::InsertData(SignalStatistic &_stat,
+    const double *_data, const std::size_t _count)
+{
+  SignalStatisticPrivate &data = *_stat.dataPtr;
+  const std::type_info &type = typeid(_stat);
+  if (type == typeid(SignalMaximum))
+  {
+    InsertMaximum(data, _data, _count);
+  }
+  else if (type == typeid(SignalMean))
+  {
+    InsertMean(data, _data, _count);
+  }
+  else if (type == typeid(SignalMinimum))
+  {
+    InsertMinimum(data, _data, _count);
+  }
+  else if (type == typeid(SignalRootMeanSquare))
+  {
+    InsertRootMeanSquare(data, _data, _count);
+  }
+  else if (type == typeid(SignalMaxAbsoluteValue))
+  {
+    InsertMaxAbsoluteValue(data, _data, _count);
+  }
+  else if (type == typeid(SignalVariance))
+  {
+    InsertVariance(data, _data, _count);
+  }
+  else if (type == typeid(SignalQuantile))
+  {
+    SignalQuantilePrivate &sketch =
+      *static_cast<SignalQuantile &>(_stat).sketchPtr;
+    for (std::size_t i = 0; i < _count; ++i)
+      InsertSketch(sketch, _data[i]);
+    data.count += static_cast<unsigned int>(_count);
+  }
+  else if (type == typeid(SignalHistogram))
+  {
+    InsertHistogram(*static_cast<SignalHistogram &>(_stat).histogramPtr,
+        _data, _count);
+    data.count += static_cast<unsigned int>(_count);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < _count; ++i)
+      _stat.InsertData(_data[i]);
+  }
+}
+
+//////////////////////////////////////////////////
+SignalStatisticPtr SignalStatsPrivate::CloneEmpty(
+    const SignalStatistic &_stat)
+{
+  SignalStatisticPtr clone;
+  const std::type_info &type = typeid(_stat);
+  if (type == typeid(SignalMaximum))
+  {
+    clone.reset(new SignalMaximum());
+  }
+  else if (type == typeid(SignalMean))
+  {
+    clone.reset(new SignalMean());
+  }
+  else if (type == typeid(SignalMinimum))
+  {
+    clone.reset(new SignalMinimum());
+  }
+  else if (type == typeid(SignalRootMeanSquare))
+  {
+    clone.reset(new SignalRootMeanSquare());
+  }
+  else if (type == typeid(SignalMaxAbsoluteValue))
+  {
+    clone.reset(new SignalMaxAbsoluteValue());
+  }
+  else if (type == typeid(SignalVariance))
+  {
+    clone.reset(new SignalVariance());
+  }
+  else if (type == typeid(SignalQuantile))
+  {
+    clone.reset(new SignalQuantile(
+          static_cast<const SignalQuantile &>(_stat).sketchPtr->quantile));
+  }
+  else if (type == typeid(SignalHistogram))
+  {
+    const SignalHistogramPrivate &hist =
+      *static_cast<const SignalHistogram &>(_stat).histogramPtr;
+    clone.reset(new SignalHistogram(hist.min, hist.max, hist.counts.size()));
+  }
+  return clone;
+}
+
+//////////////////////////////////////////////////
+bool SignalStatsPrivate::CanMerge(const SignalStatistic &_stat,
+    const SignalStatistic &_other)
+{
+  const std::type_info &type = typeid(_stat);
+  if (type != typeid(_other))
+    return false;
+
+  if (type == typeid(SignalHistogram))
+  {
+    const SignalHistogramPrivate &hist =
+      *static_cast<const SignalHistogram &>(_stat).histogramPtr;
+    const SignalHistogramPrivate &otherHist =
+      *static_cast<const SignalHistogram &>(_other).histogramPtr;
+    return equal(hist.min, otherHist.min, 0.0) &&
+           equal(hist.max, otherHist.max, 0.0) &&
+           hist.counts.size() == otherHist.counts.size();
+  }
+
+  // The data of other statistics can't be combined.
+  return type == typeid(SignalMaximum) || type == typeid(SignalMean) ||
+         type == typeid(SignalMinimum) ||
+         type == typeid(SignalRootMeanSquare) ||
+         type == typeid(SignalMaxAbsoluteValue) ||
+         type == typeid(SignalVariance) || type == typeid(SignalQuantile);
+}
+
+//////////////////////////////////////////////////
+bool SignalStatsPrivate::Merge(SignalStatistic &_stat,
+    const SignalStatistic &_other)
+{
+  if (!CanMerge(_stat, _other))
+    return false;
+
+  const std::type_info &type = typeid(_stat);
+  SignalStatisticPrivate &data = *_stat.dataPtr;
+  const SignalStatisticPrivate &otherData = *_other.dataPtr;
+  if (type == typeid(SignalMaximum))
+  {
+    if (otherData.count > 0 &&
+        (data.count == 0 || otherData.data > data.data))
+    {
+      data.data = otherData.data;
+    }
+  }
+  else if (type == typeid(SignalMinimum))
+  {
+    if (otherData.count > 0 &&
+        (data.count == 0 || otherData.data < data.data))
+    {
+      data.data = otherData.data;
+    }
+  }
+  else if (type == typeid(SignalMean) ||
+           type == typeid(SignalRootMeanSquare))
+  {
+    data.data += otherData.data;
+  }
+  else if (type == typeid(SignalMaxAbsoluteValue))
+  {
+    if (otherData.data > data.data)
+      data.data = otherData.data;
+  }
+  else if (type == typeid(SignalVariance))
+  {
+    CombineVariance(data, otherData.extraData, otherData.data,
+        otherData.count);
+    return true;
+  }
+  else if (type == typeid(SignalQuantile))
+  {
+    // The quantiles being estimated do not need to match.
+    SignalQuantilePrivate &sketch =
+      *static_cast<SignalQuantile &>(_stat).sketchPtr;
+    const SignalQuantilePrivate &otherSketch =
+      *static_cast<const SignalQuantile &>(_other).sketchPtr;
+    sketch.positive.Merge(otherSketch.positive);
+    sketch.negative.Merge(otherSketch.negative);
+    sketch.zeroCount += otherSketch.zeroCount;
+  }
+  else if (type == typeid(SignalHistogram))
+  {
+    SignalHistogramPrivate &hist =
+      *static_cast<SignalHistogram &>(_stat).histogramPtr;
+    const SignalHistogramPrivate &otherHist =
+      *static_cast<const SignalHistogram &>(_other).histogramPtr;
+    for (std::size_t i = 0; i < hist.counts.size(); ++i)
+      hist.counts[i] += otherHist.counts[i];
+    hist.underflow += otherHist.underflow;
+    hist.overflow += otherHist.overflow;
+  }
+
+  data.count += otherData.count;
+  return true;
+}
+
 //////////////////////////////////////////////////
 SignalStats::SignalStats()
   : dataPtr(new SignalStatsPrivate)
@@ -251,22 +1009,122 @@ void SignalStats::InsertData(const double _data)
 }
 
 //////////////////////////////////////////////////
-bool SignalStats::InsertStatistic(const std::string &_name)
+void SignalStats::InsertData(const double *_data, const std::size_t _count,
+    const unsigned int _threads)
 {
-  // Check if the statistic is already inserted
+  const std::size_t chunks = std::min<std::size_t>(std::max(1u, _threads),
+      _count / kParallelGrain);
+  if (chunks <= 1)
   {
-    auto map = this->Map();
-    if (map.find(_name) != map.end())
+    InsertBlocks(this->dataPtr->stats, _data, _count);
+    return;
+  }
+
+  // Reduce each chunk into empty copies of the statistics, then merge
+  // them in order. The copies are made directly rather than from the
+  // short names, so that their parameters are exactly the same.
+  std::vector<SignalStats> partial(chunks);
+  for (auto &stats : partial)
+  {
+    for (auto const &statistic : this->dataPtr->stats)
     {
-      std::cerr << "Unable to InsertStatistic ["
-                << _name
-                << "] since it has already been inserted."
+      auto clone = SignalStatsPrivate::CloneEmpty(*statistic);
+      if (clone)
+        stats.dataPtr->stats.push_back(clone);
+    }
+  }
+
+  const std::size_t chunkSize = (_count + chunks - 1) / chunks;
+  detail::ParallelFor(chunks, _threads,
+      [&](const std::size_t _begin, const std::size_t _end)
+      {
+        for (std::size_t c = _begin; c < _end; ++c)
+        {
+          const std::size_t begin = c * chunkSize;
+          const std::size_t end = std::min(_count, begin + chunkSize);
+          partial[c].InsertData(_data + begin, end - begin);
+        }
+      }, 1);
+
+  for (std::size_t c = 0; c < chunks; ++c)
+  {
+    if (!this->Merge(partial[c]))
+    {
+      // Insert the samples of the chunk again rather than losing them.
+      const std::size_t begin = c * chunkSize;
+      const std::size_t end = std::min(_count, begin + chunkSize);
+      InsertBlocks(this->dataPtr->stats, _data + begin, end - begin);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SignalStats::InsertData(const std::vector<double> &_data,
+    const unsigned int _threads)
+{
+  this->InsertData(_data.data(), _data.size(), _threads);
+}
+
+//////////////////////////////////////////////////
+bool SignalStats::Merge(const SignalStats &_other)
+{
+  // Match the statistics by name before changing anything.
+  std::vector<std::pair<SignalStatisticPtr, SignalStatisticPtr>> pairs;
+  for (auto const &statistic : this->dataPtr->stats)
+  {
+    const std::string name = statistic->ShortName();
+    auto other = std::find_if(_other.dataPtr->stats.begin(),
+        _other.dataPtr->stats.end(),
+        [&name](const SignalStatisticPtr &_s)
+        {
+          return _s->ShortName() == name;
+        });
+    if (other == _other.dataPtr->stats.end())
+    {
+      std::cerr << "Unable to Merge since statistic ["
+                << name
+                << "] is missing from the other SignalStats."
                 << std::endl;
       return false;
     }
+    pairs.emplace_back(statistic, *other);
   }
 
+  if (pairs.size() != _other.dataPtr->stats.size())
+  {
+    std::cerr << "Unable to Merge since the other SignalStats "
+              << "has more statistics."
+              << std::endl;
+    return false;
+  }
+
+  // Check every pair first, so that a failure leaves all of the
+  // statistics unchanged.
+  for (auto const &pair : pairs)
+  {
+    if (!SignalStatsPrivate::CanMerge(*pair.first, *pair.second))
+    {
+      std::cerr << "Unable to Merge since statistic ["
+                << pair.first->ShortName()
+                << "] has different parameters in the other SignalStats."
+                << std::endl;
+      return false;
+    }
+  }
+
+  for (auto &pair : pairs)
+    SignalStatsPrivate::Merge(*pair.first, *pair.second);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SignalStats::InsertStatistic(const std::string &_name)
+{
   SignalStatisticPtr stat;
+  double quantile;
+  double min;
+  double max;
+  std::size_t buckets;
   if (_name == "max")
   {
     stat.reset(new SignalMaximum());
@@ -291,6 +1149,14 @@ bool SignalStats::InsertStatistic(const std::string &_name)
   {
     stat.reset(new SignalVariance());
   }
+  else if (ParseQuantileName(_name, quantile))
+  {
+    stat.reset(new SignalQuantile(quantile));
+  }
+  else if (ParseHistogramName(_name, min, max, buckets))
+  {
+    stat.reset(new SignalHistogram(min, max, buckets));
+  }
   else
   {
     // Unrecognized name string
@@ -300,6 +1166,21 @@ bool SignalStats::InsertStatistic(const std::string &_name)
               << std::endl;
     return false;
   }
+
+  // Check if the statistic is already inserted. Parameterized names are
+  // compared in their normalized form, so that "p99.0" matches "p99".
+  {
+    auto map = this->Map();
+    if (map.find(stat->ShortName()) != map.end())
+    {
+      std::cerr << "Unable to InsertStatistic ["
+                << _name
+                << "] since it has already been inserted."
+                << std::endl;
+      return false;
+    }
+  }
+
   this->dataPtr->stats.push_back(stat);
   return true;
 }
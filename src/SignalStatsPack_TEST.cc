@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gz/math/Rand.hh>
+#include <gz/math/SignalStats.hh>
+#include <gz/math/SignalStatsPack.hh>
+
+using namespace gz;
+
+using AllStats = math::SignalStatsPack<math::stats::Maximum,
+      math::stats::MaxAbsoluteValue, math::stats::Mean, math::stats::Minimum,
+      math::stats::RootMeanSquare, math::stats::Variance>;
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, Empty)
+{
+  AllStats pack;
+  EXPECT_EQ(pack.Count(), 0u);
+
+  auto map = pack.Map();
+  EXPECT_EQ(map.size(), 6u);
+  for (const auto &name : {"max", "maxAbs", "mean", "min", "rms", "var"})
+  {
+    ASSERT_EQ(map.count(name), 1u) << name;
+    EXPECT_DOUBLE_EQ(map[name], 0.0) << name;
+  }
+
+  pack.InsertData(nullptr, 0);
+  EXPECT_EQ(pack.Count(), 0u);
+  EXPECT_DOUBLE_EQ(pack.Value<math::stats::Maximum>(), 0.0);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, MatchesSignalStats)
+{
+  std::vector<double> values(3000);
+  for (auto &v : values)
+    v = math::Rand::DblNormal(-1.0, 3.0);
+
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  AllStats single;
+  for (const double v : values)
+  {
+    stats.InsertData(v);
+    single.InsertData(v);
+  }
+
+  AllStats batch;
+  batch.InsertData(values.data(), 1000);
+  batch.InsertData(values.data() + 1000, values.size() - 1000);
+
+  AllStats vec;
+  vec.InsertData(values);
+
+  auto expected = stats.Map();
+  for (const AllStats *pack : {&single, &batch, &vec})
+  {
+    EXPECT_EQ(pack->Count(), values.size());
+    auto map = pack->Map();
+    EXPECT_DOUBLE_EQ(map["max"], expected["max"]);
+    EXPECT_DOUBLE_EQ(map["maxAbs"], expected["maxAbs"]);
+    EXPECT_DOUBLE_EQ(map["mean"], expected["mean"]);
+    EXPECT_DOUBLE_EQ(map["min"], expected["min"]);
+    EXPECT_DOUBLE_EQ(map["rms"], expected["rms"]);
+    EXPECT_NEAR(map["var"], expected["var"], 1e-10 * expected["var"]);
+  }
+
+  EXPECT_DOUBLE_EQ(single.Value<math::stats::Mean>(), expected["mean"]);
+
+  single.Reset();
+  EXPECT_EQ(single.Count(), 0u);
+  EXPECT_DOUBLE_EQ(single.Value<math::stats::Mean>(), 0.0);
+  EXPECT_DOUBLE_EQ(single.Value<math::stats::Variance>(), 0.0);
+
+  // The pack can be used again after a reset.
+  single.InsertData(values);
+  EXPECT_DOUBLE_EQ(single.Value<math::stats::Mean>(), expected["mean"]);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, Subset)
+{
+  math::SignalStatsPack<math::stats::Variance, math::stats::Mean> pack;
+  const double values[] = {1.0, 2.0, 3.0, 4.0};
+  pack.InsertData(values, 4);
+
+  auto map = pack.Map();
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_DOUBLE_EQ(map["mean"], 2.5);
+  EXPECT_DOUBLE_EQ(map["var"], 5.0 / 3.0);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, VarianceOffset)
+{
+  // A small spread around a large mean.
+  math::SignalStatsPack<math::stats::Variance> pack;
+  std::vector<double> values;
+  for (int i = 0; i < 1000; ++i)
+    values.push_back(1e9 + (i % 2 == 0 ? 0.5 : -0.5));
+  pack.InsertData(values);
+
+  EXPECT_NEAR(pack.Value<math::stats::Variance>(), 0.25 * 1000 / 999, 1e-9);
+
+  // One sample has no variance.
+  math::SignalStatsPack<math::stats::Variance> one;
+  one.InsertData(5.0);
+  EXPECT_DOUBLE_EQ(one.Value<math::stats::Variance>(), 0.0);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, NaN)
+{
+  // NaN samples are ignored by the minimum and maximum.
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  math::SignalStatsPack<math::stats::Maximum, math::stats::Minimum,
+    math::stats::MaxAbsoluteValue, math::stats::Mean> pack;
+  const double values[] = {nan, -2.0, nan, 3.0};
+  pack.InsertData(values, 4);
+
+  EXPECT_EQ(pack.Count(), 4u);
+  EXPECT_DOUBLE_EQ(pack.Value<math::stats::Maximum>(), 3.0);
+  EXPECT_DOUBLE_EQ(pack.Value<math::stats::Minimum>(), -2.0);
+  EXPECT_DOUBLE_EQ(pack.Value<math::stats::MaxAbsoluteValue>(), 3.0);
+  EXPECT_TRUE(std::isnan(pack.Value<math::stats::Mean>()));
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, Merge)
+{
+  std::vector<double> values(1000);
+  for (auto &v : values)
+    v = math::Rand::DblNormal(50.0, 5.0);
+
+  AllStats all;
+  all.InsertData(values);
+
+  for (const std::size_t split : {std::size_t(0), std::size_t(1),
+        std::size_t(400), values.size()})
+  {
+    AllStats a;
+    AllStats b;
+    a.InsertData(values.data(), split);
+    b.InsertData(values.data() + split, values.size() - split);
+    a.Merge(b);
+    EXPECT_EQ(a.Count(), values.size());
+
+    auto expected = all.Map();
+    auto map = a.Map();
+    for (const auto &name : {"max", "maxAbs", "mean", "min", "rms", "var"})
+    {
+      EXPECT_NEAR(map[name], expected[name], 1e-12 * std::abs(expected[name]))
+        << name << " split " << split;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsPackTest, InsertDataParallel)
+{
+  std::vector<double> values(300000);
+  for (auto &v : values)
+    v = math::Rand::DblNormal(1e6, 2.0);
+
+  AllStats single;
+  single.InsertData(values);
+  AllStats parallel;
+  parallel.InsertData(values.data(), values.size(), 4);
+  EXPECT_EQ(parallel.Count(), values.size());
+
+  auto expected = single.Map();
+  auto map = parallel.Map();
+  EXPECT_DOUBLE_EQ(map["max"], expected["max"]);
+  EXPECT_DOUBLE_EQ(map["maxAbs"], expected["maxAbs"]);
+  EXPECT_DOUBLE_EQ(map["min"], expected["min"]);
+  for (const auto &name : {"mean", "rms", "var"})
+    EXPECT_NEAR(map[name], expected[name], 1e-9 * expected[name]) << name;
+  EXPECT_NEAR(map["var"], 4.0, 0.1);
+}
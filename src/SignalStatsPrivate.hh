@@ -17,7 +17,11 @@
 #ifndef GZ_MATH_SIGNALSTATSPRIVATE_HH_
 #define GZ_MATH_SIGNALSTATSPRIVATE_HH_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <numeric>
 #include <vector>
 #include <gz/math/config.hh>
 
@@ -50,6 +54,119 @@ namespace ignition
       }
     };
 
+    /// \brief Counts of the buckets of one sign of a SignalQuantile sketch,
+    /// stored densely from the lowest used bucket index.
+    class SignalSketchStore
+    {
+      /// \brief Maximum number of buckets. Beyond this, the lowest buckets
+      /// are merged.
+      public: static constexpr int kMaxBuckets = 2048;
+
+      /// \brief Add to the count of a bucket.
+      /// \param[in] _index Index of the bucket.
+      /// \param[in] _count Number of samples to add.
+      public: void Add(const int _index, const std::uint64_t _count = 1)
+      {
+        if (this->counts.empty())
+        {
+          this->offset = _index;
+          this->counts.push_back(_count);
+          return;
+        }
+
+        const int size = static_cast<int>(this->counts.size());
+        if (_index < this->offset)
+        {
+          // Grow down, at most to kMaxBuckets, and count anything lower in
+          // the lowest bucket.
+          const int top = this->offset + size - 1;
+          const int low = std::max(_index, top - kMaxBuckets + 1);
+          this->counts.insert(this->counts.begin(), this->offset - low, 0u);
+          this->offset = low;
+          this->counts.front() += _count;
+          return;
+        }
+
+        if (_index >= this->offset + size)
+        {
+          // Merge the lowest buckets into the new lowest bucket if growing
+          // up would keep more than kMaxBuckets.
+          const int low = _index - kMaxBuckets + 1;
+          if (low > this->offset)
+          {
+            const std::size_t drop =
+              std::min<std::size_t>(low - this->offset, size);
+            const std::uint64_t collapsed = std::accumulate(
+                this->counts.begin(), this->counts.begin() + drop,
+                std::uint64_t(0));
+            this->counts.erase(this->counts.begin(),
+                this->counts.begin() + drop);
+            if (this->counts.empty())
+              this->counts.push_back(0u);
+            this->offset = low;
+            this->counts.front() += collapsed;
+          }
+          this->counts.resize(_index - this->offset + 1, 0u);
+        }
+        this->counts[_index - this->offset] += _count;
+      }
+
+      /// \brief Add the counts of another store.
+      /// \param[in] _other The other store.
+      public: void Merge(const SignalSketchStore &_other)
+      {
+        for (std::size_t i = 0; i < _other.counts.size(); ++i)
+        {
+          if (_other.counts[i] > 0)
+            this->Add(_other.offset + static_cast<int>(i), _other.counts[i]);
+        }
+      }
+
+      /// \brief Index of the first bucket.
+      public: int offset = 0;
+
+      /// \brief Count of each bucket, from offset up.
+      public: std::vector<std::uint64_t> counts;
+    };
+
+    /// \brief Private data class for the SignalQuantile class.
+    class SignalQuantilePrivate
+    {
+      /// \brief The quantile to estimate, in [0, 1].
+      public: double quantile = 0.5;
+
+      /// \brief Buckets of the positive samples.
+      public: SignalSketchStore positive;
+
+      /// \brief Buckets of the magnitudes of the negative samples.
+      public: SignalSketchStore negative;
+
+      /// \brief Number of samples equal to zero.
+      public: std::uint64_t zeroCount = 0;
+    };
+
+    /// \brief Private data class for the SignalHistogram class.
+    class SignalHistogramPrivate
+    {
+      /// \brief Lower bound of the first bucket.
+      public: double min = 0.0;
+
+      /// \brief Upper bound of the last bucket.
+      public: double max = 1.0;
+
+      /// \brief Number of buckets per unit of the signal.
+      public: double scale = 1.0;
+
+      /// \brief Count of each bucket.
+      public: std::vector<std::uint64_t> counts;
+
+      /// \brief Number of samples below min.
+      public: std::uint64_t underflow = 0;
+
+      /// \brief Number of samples above max.
+      public: std::uint64_t overflow = 0;
+    };
+
     class SignalStatistic;
 
     /// \def SignalStatisticPtr
@@ -66,6 +183,42 @@ namespace ignition
       /// \brief Vector of `SignalStatistic`s.
       public: SignalStatistic_V stats;
 
+      /// \brief Add a batch of samples to a statistic. The statistics of
+      /// this library are updated with a single loop over the samples.
+      /// Any other statistic gets one InsertData call per sample.
+      /// \param[in,out] _stat The statistic.
+      /// \param[in] _data Pointer to the signal data points.
+      /// \param[in] _count Number of data points.
+      public: static void InsertData(SignalStatistic &_stat,
+                                     const double *_data,
+                                     const std::size_t _count);
+
+      /// \brief Create a statistic of the same type and with the same
+      /// parameters as another one, without its data.
+      /// \param[in] _stat The statistic.
+      /// \return The new statistic, or nullptr if _stat is not from this
+      /// library.
+      public: static SignalStatisticPtr CloneEmpty(
+                  const SignalStatistic &_stat);
+
+      /// \brief Check whether the data of a statistic can be merged into
+      /// another one.
+      /// \param[in] _stat The statistic to merge into.
+      /// \param[in] _other The statistic to merge.
+      /// \return True if both statistics are from this library, of the
+      /// same type and with the same parameters.
+      public: static bool CanMerge(const SignalStatistic &_stat,
+                                   const SignalStatistic &_other);
+
+      /// \brief Merge the data of a statistic into another one, as if its
+      /// samples had been inserted into the other one.
+      /// \param[in,out] _stat The statistic to merge into.
+      /// \param[in] _other The statistic to merge.
+      /// \return True if the data was merged, false if CanMerge() is
+      /// false, in which case nothing changes.
+      public: static bool Merge(SignalStatistic &_stat,
+                                const SignalStatistic &_other);
+
       /// \brief Clone the SignalStatsPrivate object. Used for implementing
       /// copy semantics.
       public: std::unique_ptr<SignalStatsPrivate> Clone() const
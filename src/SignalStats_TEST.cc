@@ -17,6 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <gz/math/Rand.hh>
 #include <gz/math/SignalStats.hh>
 
@@ -639,3 +646,445 @@ TEST(SignalStatsTest, SignalStats)
   }
 }
 
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, InsertDataBatch)
+{
+  // Values with an offset, so that the variance is sensitive to rounding,
+  // and a size that is not a multiple of the block size.
+  std::vector<double> values(5000);
+  for (auto &v : values)
+    v = 100.0 + math::Rand::DblNormal(0.0, 2.0);
+
+  math::SignalStats single;
+  math::SignalStats batch;
+  EXPECT_TRUE(single.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  EXPECT_TRUE(batch.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  for (const double v : values)
+    single.InsertData(v);
+
+  // Uneven batches, including an empty one and a single value.
+  const std::size_t splits[] = {0, 0, 1, 7, 1500, 3333, values.size()};
+  for (std::size_t i = 0; i + 1 < sizeof(splits) / sizeof(splits[0]); ++i)
+    batch.InsertData(values.data() + splits[i], splits[i + 1] - splits[i]);
+
+  EXPECT_EQ(single.Count(), values.size());
+  EXPECT_EQ(batch.Count(), values.size());
+
+  auto expected = single.Map();
+  auto map = batch.Map();
+  EXPECT_EQ(map.size(), 6u);
+
+  // The same operations are done in the same order.
+  EXPECT_DOUBLE_EQ(map["max"], expected["max"]);
+  EXPECT_DOUBLE_EQ(map["maxAbs"], expected["maxAbs"]);
+  EXPECT_DOUBLE_EQ(map["mean"], expected["mean"]);
+  EXPECT_DOUBLE_EQ(map["min"], expected["min"]);
+  EXPECT_DOUBLE_EQ(map["rms"], expected["rms"]);
+
+  // The variance of each block is combined with the previous data.
+  EXPECT_NEAR(map["var"], expected["var"], 1e-10 * expected["var"]);
+  EXPECT_NEAR(map["var"], 4.0, 0.5);
+
+  // vector overload
+  math::SignalStats vec;
+  EXPECT_TRUE(vec.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  vec.InsertData(values);
+  EXPECT_EQ(vec.Count(), values.size());
+  EXPECT_DOUBLE_EQ(vec.Map()["mean"], expected["mean"]);
+  EXPECT_NEAR(vec.Map()["var"], expected["var"], 1e-10 * expected["var"]);
+
+  // Negative values only, the first sample sets the maximum.
+  {
+    const double negative[] = {-3.0, -1.0, -2.0};
+    math::SignalStats stats;
+    EXPECT_TRUE(stats.InsertStatistics("max,min"));
+    stats.InsertData(negative, 0);
+    stats.InsertData(negative + 1, 2);
+    EXPECT_DOUBLE_EQ(stats.Map()["max"], -1.0);
+    EXPECT_DOUBLE_EQ(stats.Map()["min"], -2.0);
+    stats.InsertData(negative, 1);
+    EXPECT_DOUBLE_EQ(stats.Map()["max"], -1.0);
+    EXPECT_DOUBLE_EQ(stats.Map()["min"], -3.0);
+    EXPECT_EQ(stats.Count(), 3u);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatisticMerge)
+{
+  const double values[] = {4.0, -7.0, 2.5, 9.0, -1.0, 3.0, 3.0};
+  const std::size_t count = sizeof(values) / sizeof(values[0]);
+
+  // Merge each split of the values, including empty halves, and compare
+  // with inserting all of them.
+  for (std::size_t split = 0; split <= count; ++split)
+  {
+    for (const auto &name : {"max", "maxAbs", "mean", "min", "rms", "var"})
+    {
+      math::SignalStats all;
+      math::SignalStats a;
+      math::SignalStats b;
+      EXPECT_TRUE(all.InsertStatistic(name));
+      EXPECT_TRUE(a.InsertStatistic(name));
+      EXPECT_TRUE(b.InsertStatistic(name));
+
+      all.InsertData(values, count);
+      a.InsertData(values, split);
+      b.InsertData(values + split, count - split);
+      EXPECT_TRUE(a.Merge(b));
+      EXPECT_EQ(a.Count(), count);
+      EXPECT_NEAR(a.Map()[name], all.Map()[name], 1e-12)
+        << name << " split " << split;
+    }
+  }
+
+  // Different statistics can't be merged.
+  math::SignalStats mean;
+  math::SignalStats var;
+  EXPECT_TRUE(mean.InsertStatistic("mean"));
+  EXPECT_TRUE(var.InsertStatistic("var"));
+  mean.InsertData(1.0);
+  var.InsertData(2.0);
+  EXPECT_FALSE(mean.Merge(var));
+  EXPECT_FALSE(var.Merge(mean));
+  EXPECT_EQ(mean.Count(), 1u);
+  EXPECT_DOUBLE_EQ(mean.Map()["mean"], 1.0);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalStatsMerge)
+{
+  std::vector<double> values(2000);
+  for (auto &v : values)
+    v = math::Rand::DblNormal(5.0, 2.0);
+
+  math::SignalStats all;
+  math::SignalStats a;
+  math::SignalStats b;
+  EXPECT_TRUE(all.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  EXPECT_TRUE(a.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  // The order of the statistics doesn't matter.
+  EXPECT_TRUE(b.InsertStatistics("var,rms,min,mean,maxAbs,max"));
+
+  all.InsertData(values);
+  a.InsertData(values.data(), 700);
+  b.InsertData(values.data() + 700, values.size() - 700);
+  EXPECT_TRUE(a.Merge(b));
+  EXPECT_EQ(a.Count(), values.size());
+
+  auto expected = all.Map();
+  auto map = a.Map();
+  for (const auto &name : {"max", "maxAbs", "mean", "min", "rms", "var"})
+  {
+    EXPECT_NEAR(map[name], expected[name], 1e-12 * std::abs(expected[name]))
+      << name;
+  }
+
+  // Mismatched statistics leave the data unchanged.
+  math::SignalStats fewer;
+  EXPECT_TRUE(fewer.InsertStatistics("max,mean"));
+  fewer.InsertData(100.0);
+  EXPECT_FALSE(a.Merge(fewer));
+  EXPECT_FALSE(fewer.Merge(a));
+  EXPECT_EQ(a.Count(), values.size());
+  EXPECT_EQ(fewer.Count(), 1u);
+  EXPECT_DOUBLE_EQ(a.Map()["max"], expected["max"]);
+  EXPECT_DOUBLE_EQ(fewer.Map()["max"], 100.0);
+
+  // Every pair is checked before anything is merged, so a histogram with
+  // a different range leaves the mean that comes before it unchanged.
+  math::SignalStats c;
+  math::SignalStats d;
+  EXPECT_TRUE(c.InsertStatistics("mean,hist[0:0.1234567:10]"));
+  EXPECT_TRUE(d.InsertStatistics("mean,hist[0:0.12345671:10]"));
+  c.InsertData(1.0);
+  d.InsertData(3.0);
+  EXPECT_FALSE(c.Merge(d));
+  EXPECT_EQ(c.Count(), 1u);
+  EXPECT_DOUBLE_EQ(c.Map()["mean"], 1.0);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, InsertDataParallel)
+{
+  // Enough values to use several threads.
+  std::vector<double> values(300000);
+  for (auto &v : values)
+    v = math::Rand::DblNormal(100.0, 2.0);
+
+  math::SignalStats single;
+  math::SignalStats parallel;
+  EXPECT_TRUE(single.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+  EXPECT_TRUE(parallel.InsertStatistics("max,maxAbs,mean,min,rms,var"));
+
+  single.InsertData(values);
+  parallel.InsertData(values.data(), values.size(), 4);
+  EXPECT_EQ(parallel.Count(), values.size());
+
+  auto expected = single.Map();
+  auto map = parallel.Map();
+  EXPECT_EQ(map.size(), 6u);
+  EXPECT_DOUBLE_EQ(map["max"], expected["max"]);
+  EXPECT_DOUBLE_EQ(map["maxAbs"], expected["maxAbs"]);
+  EXPECT_DOUBLE_EQ(map["min"], expected["min"]);
+  for (const auto &name : {"mean", "rms", "var"})
+    EXPECT_NEAR(map[name], expected[name], 1e-10 * expected[name]) << name;
+
+  // Data already present is kept.
+  parallel.InsertData(values, 3);
+  EXPECT_EQ(parallel.Count(), 2 * values.size());
+  EXPECT_NEAR(parallel.Map()["mean"], expected["mean"],
+      1e-10 * expected["mean"]);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, InsertDataParallelParameters)
+{
+  // Parameters that are not round numbers, whose short names need more
+  // than the default precision of a stream.
+  std::vector<double> values(300000);
+  for (auto &v : values)
+    v = math::Rand::DblUniform(-0.01, 0.13);
+
+  const std::string names = "hist[0:0.1234567:10],p12.3456789";
+  math::SignalStats single;
+  math::SignalStats parallel;
+  EXPECT_TRUE(single.InsertStatistics(names));
+  EXPECT_TRUE(parallel.InsertStatistics(names));
+
+  single.InsertData(values);
+  parallel.InsertData(values, 4);
+  EXPECT_EQ(parallel.Count(), values.size());
+
+  auto expected = single.Map();
+  auto map = parallel.Map();
+  ASSERT_EQ(map.size(), 2u);
+  ASSERT_NE(map.find("hist[0:0.1234567:10]"), map.end());
+  ASSERT_NE(map.find("p12.3456789"), map.end());
+  EXPECT_DOUBLE_EQ(map["hist[0:0.1234567:10]"],
+      expected["hist[0:0.1234567:10]"]);
+  EXPECT_DOUBLE_EQ(map["p12.3456789"], expected["p12.3456789"]);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantile)
+{
+  // Constructor
+  math::SignalQuantile median;
+  EXPECT_DOUBLE_EQ(median.Value(), 0.0);
+  EXPECT_EQ(median.Count(), 0u);
+  EXPECT_EQ(median.ShortName(), "p50");
+  EXPECT_EQ(math::SignalQuantile(0.999).ShortName(), "p99.9");
+  EXPECT_EQ(math::SignalQuantile(2.0).ShortName(), "p100");
+  EXPECT_EQ(math::SignalQuantile(0.123456789).ShortName(), "p12.3456789");
+
+  // 1, 2, ..., 10000 in a scrambled order
+  math::SignalQuantile p99(0.99);
+  std::vector<double> values;
+  for (int i = 0; i < 10000; ++i)
+    values.push_back(1.0 + (i * 7919) % 10000);
+  for (const double v : values)
+  {
+    median.InsertData(v);
+    p99.InsertData(v);
+  }
+  EXPECT_EQ(median.Count(), values.size());
+
+  // Within 1% of the true quantiles
+  EXPECT_NEAR(median.Value(), 5000.5, 0.01 * 5000.5);
+  EXPECT_NEAR(p99.Value(), 9900.0, 0.01 * 9900.0);
+  EXPECT_NEAR(median.Quantile(0.0), 1.0, 0.01);
+  EXPECT_NEAR(median.Quantile(1.0), 10000.0, 0.01 * 10000.0);
+  EXPECT_NEAR(median.Quantile(0.1), 1000.0, 0.01 * 1000.0);
+
+  // Batch insertion is the same
+  math::SignalStats batch;
+  EXPECT_TRUE(batch.InsertStatistic("p50"));
+  batch.InsertData(values.data(), values.size());
+  EXPECT_EQ(batch.Count(), values.size());
+  EXPECT_DOUBLE_EQ(batch.Map()["p50"], median.Value());
+
+  // Merging halves gives the same sketch
+  math::SignalStats a;
+  math::SignalStats b;
+  EXPECT_TRUE(a.InsertStatistics("p0,p25,p50,p99,p100"));
+  EXPECT_TRUE(b.InsertStatistics("p0,p25,p50,p99,p100"));
+  a.InsertData(values.data(), 3000);
+  b.InsertData(values.data() + 3000, values.size() - 3000);
+  EXPECT_TRUE(a.Merge(b));
+  EXPECT_EQ(a.Count(), values.size());
+  auto map = a.Map();
+  EXPECT_DOUBLE_EQ(map["p0"], median.Quantile(0.0));
+  EXPECT_DOUBLE_EQ(map["p25"], median.Quantile(0.25));
+  EXPECT_DOUBLE_EQ(map["p50"], median.Quantile(0.5));
+  EXPECT_DOUBLE_EQ(map["p99"], median.Quantile(0.99));
+  EXPECT_DOUBLE_EQ(map["p100"], median.Quantile(1.0));
+
+  // Copy
+  math::SignalQuantile copy(p99);
+  EXPECT_EQ(copy.ShortName(), "p99");
+  EXPECT_DOUBLE_EQ(copy.Value(), p99.Value());
+
+  // Reset keeps the quantile
+  p99.Reset();
+  EXPECT_EQ(p99.Count(), 0u);
+  EXPECT_DOUBLE_EQ(p99.Value(), 0.0);
+  EXPECT_EQ(p99.ShortName(), "p99");
+  EXPECT_DOUBLE_EQ(copy.Value(), median.Quantile(0.99));
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantileSigns)
+{
+  math::SignalQuantile quantile;
+  const double values[] = {-100.0, -10.0, -1.0, 0.0, 0.0, 1.0, 10.0,
+    std::numeric_limits<double>::quiet_NaN(),
+    std::numeric_limits<double>::infinity()};
+  for (const double v : values)
+    quantile.InsertData(v);
+  EXPECT_EQ(quantile.Count(), 9u);
+
+  // Non-finite values are ignored, which leaves 7 values.
+  EXPECT_NEAR(quantile.Quantile(0.0), -100.0, 1.0);
+  EXPECT_NEAR(quantile.Quantile(1.0 / 6.0), -10.0, 0.1);
+  EXPECT_NEAR(quantile.Quantile(2.0 / 6.0), -1.0, 0.01);
+  EXPECT_DOUBLE_EQ(quantile.Quantile(0.5), 0.0);
+  EXPECT_DOUBLE_EQ(quantile.Quantile(4.0 / 6.0), 0.0);
+  EXPECT_NEAR(quantile.Quantile(5.0 / 6.0), 1.0, 0.01);
+  EXPECT_NEAR(quantile.Quantile(1.0), 10.0, 0.1);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalQuantileWideRange)
+{
+  // Magnitudes from 1e-300 to 1e300 need more buckets than are kept, so
+  // the smallest ones are merged. The 2048 buckets that are kept cover
+  // about 17 orders of magnitude, where the quantiles stay accurate.
+  math::SignalQuantile quantile(0.99);
+  std::vector<double> values;
+  for (int e = -300; e <= 300; ++e)
+    values.push_back(std::pow(10.0, e));
+  // Insert from the largest, then from the smallest
+  for (auto it = values.rbegin(); it != values.rend(); ++it)
+    quantile.InsertData(*it);
+  for (const double v : values)
+    quantile.InsertData(v);
+  EXPECT_EQ(quantile.Count(), 2 * values.size());
+
+  // Each magnitude is inserted twice, the sample of rank r is 10^(r/2-300).
+  EXPECT_NEAR(quantile.Quantile(1.0), 1e300, 0.01 * 1e300);
+  EXPECT_NEAR(quantile.Value(), 1e294, 0.01 * 1e294);
+  EXPECT_NEAR(quantile.Quantile(1170.0 / 1201.0), 1e285, 0.01 * 1e285);
+
+  // Lower quantiles are in the merged bucket.
+  EXPECT_GT(quantile.Quantile(0.0), 1e282);
+  EXPECT_LT(quantile.Quantile(0.0), 1e284);
+  EXPECT_DOUBLE_EQ(quantile.Quantile(0.5), quantile.Quantile(0.0));
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, SignalHistogram)
+{
+  math::SignalHistogram hist(0.0, 10.0, 5);
+  EXPECT_EQ(hist.ShortName(), "hist[0:10:5]");
+  EXPECT_EQ(math::SignalHistogram(-1.0 / 3.0, 0.1234567, 2).ShortName(),
+      "hist[-0.3333333333333333:0.1234567:2]");
+  EXPECT_DOUBLE_EQ(hist.Min(), 0.0);
+  EXPECT_DOUBLE_EQ(hist.Max(), 10.0);
+  ASSERT_EQ(hist.Counts().size(), 5u);
+  EXPECT_DOUBLE_EQ(hist.Value(), 0.0);
+
+  const double values[] = {-1.0, 0.0, 1.0, 2.0, 3.5, 3.9, 9.99, 10.0, 11.0,
+    std::numeric_limits<double>::quiet_NaN()};
+  for (const double v : values)
+    hist.InsertData(v);
+  EXPECT_EQ(hist.Count(), 10u);
+  EXPECT_EQ(hist.Underflow(), 1u);
+  EXPECT_EQ(hist.Overflow(), 1u);
+  EXPECT_EQ(hist.Counts(), std::vector<std::uint64_t>({2, 3, 0, 0, 2}));
+
+  // 9 samples, the median is the 4.5th: halfway through the 2nd bucket.
+  EXPECT_DOUBLE_EQ(hist.Value(), 3.0);
+  EXPECT_DOUBLE_EQ(hist.Quantile(0.0), 0.0);
+  EXPECT_DOUBLE_EQ(hist.Quantile(1.0), 10.0);
+  EXPECT_DOUBLE_EQ(hist.Quantile(8.0 / 9.0), 10.0);
+  EXPECT_DOUBLE_EQ(hist.Quantile(7.0 / 9.0), 9.0);
+
+  // Batch insertion
+  math::SignalStats batch;
+  EXPECT_TRUE(batch.InsertStatistic("hist[0:10:5]"));
+  batch.InsertData(values, 10);
+  EXPECT_EQ(batch.Count(), 10u);
+  EXPECT_DOUBLE_EQ(batch.Map()["hist[0:10:5]"], 3.0);
+
+  // Merge -1, 0, 1 and 2, which gives counts of {4, 4, 0, 0, 2} and 2
+  // samples below the range. The median is the 6.5th of 13 samples.
+  math::SignalStats other;
+  EXPECT_TRUE(other.InsertStatistic("hist[0:10:5]"));
+  other.InsertData(values, 4);
+  EXPECT_TRUE(batch.Merge(other));
+  EXPECT_EQ(batch.Count(), 14u);
+  EXPECT_DOUBLE_EQ(batch.Map()["hist[0:10:5]"], 2.25);
+  math::SignalStats finer;
+  EXPECT_TRUE(finer.InsertStatistic("hist[0:10:10]"));
+  EXPECT_FALSE(batch.Merge(finer));
+
+  // Copy and reset
+  math::SignalHistogram copy(hist);
+  hist.Reset();
+  EXPECT_EQ(hist.Count(), 0u);
+  EXPECT_EQ(hist.Underflow(), 0u);
+  EXPECT_EQ(hist.Counts(), std::vector<std::uint64_t>(5, 0));
+  EXPECT_EQ(copy.Count(), 10u);
+  EXPECT_EQ(copy.Overflow(), 1u);
+
+  // Invalid ranges
+  math::SignalHistogram invalid(1.0, 1.0, 0);
+  EXPECT_DOUBLE_EQ(invalid.Max(), 2.0);
+  EXPECT_EQ(invalid.Counts().size(), 1u);
+}
+
+//////////////////////////////////////////////////
+TEST(SignalStatsTest, InsertQuantileAndHistogram)
+{
+  math::SignalStats stats;
+  EXPECT_TRUE(stats.InsertStatistics("p50,p99,p99.9,hist[0:100:50]"));
+  EXPECT_FALSE(stats.InsertStatistic("p99"));
+  EXPECT_FALSE(stats.InsertStatistic("p99.0"));
+  EXPECT_FALSE(stats.InsertStatistic("hist[0.0:100:50]"));
+  EXPECT_TRUE(stats.InsertStatistic("hist[-1:1:4]"));
+  EXPECT_TRUE(stats.InsertStatistic("p0"));
+  EXPECT_TRUE(stats.InsertStatistic("p0.007"));
+
+  for (const auto &name : {"p", "pmax", "p-1", "p101", "p 50", "p50x",
+                           "hist", "hist[]", "hist[0:1]", "hist[1:0:5]",
+                           "hist[0:1:0]", "hist[0:1:-5]", "hist[0:1:5]x",
+                           "hist[0:1:5:6]", "hist[nan:1:5]",
+                           "hist[0:1:99999999]"})
+  {
+    EXPECT_FALSE(stats.InsertStatistic(name)) << name;
+  }
+
+  for (int i = 1; i <= 100; ++i)
+    stats.InsertData(i - 0.5);
+
+  auto map = stats.Map();
+  EXPECT_EQ(map.size(), 7u);
+  EXPECT_NE(map.find("p0.007"), map.end());
+  EXPECT_NEAR(map["p50"], 50.0, 0.01 * 50.0);
+  EXPECT_NEAR(map["p99"], 99.0, 0.01 * 99.0);
+  EXPECT_NEAR(map["p99.9"], 98.5, 0.01 * 98.5);
+  EXPECT_NEAR(map["p0"], 0.5, 0.01 * 0.5);
+  EXPECT_DOUBLE_EQ(map["hist[0:100:50]"], 50.0);
+  EXPECT_DOUBLE_EQ(map["hist[-1:1:4]"], 1.0);
+
+  // Merge matches the parameterized names
+  math::SignalStats other;
+  EXPECT_TRUE(other.InsertStatistics("hist[-1:1:4],p0,p0.007,p99.9,p99,p50"));
+  EXPECT_TRUE(other.InsertStatistic("hist[0:100:50]"));
+  other.InsertData(200.0);
+  EXPECT_TRUE(stats.Merge(other));
+  EXPECT_EQ(stats.Count(), 101u);
+}
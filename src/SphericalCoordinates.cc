@@ -14,10 +14,15 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "gz/math/Matrix3.hh"
 #include "gz/math/SphericalCoordinates.hh"
+#include "gz/math/detail/ParallelFor.hh"
 
 using namespace gz;
 using namespace math;
@@ -85,8 +90,427 @@ class gz::math::SphericalCoordinatesPrivate
 
   /// \brief Cache sine head transform
   public: double sinHea;
+
+  /// \brief Approximation used for position conversions.
+  public: SphericalCoordinates::ApproximationType approximation =
+    SphericalCoordinates::EXACT;
+
+  /// \brief Coefficients of the second order expansion of geodetic
+  /// coordinates in the tangent plane at the reference point, used by the
+  /// TANGENT_PLANE approximation.
+  public: struct TangentPlane
+  {
+    /// \brief Reference latitude (rad).
+    double latitude = 0;
+
+    /// \brief Reference longitude (rad).
+    double longitude = 0;
+
+    /// \brief Reference elevation (m).
+    double elevation = 0;
+
+    /// \brief Meridian radius of curvature at the reference point (m).
+    double north = 0;
+
+    /// \brief Inverse of north.
+    double invNorth = 0;
+
+    /// \brief Radius of the parallel at the reference point (m).
+    double eastCos = 0;
+
+    /// \brief Inverse of eastCos.
+    double invEastCos = 0;
+
+    /// \brief Inverse of the prime vertical radius of curvature.
+    double invEast = 0;
+
+    /// \brief Latitude coefficient of north * north.
+    double latNorthNorth = 0;
+
+    /// \brief Latitude coefficient of east * east.
+    double latEastEast = 0;
+
+    /// \brief Relative change of the longitude scale per meter north.
+    double lonNorth = 0;
+  } tangent;
 };
 
+namespace
+{
+/// \brief Shorthand for the coordinate types.
+using CoordinateType = SphericalCoordinates::CoordinateType;
+
+/// \brief Number of points converted together by the batch
+/// PositionTransform. Three arrays of this size fit in the L1 cache.
+constexpr std::size_t kBlockSize = 256;
+
+/// \brief Minimum number of points given to each thread by the batch
+/// PositionTransform.
+constexpr std::size_t kGrainSize = 4096;
+
+/// \brief Check that a coordinate type is one of the known values.
+/// \param[in] _type Coordinate type.
+/// \return True if the type is valid.
+bool ValidCoordinateType(const CoordinateType _type)
+{
+  return _type == SphericalCoordinates::SPHERICAL ||
+         _type == SphericalCoordinates::ECEF ||
+         _type == SphericalCoordinates::GLOBAL ||
+         _type == SphericalCoordinates::LOCAL ||
+         _type == SphericalCoordinates::LOCAL2;
+}
+
+/// \brief Rotate a block of GLOBAL positions to ECEF, in place.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in,out] _x X coordinates.
+/// \param[in,out] _y Y coordinates.
+/// \param[in,out] _z Z coordinates.
+/// \param[in] _n Number of points.
+void GlobalToEcef(const SphericalCoordinatesPrivate &_d,
+    double *_x, double *_y, double *_z, const std::size_t _n)
+{
+  const Matrix3d &r = _d.rotGlobalToECEF;
+  const double r00 = r(0, 0), r01 = r(0, 1), r02 = r(0, 2);
+  const double r10 = r(1, 0), r11 = r(1, 1), r12 = r(1, 2);
+  const double r20 = r(2, 0), r21 = r(2, 1), r22 = r(2, 2);
+  const double ox = _d.origin.X(), oy = _d.origin.Y(), oz = _d.origin.Z();
+  for (std::size_t i = 0; i < _n; ++i)
+  {
+    const double x = _x[i], y = _y[i], z = _z[i];
+    _x[i] = ox + (r00 * x + r01 * y + r02 * z);
+    _y[i] = oy + (r10 * x + r11 * y + r12 * z);
+    _z[i] = oz + (r20 * x + r21 * y + r22 * z);
+  }
+}
+
+/// \brief Convert a block of positions to ECEF, in place. Same as the first
+/// stage of SphericalCoordinates::PositionTransform.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in] _in Coordinate type of the input, must be valid.
+/// \param[in,out] _x X coordinates.
+/// \param[in,out] _y Y coordinates.
+/// \param[in,out] _z Z coordinates.
+/// \param[in] _n Number of points.
+void ToEcef(const SphericalCoordinatesPrivate &_d, const CoordinateType _in,
+    double *_x, double *_y, double *_z, const std::size_t _n)
+{
+  const double cosHea = _d.cosHea;
+  const double sinHea = _d.sinHea;
+
+  switch (_in)
+  {
+    case SphericalCoordinates::LOCAL:
+      for (std::size_t i = 0; i < _n; ++i)
+      {
+        const double x = _x[i], y = _y[i];
+        _x[i] = -x * cosHea + y * sinHea;
+        _y[i] = -x * sinHea - y * cosHea;
+      }
+      GlobalToEcef(_d, _x, _y, _z, _n);
+      break;
+
+    case SphericalCoordinates::LOCAL2:
+      for (std::size_t i = 0; i < _n; ++i)
+      {
+        const double x = _x[i], y = _y[i];
+        _x[i] = x * cosHea + y * sinHea;
+        _y[i] = -x * sinHea + y * cosHea;
+      }
+      GlobalToEcef(_d, _x, _y, _z, _n);
+      break;
+
+    case SphericalCoordinates::GLOBAL:
+      GlobalToEcef(_d, _x, _y, _z, _n);
+      break;
+
+    case SphericalCoordinates::SPHERICAL:
+    {
+      const double a = _d.ellA;
+      const double e2 = _d.ellE * _d.ellE;
+      const double b2a2 = (_d.ellB * _d.ellB) / (_d.ellA * _d.ellA);
+      for (std::size_t i = 0; i < _n; ++i)
+      {
+        const double cosLat = cos(_x[i]);
+        const double sinLat = sin(_x[i]);
+        const double cosLon = cos(_y[i]);
+        const double sinLon = sin(_y[i]);
+        const double curvature = a / sqrt(1.0 - e2 * sinLat * sinLat);
+        const double z = _z[i];
+        _x[i] = (z + curvature) * cosLat * cosLon;
+        _y[i] = (z + curvature) * cosLat * sinLon;
+        _z[i] = (b2a2 * curvature + z) * sinLat;
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+/// \brief Convert a block of ECEF positions, in place. Same as the second
+/// stage of SphericalCoordinates::PositionTransform, except that the sines
+/// and cosines of the Bowring latitude iteration are computed from tangents,
+/// and that points on the polar axis are handled exactly.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in] _out Coordinate type of the output, must be valid.
+/// \param[in,out] _x X coordinates.
+/// \param[in,out] _y Y coordinates.
+/// \param[in,out] _z Z coordinates.
+/// \param[in] _n Number of points.
+void FromEcef(const SphericalCoordinatesPrivate &_d,
+    const CoordinateType _out, double *_x, double *_y, double *_z,
+    const std::size_t _n)
+{
+  if (_out == SphericalCoordinates::SPHERICAL)
+  {
+    const double a = _d.ellA;
+    const double b = _d.ellB;
+    const double e2 = _d.ellE * _d.ellE;
+    const double p2b = _d.ellP * _d.ellP * b;
+    const double e2a = e2 * a;
+    for (std::size_t i = 0; i < _n; ++i)
+    {
+      const double x = _x[i], y = _y[i], z = _z[i];
+      const double p = sqrt(x * x + y * y);
+
+      // theta = atan(u / v), with v >= 0.
+      const double u = z * a;
+      const double v = p * b;
+      const double r = sqrt(u * u + v * v);
+      const double sinTheta = u / r;
+      const double cosTheta = v / r;
+
+      const double num = z + p2b * sinTheta * sinTheta * sinTheta;
+      const double den = p - e2a * cosTheta * cosTheta * cosTheta;
+
+      _y[i] = atan2(y, x);
+      if (p > 0)
+      {
+        const double t = num / den;
+        const double cosLat = 1.0 / sqrt(1.0 + t * t);
+        const double sinLat = t * cosLat;
+        const double nCurvature = a / sqrt(1.0 - e2 * sinLat * sinLat);
+        _x[i] = atan(t);
+        _z[i] = p / cosLat - nCurvature;
+      }
+      else
+      {
+        // On the polar axis the tangent of the latitude is infinite.
+        _x[i] = std::copysign(IGN_PI_2, z);
+        _z[i] = std::abs(z) - b;
+      }
+    }
+    return;
+  }
+
+  if (_out == SphericalCoordinates::ECEF)
+    return;
+
+  const Matrix3d &r = _d.rotECEFToGlobal;
+  const double r00 = r(0, 0), r01 = r(0, 1), r02 = r(0, 2);
+  const double r10 = r(1, 0), r11 = r(1, 1), r12 = r(1, 2);
+  const double r20 = r(2, 0), r21 = r(2, 1), r22 = r(2, 2);
+  const double ox = _d.origin.X(), oy = _d.origin.Y(), oz = _d.origin.Z();
+  for (std::size_t i = 0; i < _n; ++i)
+  {
+    const double x = _x[i] - ox, y = _y[i] - oy, z = _z[i] - oz;
+    _x[i] = r00 * x + r01 * y + r02 * z;
+    _y[i] = r10 * x + r11 * y + r12 * z;
+    _z[i] = r20 * x + r21 * y + r22 * z;
+  }
+
+  if (_out == SphericalCoordinates::LOCAL ||
+      _out == SphericalCoordinates::LOCAL2)
+  {
+    const double cosHea = _d.cosHea;
+    const double sinHea = _d.sinHea;
+    for (std::size_t i = 0; i < _n; ++i)
+    {
+      const double x = _x[i], y = _y[i];
+      _x[i] = x * cosHea - y * sinHea;
+      _y[i] = x * sinHea + y * cosHea;
+    }
+  }
+}
+
+/// \brief Check if a conversion uses the tangent plane approximation.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in] _in Coordinate type of the input.
+/// \param[in] _out Coordinate type of the output.
+/// \return True if exactly one of _in and _out is SPHERICAL and the other
+/// one is GLOBAL, LOCAL or LOCAL2.
+bool UseTangentPlane(const SphericalCoordinatesPrivate &_d,
+    const CoordinateType _in, const CoordinateType _out)
+{
+  if (_d.approximation != SphericalCoordinates::TANGENT_PLANE)
+    return false;
+
+  auto cartesian = [](const CoordinateType _type)
+  {
+    return _type == SphericalCoordinates::GLOBAL ||
+           _type == SphericalCoordinates::LOCAL ||
+           _type == SphericalCoordinates::LOCAL2;
+  };
+  return (_in == SphericalCoordinates::SPHERICAL && cartesian(_out)) ||
+         (_out == SphericalCoordinates::SPHERICAL && cartesian(_in));
+}
+
+/// \brief Wrap an angle difference to [-pi, pi].
+/// \param[in] _angle Angle (rad), within [-3 pi, 3 pi].
+/// \return Wrapped angle.
+double WrapPi(const double _angle)
+{
+  if (_angle > IGN_PI)
+    return _angle - 2 * IGN_PI;
+  if (_angle < -IGN_PI)
+    return _angle + 2 * IGN_PI;
+  return _angle;
+}
+
+/// \brief Convert one position with the tangent plane approximation.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in] _in Coordinate type of the input.
+/// \param[in] _out Coordinate type of the output.
+/// \param[in,out] _x X coordinate.
+/// \param[in,out] _y Y coordinate.
+/// \param[in,out] _z Z coordinate.
+/// \sa UseTangentPlane
+void TangentPlaneTransform(const SphericalCoordinatesPrivate &_d,
+    const CoordinateType _in, const CoordinateType _out,
+    double &_x, double &_y, double &_z)
+{
+  const SphericalCoordinatesPrivate::TangentPlane &t = _d.tangent;
+
+  if (_out == SphericalCoordinates::SPHERICAL)
+  {
+    // East, north, up
+    double e = _x;
+    double n = _y;
+    const double u = _z;
+    if (_in == SphericalCoordinates::LOCAL)
+    {
+      e = -_x * _d.cosHea + _y * _d.sinHea;
+      n = -_x * _d.sinHea - _y * _d.cosHea;
+    }
+    else if (_in == SphericalCoordinates::LOCAL2)
+    {
+      e = _x * _d.cosHea + _y * _d.sinHea;
+      n = -_x * _d.sinHea + _y * _d.cosHea;
+    }
+
+    _x = t.latitude + n * t.invNorth * (1.0 - u * t.invNorth) +
+      n * n * t.latNorthNorth + e * e * t.latEastEast;
+    _y = WrapPi(t.longitude +
+        e * t.invEastCos * (1.0 - u * t.invEast + n * t.lonNorth));
+    _z = t.elevation + u + 0.5 * (e * e * t.invEast + n * n * t.invNorth);
+    return;
+  }
+
+  // First order east and north, then second order terms.
+  const double n1 = (_x - t.latitude) * t.north;
+  const double e1 = WrapPi(_y - t.longitude) * t.eastCos;
+  const double u = _z - t.elevation -
+    0.5 * (e1 * e1 * t.invEast + n1 * n1 * t.invNorth);
+  const double n = n1 + n1 * u * t.invNorth -
+    (n1 * n1 * t.latNorthNorth + e1 * e1 * t.latEastEast) * t.north;
+  const double e = e1 * (1.0 + u * t.invEast - n1 * t.lonNorth);
+
+  _x = e;
+  _y = n;
+  _z = u;
+  if (_out == SphericalCoordinates::LOCAL ||
+      _out == SphericalCoordinates::LOCAL2)
+  {
+    _x = e * _d.cosHea - n * _d.sinHea;
+    _y = e * _d.sinHea + n * _d.cosHea;
+  }
+}
+
+/// \brief Convert a contiguous array of positions, see
+/// SphericalCoordinates::PositionTransform.
+/// \param[in] _d Spherical coordinates data.
+/// \param[in] _pos Input positions.
+/// \param[out] _result Output positions, may be equal to _pos.
+/// \param[in] _count Number of points.
+/// \param[in] _in Coordinate type of the input.
+/// \param[in] _out Coordinate type of the output.
+/// \param[in] _degrees True if the latitude and longitude of SPHERICAL
+/// positions are in degrees instead of radians.
+/// \param[in] _threads Maximum number of threads.
+void Transform(const SphericalCoordinatesPrivate &_d, const Vector3d *_pos,
+    Vector3d *_result, const std::size_t _count, const CoordinateType _in,
+    const CoordinateType _out, const bool _degrees,
+    const unsigned int _threads)
+{
+  if (!ValidCoordinateType(_in) || !ValidCoordinateType(_out))
+  {
+    if (!ValidCoordinateType(_in))
+      std::cerr << "Invalid coordinate type[" << _in << "]\n";
+    else
+      std::cerr << "Unknown coordinate type[" << _out << "]\n";
+    if (_result != _pos)
+      std::copy(_pos, _pos + _count, _result);
+    return;
+  }
+
+  const bool tangentPlane = UseTangentPlane(_d, _in, _out);
+  const bool degreesIn = _degrees && _in == SphericalCoordinates::SPHERICAL;
+  const bool degreesOut =
+    _degrees && _out == SphericalCoordinates::SPHERICAL;
+
+  detail::ParallelFor(_count, _threads,
+      [&](const std::size_t _begin, const std::size_t _end)
+      {
+        double x[kBlockSize];
+        double y[kBlockSize];
+        double z[kBlockSize];
+        for (std::size_t start = _begin; start < _end; start += kBlockSize)
+        {
+          const std::size_t n = std::min(kBlockSize, _end - start);
+          const Vector3d *in = _pos + start;
+          for (std::size_t i = 0; i < n; ++i)
+          {
+            x[i] = in[i].X();
+            y[i] = in[i].Y();
+            z[i] = in[i].Z();
+          }
+          if (degreesIn)
+          {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+              x[i] = IGN_DTOR(x[i]);
+              y[i] = IGN_DTOR(y[i]);
+            }
+          }
+
+          if (tangentPlane)
+          {
+            for (std::size_t i = 0; i < n; ++i)
+              TangentPlaneTransform(_d, _in, _out, x[i], y[i], z[i]);
+          }
+          else
+          {
+            ToEcef(_d, _in, x, y, z, n);
+            FromEcef(_d, _out, x, y, z, n);
+          }
+
+          if (degreesOut)
+          {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+              x[i] = IGN_RTOD(x[i]);
+              y[i] = IGN_RTOD(y[i]);
+            }
+          }
+          Vector3d *out = _result + start;
+          for (std::size_t i = 0; i < n; ++i)
+            out[i].Set(x[i], y[i], z[i]);
+        }
+      }, kGrainSize);
+}
+}
+
 //////////////////////////////////////////////////
 SphericalCoordinates::SurfaceType SphericalCoordinates::Convert(
   const std::string &_str)
@@ -230,6 +654,19 @@ void SphericalCoordinates::SetSurface(const SurfaceType &_type)
   }
 }
 
+//////////////////////////////////////////////////
+SphericalCoordinates::ApproximationType
+SphericalCoordinates::Approximation() const
+{
+  return this->dataPtr->approximation;
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::SetApproximation(const ApproximationType &_type)
+{
+  this->dataPtr->approximation = _type;
+}
+
 //////////////////////////////////////////////////
 void SphericalCoordinates::SetLatitudeReference(
     const Angle &_angle)
@@ -281,6 +718,23 @@ Vector3d SphericalCoordinates::LocalFromSphericalPosition(
   return this->PositionTransform(result, SPHERICAL, LOCAL);
 }
 
+//////////////////////////////////////////////////
+void SphericalCoordinates::SphericalFromLocalPosition(const Vector3d *_xyz,
+    Vector3d *_latLonEle, std::size_t _count, unsigned int _threads) const
+{
+  Transform(*this->dataPtr, _xyz, _latLonEle, _count, LOCAL, SPHERICAL, true,
+      _threads);
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::LocalFromSphericalPosition(
+    const Vector3d *_latLonEle, Vector3d *_xyz, std::size_t _count,
+    unsigned int _threads) const
+{
+  Transform(*this->dataPtr, _latLonEle, _xyz, _count, SPHERICAL, LOCAL, true,
+      _threads);
+}
+
 //////////////////////////////////////////////////
 Vector3d SphericalCoordinates::GlobalFromLocalVelocity(
     const Vector3d &_xyz) const
@@ -354,6 +808,35 @@ void SphericalCoordinates::UpdateTransformationMatrix()
     this->dataPtr->elevationReference);
   this->dataPtr->origin =
     this->PositionTransform(this->dataPtr->origin, SPHERICAL, ECEF);
+
+  // Expansion of the geodetic coordinates in the tangent plane, to second
+  // order in the east, north and up offsets.
+  const double e2 = this->dataPtr->ellE * this->dataPtr->ellE;
+  const double w2 = 1.0 - e2 * sinLat * sinLat;
+  const double radiusEast = this->dataPtr->ellA / sqrt(w2);
+  const double radiusNorth = radiusEast * (1.0 - e2) / w2;
+  const double tanLat = sinLat / cosLat;
+
+  auto &t = this->dataPtr->tangent;
+  t.latitude = this->dataPtr->latitudeReference.Radian();
+  t.longitude = this->dataPtr->longitudeReference.Radian();
+  t.elevation = this->dataPtr->elevationReference;
+  t.north = radiusNorth + t.elevation;
+  t.invNorth = 1.0 / t.north;
+  t.invEast = 1.0 / (radiusEast + t.elevation);
+  t.eastCos = (radiusEast + t.elevation) * cosLat;
+  t.invEastCos = 1.0 / t.eastCos;
+
+  // The meridian radius grows towards the poles.
+  const double dRadiusNorth = 3.0 * radiusNorth * e2 * sinLat * cosLat / w2;
+  t.latNorthNorth = -0.5 * dRadiusNorth * t.invNorth * t.invNorth *
+    t.invNorth;
+
+  // Moving east along the plane leaves the parallel towards the equator.
+  t.latEastEast = -0.5 * tanLat * t.invNorth * t.invEast;
+
+  // Derivative of the log of the parallel radius with respect to north.
+  t.lonNorth = (tanLat - e2 * sinLat * cosLat / w2) * t.invNorth;
 }
 
 /////////////////////////////////////////////////
@@ -361,6 +844,13 @@ Vector3d SphericalCoordinates::PositionTransform(
     const Vector3d &_pos,
     const CoordinateType &_in, const CoordinateType &_out) const
 {
+  if (UseTangentPlane(*this->dataPtr, _in, _out))
+  {
+    double x = _pos.X(), y = _pos.Y(), z = _pos.Z();
+    TangentPlaneTransform(*this->dataPtr, _in, _out, x, y, z);
+    return Vector3d(x, y, z);
+  }
+
   Vector3d tmp = _pos;
 
   // Cache trig results
@@ -484,6 +974,24 @@ Vector3d SphericalCoordinates::PositionTransform(
   return tmp;
 }
 
+//////////////////////////////////////////////////
+void SphericalCoordinates::PositionTransform(const Vector3d *_pos,
+    Vector3d *_result, std::size_t _count, const CoordinateType &_in,
+    const CoordinateType &_out, unsigned int _threads) const
+{
+  Transform(*this->dataPtr, _pos, _result, _count, _in, _out, false,
+      _threads);
+}
+
+//////////////////////////////////////////////////
+void SphericalCoordinates::PositionTransform(std::vector<Vector3d> &_pos,
+    const CoordinateType &_in, const CoordinateType &_out,
+    unsigned int _threads) const
+{
+  this->PositionTransform(_pos.data(), _pos.data(), _pos.size(), _in, _out,
+      _threads);
+}
+
 //////////////////////////////////////////////////
 Vector3d SphericalCoordinates::VelocityTransform(
     const Vector3d &_vel,
@@ -566,7 +1074,8 @@ bool SphericalCoordinates::operator==(const SphericalCoordinates &_sc) const
          this->LatitudeReference() == _sc.LatitudeReference() &&
          this->LongitudeReference() == _sc.LongitudeReference() &&
          equal(this->ElevationReference(), _sc.ElevationReference()) &&
-         this->HeadingOffset() == _sc.HeadingOffset();
+         this->HeadingOffset() == _sc.HeadingOffset() &&
+         this->Approximation() == _sc.Approximation();
 }
 
 //////////////////////////////////////////////////
@@ -584,6 +1093,7 @@ SphericalCoordinates &SphericalCoordinates::operator=(
   this->SetLongitudeReference(_sc.LongitudeReference());
   this->SetElevationReference(_sc.ElevationReference());
   this->SetHeadingOffset(_sc.HeadingOffset());
+  this->SetApproximation(_sc.Approximation());
 
   // Generate transformation matrix
   this->UpdateTransformationMatrix();
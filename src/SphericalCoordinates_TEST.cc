@@ -16,6 +16,8 @@
 */
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "gz/math/SphericalCoordinates.hh"
 
 using namespace gz;
@@ -667,3 +669,234 @@ TEST(SphericalCoordinatesTest, Inverse)
     EXPECT_EQ(in, reverse);
   }
 }
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, BatchPositionTransform)
+{
+  using SC = math::SphericalCoordinates;
+  SC sc(SC::EARTH_WGS84, math::Angle(0.3), math::Angle(-1.2), 354.1,
+      math::Angle(0.5));
+
+  // Local points spread over a few hundred kilometers, which is more than a
+  // block and less than the grain of a thread.
+  std::vector<math::Vector3d> local;
+  for (int i = 0; i < 1000; ++i)
+  {
+    local.emplace_back((i % 37 - 18) * 1e4, (i % 23 - 11) * 1.7e4,
+        (i % 11 - 5) * 300.0);
+  }
+
+  const SC::CoordinateType types[] =
+    {SC::SPHERICAL, SC::ECEF, SC::GLOBAL, SC::LOCAL, SC::LOCAL2};
+
+  for (const auto in : types)
+  {
+    std::vector<math::Vector3d> input;
+    for (const auto &p : local)
+      input.push_back(sc.PositionTransform(p, SC::LOCAL2, in));
+
+    for (const auto out : types)
+    {
+      std::vector<math::Vector3d> result(input.size());
+      sc.PositionTransform(input.data(), result.data(), input.size(), in,
+          out);
+
+      for (std::size_t i = 0; i < input.size(); ++i)
+      {
+        const auto expected = sc.PositionTransform(input[i], in, out);
+        if (out == SC::SPHERICAL)
+        {
+          EXPECT_NEAR(expected.X(), result[i].X(), 1e-14);
+          EXPECT_NEAR(expected.Y(), result[i].Y(), 1e-14);
+          EXPECT_NEAR(expected.Z(), result[i].Z(), 1e-6);
+        }
+        else
+        {
+          EXPECT_EQ(expected, result[i]) << in << " " << out << " " << i;
+        }
+      }
+
+      // In place, with threads
+      std::vector<math::Vector3d> inPlace = input;
+      sc.PositionTransform(inPlace, in, out, 4);
+      EXPECT_EQ(result, inPlace);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, BatchLocalSpherical)
+{
+  math::SphericalCoordinates sc(math::SphericalCoordinates::EARTH_WGS84,
+      math::Angle(IGN_DTOR(-22.9)), math::Angle(IGN_DTOR(-43.2)), 10.0,
+      math::Angle(IGN_DTOR(30.0)));
+
+  std::vector<math::Vector3d> local;
+  for (int i = 0; i < 20000; ++i)
+  {
+    local.emplace_back((i % 101 - 50) * 20.0, (i % 97 - 48) * 20.0,
+        (i % 7) * 3.0);
+  }
+
+  std::vector<math::Vector3d> spherical(local.size());
+  sc.SphericalFromLocalPosition(local.data(), spherical.data(),
+      local.size(), 3);
+
+  std::vector<math::Vector3d> back(local.size());
+  sc.LocalFromSphericalPosition(spherical.data(), back.data(),
+      spherical.size(), 3);
+
+  for (std::size_t i = 0; i < local.size(); ++i)
+  {
+    const auto expected = sc.SphericalFromLocalPosition(local[i]);
+    EXPECT_NEAR(expected.X(), spherical[i].X(), 1e-12);
+    EXPECT_NEAR(expected.Y(), spherical[i].Y(), 1e-12);
+    EXPECT_NEAR(expected.Z(), spherical[i].Z(), 1e-6);
+
+    EXPECT_EQ(sc.LocalFromSphericalPosition(spherical[i]), back[i]);
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, BatchPolarAxis)
+{
+  // The single point conversion loses precision close to the polar axis, so
+  // compare with the exact values.
+  math::SphericalCoordinates sc;
+  const math::Vector3d ecef[] =
+    {{0, 0, 6356752.314245}, {0, 0, -6356000.0}, {1e-3, 0, 6356752.0}};
+
+  math::Vector3d result[3];
+  sc.PositionTransform(ecef, result, 3, math::SphericalCoordinates::ECEF,
+      math::SphericalCoordinates::SPHERICAL);
+
+  EXPECT_DOUBLE_EQ(IGN_PI_2, result[0].X());
+  EXPECT_DOUBLE_EQ(0.0, result[0].Y());
+  EXPECT_NEAR(0.0, result[0].Z(), 1e-6);
+
+  EXPECT_DOUBLE_EQ(-IGN_PI_2, result[1].X());
+  EXPECT_DOUBLE_EQ(0.0, result[1].Y());
+  EXPECT_NEAR(-752.314245, result[1].Z(), 1e-6);
+
+  EXPECT_NEAR(IGN_PI_2, result[2].X(), 1e-9);
+  EXPECT_DOUBLE_EQ(0.0, result[2].Y());
+  EXPECT_NEAR(-0.314245, result[2].Z(), 1e-6);
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, BatchBadCoordinateType)
+{
+  math::SphericalCoordinates sc;
+  const math::Vector3d pos[] = {{1, 2, -4}, {5, 6, 7}};
+  math::Vector3d result[2];
+
+  sc.PositionTransform(pos, result, 2,
+      static_cast<math::SphericalCoordinates::CoordinateType>(7),
+      math::SphericalCoordinates::ECEF);
+  EXPECT_EQ(pos[0], result[0]);
+  EXPECT_EQ(pos[1], result[1]);
+
+  result[0] = result[1] = math::Vector3d::Zero;
+  sc.PositionTransform(pos, result, 2,
+      math::SphericalCoordinates::LOCAL,
+      static_cast<math::SphericalCoordinates::CoordinateType>(6));
+  EXPECT_EQ(pos[0], result[0]);
+  EXPECT_EQ(pos[1], result[1]);
+
+  // Empty input
+  sc.PositionTransform(pos, result, 0,
+      math::SphericalCoordinates::LOCAL,
+      math::SphericalCoordinates::SPHERICAL);
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, TangentPlane)
+{
+  using SC = math::SphericalCoordinates;
+
+  SC sc;
+  EXPECT_EQ(SC::EXACT, sc.Approximation());
+
+  // Check the documented error bound, near the antimeridian to also check
+  // the longitude wrap.
+  for (const double latitude : {0.0, 45.0, 60.0, -60.0, 80.0})
+  {
+    SC exact(SC::EARTH_WGS84, math::Angle(IGN_DTOR(latitude)),
+        math::Angle(IGN_DTOR(179.99)), 300.0, math::Angle(0.4));
+    SC approx = exact;
+    EXPECT_EQ(exact, approx);
+    approx.SetApproximation(SC::TANGENT_PLANE);
+    EXPECT_EQ(SC::TANGENT_PLANE, approx.Approximation());
+    EXPECT_NE(exact, approx);
+
+    const double bound = std::abs(latitude) <= 60.0 ? 5e-3 : 5e-2;
+    for (int i = 0; i < 16; ++i)
+    {
+      const double angle = i * IGN_PI / 8;
+      for (const double up : {-1000.0, 0.0, 1000.0})
+      {
+        const math::Vector3d local(5000 * cos(angle), 5000 * sin(angle), up);
+
+        // LOCAL2 to SPHERICAL, error measured in the local frame.
+        const auto spherical = approx.PositionTransform(local, SC::LOCAL2,
+            SC::SPHERICAL);
+        EXPECT_GT(IGN_PI, std::abs(spherical.Y()));
+        const auto back = exact.PositionTransform(spherical, SC::SPHERICAL,
+            SC::LOCAL2);
+        EXPECT_GT(bound, (back - local).Length()) << latitude << " " << i;
+
+        // SPHERICAL to LOCAL2
+        const auto exactSpherical = exact.PositionTransform(local,
+            SC::LOCAL2, SC::SPHERICAL);
+        const auto approxLocal = approx.PositionTransform(exactSpherical,
+            SC::SPHERICAL, SC::LOCAL2);
+        EXPECT_GT(bound, (approxLocal - local).Length());
+
+        // The other Cartesian frames go through the same heading rotation.
+        const auto global = exact.PositionTransform(local, SC::LOCAL2,
+            SC::GLOBAL);
+        EXPECT_GT(bound, (approx.PositionTransform(exactSpherical,
+              SC::SPHERICAL, SC::GLOBAL) - global).Length());
+        const auto viaLocal = exact.PositionTransform(
+            exact.PositionTransform(local, SC::LOCAL, SC::SPHERICAL),
+            SC::SPHERICAL, SC::GLOBAL);
+        EXPECT_GT(bound, (exact.PositionTransform(
+              approx.PositionTransform(local, SC::LOCAL, SC::SPHERICAL),
+              SC::SPHERICAL, SC::GLOBAL) - viaLocal).Length());
+      }
+    }
+
+    // ECEF conversions stay exact.
+    const math::Vector3d local(100, 200, 300);
+    const auto ecef = exact.PositionTransform(local, SC::LOCAL2, SC::ECEF);
+    EXPECT_EQ(ecef, approx.PositionTransform(local, SC::LOCAL2, SC::ECEF));
+    EXPECT_EQ(exact.PositionTransform(ecef, SC::ECEF, SC::SPHERICAL),
+        approx.PositionTransform(ecef, SC::ECEF, SC::SPHERICAL));
+  }
+}
+
+//////////////////////////////////////////////////
+TEST(SphericalCoordinatesTest, TangentPlaneBatch)
+{
+  math::SphericalCoordinates sc(math::SphericalCoordinates::EARTH_WGS84,
+      math::Angle(IGN_DTOR(47.6)), math::Angle(IGN_DTOR(-122.3)), 50.0,
+      math::Angle(IGN_DTOR(-20.0)));
+  sc.SetApproximation(math::SphericalCoordinates::TANGENT_PLANE);
+
+  std::vector<math::Vector3d> local;
+  for (int i = 0; i < 5000; ++i)
+    local.emplace_back((i % 61 - 30) * 50.0, (i % 59 - 29) * 50.0, i % 13);
+
+  std::vector<math::Vector3d> spherical(local.size());
+  sc.SphericalFromLocalPosition(local.data(), spherical.data(),
+      local.size(), 2);
+  std::vector<math::Vector3d> back(local.size());
+  sc.LocalFromSphericalPosition(spherical.data(), back.data(),
+      spherical.size());
+
+  for (std::size_t i = 0; i < local.size(); ++i)
+  {
+    EXPECT_EQ(sc.SphericalFromLocalPosition(local[i]), spherical[i]);
+    EXPECT_EQ(sc.LocalFromSphericalPosition(spherical[i]), back[i]);
+  }
+}
@@ -17,6 +17,11 @@
 // Note: Originally cribbed from Ogre3d. Modified to implement Cardinal
 // spline and catmull-rom spline
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
 #include "SplinePrivate.hh"
 #include "gz/math/Helpers.hh"
 #include "gz/math/Vector4.hh"
@@ -25,14 +30,314 @@
 using namespace gz;
 using namespace math;
 
+namespace
+{
+/// \brief Number of pieces each segment is split into to integrate its arc
+/// length for the arc length table.
+constexpr std::size_t kPieces = 16;
+
+/// \brief Maximum number of iterations to invert the arc length of a piece.
+constexpr int kMaxIterations = 20;
+
+/// \brief Tolerance to invert the arc length of a piece, relative to the
+/// arc length of the piece.
+constexpr double kTolerance = 1e-10;
+
+///////////////////////////////////////////////////////////
+/// \brief Find the parameter value of a segment at a given arc length from
+/// the start of a piece, with Newton's method safeguarded by bisection.
+/// \param[in] _segment The segment.
+/// \param[in] _start Parameter value at the start of the piece.
+/// \param[in] _end Parameter value at the end of the piece.
+/// \param[in] _pieceLength Arc length of the piece.
+/// \param[in] _length Arc length from the start of the piece.
+/// \return Parameter value in the range _start to _end.
+double PieceParameter(const IntervalCubicSpline &_segment,
+                      const double _start, const double _end,
+                      const double _pieceLength, const double _length)
+{
+  if (_length <= 0.0 || _pieceLength <= 0.0)
+    return _start;
+  if (_length >= _pieceLength)
+    return _end;
+
+  double low = _start;
+  double high = _end;
+  double u = _start + (_end - _start) * _length / _pieceLength;
+  for (int i = 0; i < kMaxIterations; ++i)
+  {
+    const double error = _segment.ArcLength(_start, u) - _length;
+    if (std::abs(error) <= kTolerance * _pieceLength)
+      break;
+    if (error > 0.0)
+      high = u;
+    else
+      low = u;
+
+    // The derivative of the arc length is the speed.
+    const double speed = _segment.InterpolateMthDerivative(1, u).Length();
+    double next = speed > 0.0 ? u - error / speed : low;
+    if (next <= low || next >= high)
+      next = 0.5 * (low + high);
+    u = next;
+  }
+  return u;
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Fill the arc length table of a spline from its segments. The arc
+/// length of each segment is integrated piecewise, which is more accurate
+/// than the single quadrature of IntervalCubicSpline::ArcLength().
+/// \param[in,out] _data Spline data.
+void BuildArcLengthTable(SplinePrivate &_data)
+{
+  _data.arcLengthTable.clear();
+  _data.arcLengthTableSlopes.clear();
+  if (_data.arcLengthTableSize == 0 || _data.segments.empty())
+    return;
+
+  const std::size_t size = _data.arcLengthTableSize;
+  const std::size_t numSegments = _data.segments.size();
+  const double pieceSize = 1.0 / kPieces;
+
+  std::vector<double> pieceLengths(numSegments * kPieces);
+  double total = 0.0;
+  for (std::size_t i = 0; i < numSegments; ++i)
+  {
+    for (std::size_t j = 0; j < kPieces; ++j)
+    {
+      const double length = _data.segments[i].ArcLength(
+          j * pieceSize, j + 1 < kPieces ? (j + 1) * pieceSize : 1.0);
+      pieceLengths[i * kPieces + j] = length;
+      total += length;
+    }
+  }
+
+  _data.arcLengthTable.resize(size + 1);
+  _data.arcLengthTableSlopes.resize(size + 1);
+  std::size_t piece = 0;
+  double pieceStart = 0.0;
+  for (std::size_t k = 0; k < size; ++k)
+  {
+    const double length = total * static_cast<double>(k) / size;
+    while (piece + 1 < pieceLengths.size() &&
+           pieceStart + pieceLengths[piece] <= length)
+    {
+      pieceStart += pieceLengths[piece];
+      ++piece;
+    }
+    const std::size_t index = piece / kPieces;
+    const std::size_t j = piece % kPieces;
+    const double u = PieceParameter(_data.segments[index], j * pieceSize,
+          j + 1 < kPieces ? (j + 1) * pieceSize : 1.0,
+          pieceLengths[piece], length - pieceStart);
+    _data.arcLengthTable[k] = static_cast<double>(index) + u;
+
+    // The derivative of the parameter with respect to the arc length is
+    // the inverse of the speed.
+    _data.arcLengthTableSlopes[k] = total / size /
+      _data.segments[index].InterpolateMthDerivative(1, u).Length();
+  }
+  _data.arcLengthTable[size] = static_cast<double>(numSegments);
+  _data.arcLengthTableSlopes[size] = total / size /
+    _data.segments.back().InterpolateMthDerivative(1, 1.0).Length();
+
+  // Where the curve stops, fall back to the slope of the neighbours.
+  for (std::size_t k = 0; k <= size; ++k)
+  {
+    if (!std::isfinite(_data.arcLengthTableSlopes[k]))
+    {
+      const double before = k > 0 ?
+        _data.arcLengthTable[k] - _data.arcLengthTable[k - 1] : 0.0;
+      const double after = k < size ?
+        _data.arcLengthTable[k + 1] - _data.arcLengthTable[k] : 0.0;
+      _data.arcLengthTableSlopes[k] = std::max(before, after);
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Check if a spline is closed.
+/// \param[in] _data Spline data, with at least one point.
+/// \return True if the first and last points are the same.
+bool IsClosed(const SplinePrivate &_data)
+{
+  return _data.points.front().MthDerivative(0) ==
+         _data.points.back().MthDerivative(0);
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Compute the tangent of one point unless it is fixed, see
+/// Spline::RecalcTangents.
+/// \param[in,out] _data Spline data, with at least two points.
+/// \param[in] _i Index of the point.
+/// \param[in] _isClosed Whether the spline is closed.
+void ComputeTangent(SplinePrivate &_data, const size_t _i,
+                    const bool _isClosed)
+{
+  if (_data.fixings[_i])
+    return;
+
+  const size_t numPoints = _data.points.size();
+  const double t = 1.0 - _data.tension;
+  auto point = [&_data](const size_t _j)
+  {
+    return _data.points[_j].MthDerivative(0);
+  };
+
+  Vector3d tangent;
+  if (_i == 0)
+  {
+    // Special case start
+    if (_isClosed)
+    {
+      // Use points-2 since points-1 is the last point and == [0]
+      tangent = ((point(1) - point(numPoints-2)) * 0.5) * t;
+    }
+    else
+    {
+      tangent = ((point(1) - point(0)) * 0.5) * t;
+    }
+  }
+  else if (_i == numPoints-1)
+  {
+    // Special case end
+    if (_isClosed)
+    {
+      // Use same tangent as already calculated for [0]
+      tangent = _data.points[0].MthDerivative(1);
+    }
+    else
+    {
+      tangent = ((point(_i) - point(_i-1)) * 0.5) * t;
+    }
+  }
+  else
+  {
+    tangent = ((point(_i+1) - point(_i-1)) * 0.5) * t;
+  }
+  _data.points[_i].MthDerivative(1) = tangent;
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Set the control points of a segment.
+/// \param[in,out] _data Spline data.
+/// \param[in] _i Index of the segment.
+void SetSegment(SplinePrivate &_data, const size_t _i)
+{
+  _data.segments[_i].SetPoints(_data.points[_i], _data.points[_i+1]);
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Update the cumulative arc lengths from a segment on, the arc
+/// length and the arc length table.
+/// \param[in,out] _data Spline data, with at least one segment.
+/// \param[in] _first First segment whose arc length changed.
+void UpdateArcLengths(SplinePrivate &_data, const size_t _first)
+{
+  const size_t numSegments = _data.segments.size();
+  for (size_t i = _first; i < numSegments; ++i)
+  {
+    if (i > 0)
+    {
+      _data.cumulativeArcLengths[i] =
+          (_data.segments[i-1].ArcLength() + _data.cumulativeArcLengths[i-1]);
+    }
+    else
+    {
+      _data.cumulativeArcLengths[i] = 0.0;
+    }
+  }
+  _data.arcLength = (_data.cumulativeArcLengths.back()
+                     + _data.segments.back().ArcLength());
+  BuildArcLengthTable(_data);
+}
+
+///////////////////////////////////////////////////////////
+/// \brief Update the tangents and segments after a control point was
+/// added or changed. Only the tangents that depend on the point are
+/// recomputed: the ones of its neighbours, and the ones of the end points,
+/// which depend on each other when the spline is closed. Only the segments
+/// that use a changed point or tangent are rebuilt, and the cumulative arc
+/// lengths are summed again from the first of them.
+/// \param[in,out] _data Spline data.
+/// \param[in] _index Index of the point that changed.
+/// \return False if the whole spline must be rebuilt instead.
+bool PointChanged(SplinePrivate &_data, const size_t _index)
+{
+  const size_t numPoints = _data.points.size();
+  if (numPoints < 3 || _data.segments.size() + 2 < numPoints)
+    return false;
+
+  size_t changed[5];
+  size_t numChanged = 0;
+  if (_data.autoCalc)
+  {
+    if (_data.tangentsDirty)
+      return false;
+
+    const bool isClosed = IsClosed(_data);
+    const size_t candidates[] =
+      {0, _index > 0 ? _index - 1 : 0, _index,
+       std::min(_index + 1, numPoints - 1), numPoints - 1};
+    size_t last = numPoints;
+    for (const size_t i : candidates)
+    {
+      // The candidates are sorted, skip duplicates.
+      if (i == last)
+        continue;
+      last = i;
+
+      const Vector3d before = _data.points[i].MthDerivative(1);
+      ComputeTangent(_data, i, isClosed);
+      if (i == _index ||
+          !before.Equal(_data.points[i].MthDerivative(1), 0.0))
+      {
+        changed[numChanged++] = i;
+      }
+    }
+  }
+  else
+  {
+    _data.tangentsDirty = true;
+    changed[numChanged++] = _index;
+  }
+
+  const size_t numSegments = numPoints - 1;
+  _data.segments.resize(numSegments);
+  _data.cumulativeArcLengths.resize(numSegments);
+
+  size_t first = numSegments;
+  size_t last = numSegments;
+  for (size_t c = 0; c < numChanged; ++c)
+  {
+    // Segments before and after the point
+    const size_t i = changed[c];
+    for (size_t segment = (i > 0 ? i - 1 : 0);
+         segment <= std::min(i, numSegments - 1); ++segment)
+    {
+      if (segment == last)
+        continue;
+      SetSegment(_data, segment);
+      first = std::min(first, segment);
+      last = segment;
+    }
+  }
+  UpdateArcLengths(_data, first);
+  return true;
+}
+}
+
 ///////////////////////////////////////////////////////////
 Spline::Spline()
     : dataPtr(new SplinePrivate())
 {
   // Set up matrix
   this->dataPtr->autoCalc = true;
+  this->dataPtr->tangentsDirty = false;
   this->dataPtr->tension = 0.0;
   this->dataPtr->arcLength = INF_D;
+  this->dataPtr->arcLengthTableSize = 0;
 }
 
 ///////////////////////////////////////////////////////////
@@ -48,6 +353,8 @@ void Spline::Tension(double _t)
   this->dataPtr->tension = _t;
   if (this->dataPtr->autoCalc)
     this->RecalcTangents();
+  else
+    this->dataPtr->tangentsDirty = true;
 }
 
 ///////////////////////////////////////////////////////////
@@ -56,6 +363,19 @@ double Spline::Tension() const
   return this->dataPtr->tension;
 }
 
+///////////////////////////////////////////////////////////
+void Spline::ArcLengthTableSize(const unsigned int _size)
+{
+  this->dataPtr->arcLengthTableSize = _size;
+  BuildArcLengthTable(*this->dataPtr);
+}
+
+///////////////////////////////////////////////////////////
+unsigned int Spline::ArcLengthTableSize() const
+{
+  return this->dataPtr->arcLengthTableSize;
+}
+
 ///////////////////////////////////////////////////////////
 double Spline::ArcLength() const
 {
@@ -100,6 +420,9 @@ void Spline::AddPoint(const ControlPoint &_cp, const bool _fixed)
 {
   this->dataPtr->points.push_back(_cp);
   this->dataPtr->fixings.push_back(_fixed);
+  if (PointChanged(*this->dataPtr, this->dataPtr->points.size() - 1))
+    return;
+
   if (this->dataPtr->autoCalc)
     this->RecalcTangents();
   else
@@ -148,6 +471,40 @@ Vector3d Spline::Interpolate(const unsigned int _fromIndex,
   return this->InterpolateMthDerivative(_fromIndex, 0, _t);
 }
 
+///////////////////////////////////////////////////////////
+void Spline::Interpolate(const std::size_t _count,
+                         std::vector<Vector3d> &_points) const
+{
+  _points.resize(_count);
+  const auto &cumulative = this->dataPtr->cumulativeArcLengths;
+  const bool useTable = !this->dataPtr->arcLengthTable.empty();
+
+  unsigned int index = 0;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    const double t = _count > 1 ?
+      static_cast<double>(i) / static_cast<double>(_count - 1) : 0.0;
+
+    double fraction;
+    if (this->dataPtr->segments.empty() || useTable ||
+        equal(t, 0.0) || equal(t, 1.0))
+    {
+      this->MapToSegment(t, index, fraction);
+    }
+    else
+    {
+      // Same as MapToSegment, but the parameter values increase so the
+      // search continues from the previous segment.
+      const double tArc = t * this->dataPtr->arcLength;
+      while (index + 1 < cumulative.size() && cumulative[index + 1] < tArc)
+        ++index;
+      fraction = (tArc - cumulative[index])
+                 / this->dataPtr->segments[index].ArcLength();
+    }
+    _points[i] = this->InterpolateMthDerivative(index, 0, fraction);
+  }
+}
+
 ///////////////////////////////////////////////////////////
 Vector3d Spline::InterpolateTangent(const double _t) const
 {
@@ -170,71 +527,17 @@ void Spline::RecalcTangents()
   //
   // Assume endpoint tangents are parallel with line with neighbour
 
-  size_t i, numPoints;
-  bool isClosed;
-
-  numPoints = this->dataPtr->points.size();
+  size_t numPoints = this->dataPtr->points.size();
   if (numPoints < 2)
   {
     // Can't do anything yet
     return;
   }
 
-  // Closed or open?
-  if (this->dataPtr->points[0].MthDerivative(0) ==
-      this->dataPtr->points[numPoints-1].MthDerivative(0))
-    isClosed = true;
-  else
-    isClosed = false;
-
-  double t = 1.0 - this->dataPtr->tension;
-
-  for (i = 0; i < numPoints; ++i)
-  {
-    if (!this->dataPtr->fixings[i])
-    {
-      if (i == 0)
-      {
-        // Special case start
-        if (isClosed)
-        {
-          // Use this->dataPtr->points-2 since this->dataPtr->points-1
-          // is the last point and == [0]
-          this->dataPtr->points[i].MthDerivative(1) =
-              ((this->dataPtr->points[1].MthDerivative(0) -
-                this->dataPtr->points[numPoints-2].MthDerivative(0)) * 0.5) * t;
-        }
-        else
-        {
-          this->dataPtr->points[i].MthDerivative(1) =
-              ((this->dataPtr->points[1].MthDerivative(0) -
-                this->dataPtr->points[0].MthDerivative(0)) * 0.5) * t;
-        }
-      }
-      else if (i == numPoints-1)
-      {
-        // Special case end
-        if (isClosed)
-        {
-          // Use same tangent as already calculated for [0]
-          this->dataPtr->points[i].MthDerivative(1) =
-              this->dataPtr->points[0].MthDerivative(1);
-        }
-        else
-        {
-          this->dataPtr->points[i].MthDerivative(1) =
-              ((this->dataPtr->points[i].MthDerivative(0) -
-                this->dataPtr->points[i-1].MthDerivative(0)) * 0.5) * t;
-        }
-      }
-      else
-      {
-        this->dataPtr->points[i].MthDerivative(1) =
-            ((this->dataPtr->points[i+1].MthDerivative(0) -
-              this->dataPtr->points[i-1].MthDerivative(0)) * 0.5) * t;
-      }
-    }
-  }
+  const bool isClosed = IsClosed(*this->dataPtr);
+  for (size_t i = 0; i < numPoints; ++i)
+    ComputeTangent(*this->dataPtr, i, isClosed);
+  this->dataPtr->tangentsDirty = false;
   this->Rebuild();
 }
 
@@ -260,6 +563,26 @@ bool Spline::MapToSegment(const double _t,
     return true;
   }
 
+  const auto &table = this->dataPtr->arcLengthTable;
+  if (!table.empty() && _t > 0.0 && _t < 1.0)
+  {
+    // Cubic Hermite interpolation between the table entries.
+    const auto &slopes = this->dataPtr->arcLengthTableSlopes;
+    const std::size_t size = table.size() - 1;
+    const double s = _t * static_cast<double>(size);
+    const std::size_t k = std::min(static_cast<std::size_t>(s), size - 1);
+    const double f = s - k;
+    const double f2 = f * f;
+    const double f3 = f2 * f;
+    const double position =
+      (2 * f3 - 3 * f2 + 1) * table[k] + (f3 - 2 * f2 + f) * slopes[k] +
+      (3 * f2 - 2 * f3) * table[k + 1] + (f3 - f2) * slopes[k + 1];
+    _index = std::min(static_cast<unsigned int>(std::max(position, 0.0)),
+        static_cast<unsigned int>(this->dataPtr->segments.size() - 1));
+    _fraction = std::max(std::min(position - _index, 1.0), 0.0);
+    return true;
+  }
+
   // Assume linear relationship between t and arclength
   double tArc = _t * this->dataPtr->arcLength;
 
@@ -292,22 +615,8 @@ void Spline::Rebuild()
   this->dataPtr->segments.resize(numSegments);
   this->dataPtr->cumulativeArcLengths.resize(numSegments);
   for (size_t i = 0 ; i < numSegments ; ++i)
-  {
-    this->dataPtr->segments[i].SetPoints(this->dataPtr->points[i],
-                                         this->dataPtr->points[i+1]);
-
-    if (i > 0) {
-      this->dataPtr->cumulativeArcLengths[i] =
-          (this->dataPtr->segments[i-1].ArcLength()
-           + this->dataPtr->cumulativeArcLengths[i-1]);
-    }
-    else
-    {
-      this->dataPtr->cumulativeArcLengths[i] = 0.0;
-    }
-  }
-  this->dataPtr->arcLength = (this->dataPtr->cumulativeArcLengths.back()
-                              + this->dataPtr->segments.back().ArcLength());
+    SetSegment(*this->dataPtr, i);
+  UpdateArcLengths(*this->dataPtr, 0);
 }
 
 ///////////////////////////////////////////////////////////
@@ -343,6 +652,10 @@ void Spline::Clear()
   this->dataPtr->points.clear();
   this->dataPtr->segments.clear();
   this->dataPtr->fixings.clear();
+  this->dataPtr->cumulativeArcLengths.clear();
+  this->dataPtr->tangentsDirty = false;
+  this->dataPtr->arcLengthTable.clear();
+  this->dataPtr->arcLengthTableSlopes.clear();
 }
 
 ///////////////////////////////////////////////////////////
@@ -371,6 +684,9 @@ bool Spline::UpdatePoint(const unsigned int _index,
   this->dataPtr->points[_index].Match(_point);
   this->dataPtr->fixings[_index] = _fixed;
 
+  if (PointChanged(*this->dataPtr, _index))
+    return true;
+
   if (this->dataPtr->autoCalc)
     this->RecalcTangents();
   else
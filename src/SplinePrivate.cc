@@ -126,6 +126,33 @@ double IntervalCubicSpline::ArcLength(const double _t) const
   return arc_length;
 }
 
+///////////////////////////////////////////////////////////
+double IntervalCubicSpline::ArcLength(const double _t0,
+                                      const double _t1) const
+{
+  // Bound check
+  if (_t0 < 0.0 || _t1 > 1.0 || _t0 > _t1)
+    return INF_D;
+
+  // Same quadrature as ArcLength(_t), over [_t0, _t1]
+  const double dt = _t1 - _t0;
+  double w1 = 0.28444444444444444 * dt;
+  double w23 = 0.23931433524968326 * dt;
+  double w45 = 0.11846344252809456 * dt;
+  double x1 = _t0 + 0.5 * dt;
+  double x2 = _t0 + 0.23076534494715845 * dt;
+  double x3 = _t0 + 0.7692346550528415 * dt;
+  double x4 = _t0 + 0.0469100770306680 * dt;
+  double x5 = _t0 + 0.9530899229693319 * dt;
+
+  double arc_length = w1 * this->InterpolateMthDerivative(1, x1).Length();
+  arc_length += w23 * this->InterpolateMthDerivative(1, x2).Length();
+  arc_length += w23 * this->InterpolateMthDerivative(1, x3).Length();
+  arc_length += w45 * this->InterpolateMthDerivative(1, x4).Length();
+  arc_length += w45 * this->InterpolateMthDerivative(1, x5).Length();
+  return arc_length;
+}
+
 ///////////////////////////////////////////////////////////
 Vector3d IntervalCubicSpline::DoInterpolateMthDerivative(
     const unsigned int _mth, const double _t) const
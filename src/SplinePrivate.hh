@@ -156,6 +156,12 @@ namespace ignition
       /// \return the arc length up to \p _t or INF on error.
       public: double ArcLength(const double _t) const;
 
+      /// \brief Gets curve arc length between two parameter values.
+      /// \param[in] _t0 start parameter value (range 0 to 1).
+      /// \param[in] _t1 end parameter value (range _t0 to 1).
+      /// \return the arc length from \p _t0 to \p _t1 or INF on error.
+      public: double ArcLength(const double _t0, const double _t1) const;
+
       /// \internal
       /// \brief Interpolates the curve mth derivative at parameter
       /// value \p _t.
@@ -186,6 +192,10 @@ namespace ignition
       /// point change.
       public: bool autoCalc;
 
+      /// \brief true if the control points or the tension changed since the
+      /// tangents were last recalculated, while autoCalc was disabled.
+      public: bool tangentsDirty;
+
       /// \brief tension of 0 = Catmull-Rom spline, otherwise a Cardinal spline.
       public: double tension;
 
@@ -203,6 +213,20 @@ namespace ignition
 
       // \brief spline arc length.
       public: double arcLength;
+
+      /// \brief number of intervals of the arc length table, 0 to disable
+      /// it.
+      public: unsigned int arcLengthTableSize;
+
+      /// \brief arc length table. Entry k is the position along the
+      /// segments, as segment index plus fraction, at which the arc length
+      /// is k / arcLengthTableSize of the spline arc length. Empty when
+      /// disabled.
+      public: std::vector<double> arcLengthTable;
+
+      /// \brief derivatives of the arc length table entries with respect
+      /// to k, for cubic Hermite interpolation between the entries.
+      public: std::vector<double> arcLengthTableSlopes;
     };
     }
   }
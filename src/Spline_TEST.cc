@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include "gz/math/Vector3.hh"
 #include "gz/math/Spline.hh"
 
@@ -177,3 +180,206 @@ TEST(SplineTest, RecalcTangents)
   EXPECT_EQ(s.Interpolate(0, 0.5), math::Vector3d(0.2, 0.2, 0.2));
   EXPECT_EQ(s.Interpolate(1, 0.5), math::Vector3d(0.2, 0.2, 0.2));
 }
+
+/////////////////////////////////////////////////
+TEST(SplineTest, ArcLengthTable)
+{
+  math::Spline s;
+  EXPECT_EQ(0u, s.ArcLengthTableSize());
+
+  // Uneven segments, so that the parameter is far from linear with the arc
+  // length.
+  s.AddPoint(math::Vector3d(0, 0, 0));
+  s.AddPoint(math::Vector3d(1, 0, 0));
+  s.AddPoint(math::Vector3d(1, 5, 0));
+  s.AddPoint(math::Vector3d(-2, 6, 1));
+  s.AddPoint(math::Vector3d(-2, 6.5, 1));
+
+  const math::Vector3d start = s.Interpolate(0.0);
+  const math::Vector3d end = s.Interpolate(1.0);
+
+  s.ArcLengthTableSize(256);
+  EXPECT_EQ(256u, s.ArcLengthTableSize());
+  EXPECT_EQ(start, s.Interpolate(0.0));
+  EXPECT_EQ(end, s.Interpolate(1.0));
+
+  // The parameter is proportional to the arc length, up to the accuracy of
+  // the arc length of the segments.
+  const double length = s.ArcLength();
+  for (int i = 0; i <= 100; ++i)
+  {
+    const double t = i / 100.0;
+    EXPECT_NEAR(t * length, s.ArcLength(t), 3e-3 * length) << t;
+  }
+
+  // So evenly spaced parameters give points evenly spaced along the curve.
+  // Measure the arc length between them with many short chords.
+  const int count = 50;
+  const int chords = 200;
+  std::vector<double> steps;
+  double total = 0;
+  for (int i = 1; i < count; ++i)
+  {
+    double step = 0;
+    for (int j = 0; j < chords; ++j)
+    {
+      const double t = (i - 1 + j / static_cast<double>(chords)) /
+        (count - 1.0);
+      const double next = (i - 1 + (j + 1) / static_cast<double>(chords)) /
+        (count - 1.0);
+      step += s.Interpolate(next).Distance(s.Interpolate(t));
+    }
+    steps.push_back(step);
+    total += step;
+  }
+  for (const double step : steps)
+    EXPECT_NEAR(total / (count - 1), step, 1e-4 * total / count);
+
+  // The table follows changes of the points.
+  s.UpdatePoint(2, math::Vector3d(1, 8, 0));
+  EXPECT_NEAR(0.5 * s.ArcLength(), s.ArcLength(0.5), 3e-3 * s.ArcLength());
+
+  // Disabled again
+  s.ArcLengthTableSize(0);
+  EXPECT_EQ(0u, s.ArcLengthTableSize());
+  s.UpdatePoint(2, math::Vector3d(1, 5, 0));
+  EXPECT_EQ(start, s.Interpolate(0.0));
+  EXPECT_FALSE(s.Interpolate(-0.1).IsFinite());
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, InterpolateBatch)
+{
+  math::Spline s;
+  std::vector<math::Vector3d> points;
+  s.Interpolate(3, points);
+  ASSERT_EQ(3u, points.size());
+  EXPECT_FALSE(points[0].IsFinite());
+
+  s.AddPoint(math::Vector3d(0, 0, 0));
+  s.Interpolate(2, points);
+  ASSERT_EQ(2u, points.size());
+  EXPECT_EQ(math::Vector3d::Zero, points[1]);
+
+  for (int i = 1; i < 50; ++i)
+    s.AddPoint(math::Vector3d(i, (i % 7) * 0.3 * i, std::sin(i)));
+
+  for (const unsigned int size : {0u, 64u})
+  {
+    s.ArcLengthTableSize(size);
+    for (const std::size_t count : {0u, 1u, 2u, 7u, 1001u})
+    {
+      s.Interpolate(count, points);
+      ASSERT_EQ(count, points.size());
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const double t = count > 1 ? i / (count - 1.0) : 0.0;
+        EXPECT_EQ(s.Interpolate(t), points[i]) << size << " " << i;
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Check that a spline built point by point is the same as one whose
+/// tangents are computed once after all the points are added.
+/// \param[in] _s Spline built point by point.
+void ExpectSameAsRecalc(const math::Spline &_s)
+{
+  math::Spline ref;
+  ref.AutoCalculate(false);
+  ref.Tension(_s.Tension());
+  ref.ArcLengthTableSize(_s.ArcLengthTableSize());
+  for (unsigned int i = 0; i < _s.PointCount(); ++i)
+    ref.AddPoint(_s.Point(i));
+  ref.RecalcTangents();
+
+  ASSERT_EQ(ref.PointCount(), _s.PointCount());
+  for (unsigned int i = 0; i < _s.PointCount(); ++i)
+    EXPECT_EQ(ref.Tangent(i), _s.Tangent(i)) << i;
+  EXPECT_EQ(ref.ArcLength(), _s.ArcLength());
+  for (int i = 0; i <= 100; ++i)
+    EXPECT_EQ(ref.Interpolate(i / 100.0), _s.Interpolate(i / 100.0)) << i;
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, IncrementalTangents)
+{
+  for (const unsigned int size : {0u, 32u})
+  {
+    math::Spline s;
+    s.ArcLengthTableSize(size);
+    for (int i = 0; i < 20; ++i)
+    {
+      s.AddPoint(math::Vector3d(i, (i % 5) * 0.7, std::cos(i)));
+      if (i > 0)
+        ExpectSameAsRecalc(s);
+    }
+
+    // Update the ends and points in the middle
+    for (const unsigned int index : {0u, 1u, 10u, 18u, 19u})
+    {
+      EXPECT_TRUE(s.UpdatePoint(index, math::Vector3d(index, -1, 2)));
+      ExpectSameAsRecalc(s);
+    }
+
+    // Close the loop, then update its ends and their neighbours
+    s.AddPoint(s.Point(0));
+    ExpectSameAsRecalc(s);
+    for (const unsigned int index : {1u, 19u, 0u})
+    {
+      EXPECT_TRUE(s.UpdatePoint(index, math::Vector3d(index, 3, -2)));
+      EXPECT_TRUE(s.UpdatePoint(20, s.Point(0)));
+      ExpectSameAsRecalc(s);
+    }
+
+    // Changes made while tangents are not calculated automatically
+    s.AutoCalculate(false);
+    s.Tension(0.3);
+    s.UpdatePoint(5, math::Vector3d(5, 5, 5));
+    s.AddPoint(math::Vector3d(21, 0, 0));
+    s.AutoCalculate(true);
+    s.UpdatePoint(21, math::Vector3d(21, 1, 0));
+    ExpectSameAsRecalc(s);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(SplineTest, IncrementalFixedTangents)
+{
+  math::Spline s;
+  for (int i = 0; i < 10; ++i)
+    s.AddPoint(math::Vector3d(i, i * i * 0.1, 0));
+
+  // A fixed tangent is kept, the others are updated around it
+  const math::Vector3d tangent(0, 4, 0);
+  EXPECT_TRUE(s.UpdatePoint(4, math::Vector3d(4, 0, 1), tangent));
+  EXPECT_EQ(tangent, s.Tangent(4));
+  s.AddPoint(math::Vector3d(10, 0, 0), tangent);
+  EXPECT_EQ(tangent, s.Tangent(10));
+  s.UpdatePoint(3, math::Vector3d(3, 1, 1));
+  EXPECT_EQ(tangent, s.Tangent(4));
+
+  math::Spline ref;
+  ref.AutoCalculate(false);
+  for (unsigned int i = 0; i < s.PointCount(); ++i)
+  {
+    if (i == 4 || i == 10)
+      ref.AddPoint(s.Point(i), tangent);
+    else
+      ref.AddPoint(s.Point(i));
+  }
+  ref.RecalcTangents();
+  for (unsigned int i = 0; i < s.PointCount(); ++i)
+    EXPECT_EQ(ref.Tangent(i), s.Tangent(i)) << i;
+  EXPECT_EQ(ref.ArcLength(), s.ArcLength());
+  for (int i = 0; i <= 100; ++i)
+    EXPECT_EQ(ref.Interpolate(i / 100.0), s.Interpolate(i / 100.0)) << i;
+
+  // Unfixing the tangent recalculates it
+  s.UpdatePoint(4, s.Point(4));
+  ref.UpdatePoint(4, s.Point(4));
+  ref.RecalcTangents();
+  EXPECT_EQ(ref.Tangent(4), s.Tangent(4));
+  EXPECT_NE(tangent, s.Tangent(4));
+}
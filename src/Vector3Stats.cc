@@ -14,12 +14,19 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
 #include <gz/math/Vector3Stats.hh>
 #include "Vector3StatsPrivate.hh"
 
 using namespace gz;
 using namespace math;
 
+namespace
+{
+  /// \brief Number of samples gathered at a time by the batch InsertData.
+  constexpr std::size_t kBlockSize = 256;
+}
+
 //////////////////////////////////////////////////
 Vector3Stats::Vector3Stats()
   : dataPtr(new Vector3StatsPrivate)
@@ -42,6 +49,37 @@ void Vector3Stats::InsertData(const Vector3d &_data)
   this->dataPtr->mag.InsertData(_data.Length());
 }
 
+//////////////////////////////////////////////////
+void Vector3Stats::InsertData(const Vector3d *_data, const std::size_t _count)
+{
+  double x[kBlockSize];
+  double y[kBlockSize];
+  double z[kBlockSize];
+  double mag[kBlockSize];
+  for (std::size_t begin = 0; begin < _count; begin += kBlockSize)
+  {
+    const std::size_t n = std::min(kBlockSize, _count - begin);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const Vector3d &v = _data[begin + i];
+      x[i] = v.X();
+      y[i] = v.Y();
+      z[i] = v.Z();
+      mag[i] = v.Length();
+    }
+    this->dataPtr->x.InsertData(x, n);
+    this->dataPtr->y.InsertData(y, n);
+    this->dataPtr->z.InsertData(z, n);
+    this->dataPtr->mag.InsertData(mag, n);
+  }
+}
+
+//////////////////////////////////////////////////
+void Vector3Stats::InsertData(const std::vector<Vector3d> &_data)
+{
+  this->InsertData(_data.data(), _data.size());
+}
+
 //////////////////////////////////////////////////
 bool Vector3Stats::InsertStatistic(const std::string &_name)
 {
@@ -62,6 +100,16 @@ bool Vector3Stats::InsertStatistics(const std::string &_names)
   return x && y && z && mag;
 }
 
+//////////////////////////////////////////////////
+bool Vector3Stats::Merge(const Vector3Stats &_other)
+{
+  bool x = this->dataPtr->x.Merge(_other.dataPtr->x);
+  bool y = this->dataPtr->y.Merge(_other.dataPtr->y);
+  bool z = this->dataPtr->z.Merge(_other.dataPtr->z);
+  bool mag = this->dataPtr->mag.Merge(_other.dataPtr->mag);
+  return x && y && z && mag;
+}
+
 //////////////////////////////////////////////////
 void Vector3Stats::Reset()
 {
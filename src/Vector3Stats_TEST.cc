@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <string>
+#include <vector>
+
 #include <gz/math/Vector3Stats.hh>
 
 using namespace gz;
@@ -187,3 +191,69 @@ TEST_F(Vector3StatsTest, Vector3Stats)
     EXPECT_NEAR(this->Mag(name), 1.0, 1e-10);
   }
 }
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, InsertDataBatch)
+{
+  std::vector<math::Vector3d> values;
+  for (int i = 0; i < 1000; ++i)
+    values.emplace_back(0.1 * i, -0.2 * i, std::sin(0.01 * i));
+
+  EXPECT_TRUE(this->stats.InsertStatistics("max,maxAbs,mean,min,rms"));
+  for (const auto &v : values)
+    this->stats.InsertData(v);
+
+  math::Vector3Stats batch;
+  EXPECT_TRUE(batch.InsertStatistics("max,maxAbs,mean,min,rms"));
+  batch.InsertData(values.data(), 300);
+  batch.InsertData(values.data() + 300, 0);
+  batch.InsertData(values.data() + 300, values.size() - 300);
+
+  math::Vector3Stats vec;
+  EXPECT_TRUE(vec.InsertStatistics("max,maxAbs,mean,min,rms"));
+  vec.InsertData(values);
+
+  for (const math::Vector3Stats *s : {&batch, &vec})
+  {
+    EXPECT_EQ(s->X().Count(), values.size());
+    EXPECT_EQ(s->Mag().Count(), values.size());
+    for (const auto &name : {"max", "maxAbs", "mean", "min", "rms"})
+    {
+      EXPECT_DOUBLE_EQ(s->X().Map()[name], this->X(name));
+      EXPECT_DOUBLE_EQ(s->Y().Map()[name], this->Y(name));
+      EXPECT_DOUBLE_EQ(s->Z().Map()[name], this->Z(name));
+      EXPECT_DOUBLE_EQ(s->Mag().Map()[name], this->Mag(name));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+TEST_F(Vector3StatsTest, Merge)
+{
+  std::vector<math::Vector3d> values;
+  for (int i = 0; i < 100; ++i)
+    values.emplace_back(0.1 * i, -0.2 * i, std::sin(0.1 * i));
+
+  EXPECT_TRUE(this->stats.InsertStatistics("max,mean,var"));
+  this->stats.InsertData(values);
+
+  math::Vector3Stats a;
+  math::Vector3Stats b;
+  EXPECT_TRUE(a.InsertStatistics("max,mean,var"));
+  EXPECT_TRUE(b.InsertStatistics("max,mean,var"));
+  a.InsertData(values.data(), 30);
+  b.InsertData(values.data() + 30, values.size() - 30);
+  EXPECT_TRUE(a.Merge(b));
+
+  for (const auto &name : {"max", "mean", "var"})
+  {
+    EXPECT_NEAR(a.X().Map()[name], this->X(name), 1e-12);
+    EXPECT_NEAR(a.Y().Map()[name], this->Y(name), 1e-12);
+    EXPECT_NEAR(a.Z().Map()[name], this->Z(name), 1e-12);
+    EXPECT_NEAR(a.Mag().Map()[name], this->Mag(name), 1e-12);
+  }
+
+  math::Vector3Stats c;
+  EXPECT_TRUE(c.InsertStatistics("max"));
+  EXPECT_FALSE(a.Merge(c));
+}
@@ -468,3 +468,26 @@ TEST(Vector4Test, NaN)
   EXPECT_EQ(math::Vector4f::Zero, nanVecF);
   EXPECT_TRUE(nanVecF.IsFinite());
 }
+
+/////////////////////////////////////////////////
+TEST(Vector4dTest, OperatorsMatchGeneric)
+{
+  // Vector4<double> may use SIMD specializations of these operators,
+  // compare them with the generic implementation used by other types.
+  const math::Vector4d v1(0.1, -0.7, 0.3, 2.5);
+  const math::Vector4d v2(-1.2, 0.4, 0.9, -0.05);
+
+  const math::Vector4<long double> l1(v1[0], v1[1], v1[2], v1[3]);
+  const math::Vector4<long double> l2(v2[0], v2[1], v2[2], v2[3]);
+
+  const math::Vector4d sum = v1 + v2;
+  const math::Vector4d diff = v1 - v2;
+  const math::Vector4d product = v1 * v2;
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    EXPECT_NEAR(sum[i], static_cast<double>((l1 + l2)[i]), 1e-12);
+    EXPECT_NEAR(diff[i], static_cast<double>((l1 - l2)[i]), 1e-12);
+    EXPECT_NEAR(product[i], static_cast<double>((l1 * l2)[i]), 1e-12);
+  }
+  EXPECT_NEAR(v1.Dot(v2), static_cast<double>(l1.Dot(l2)), 1e-12);
+}
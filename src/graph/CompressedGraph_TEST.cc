@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "gz/math/graph/CompressedGraph.hh"
+#include "gz/math/graph/Graph.hh"
+#include "gz/math/graph/GraphAlgorithms.hh"
+
+using namespace gz;
+using namespace math;
+using namespace graph;
+
+// Define a test fixture class template.
+template <class T>
+class CompressedGraphTestFixture : public testing::Test
+{
+};
+
+// The list of graphs we want to test.
+using GraphTypes = ::testing::Types<DirectedGraph<int, double>,
+                                    UndirectedGraph<int, double>>;
+TYPED_TEST_CASE(CompressedGraphTestFixture, GraphTypes);
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, Empty)
+{
+  CompressedGraph empty;
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_EQ(0u, empty.VertexCount());
+  EXPECT_EQ(0u, empty.ArcCount());
+  EXPECT_EQ(1u, empty.Offsets().size());
+  EXPECT_EQ(kNullIndex, empty.Index(0));
+  EXPECT_EQ(kNullId, empty.Id(0));
+
+  CompressedGraph fromEmpty{DirectedGraph<int, double>()};
+  EXPECT_TRUE(fromEmpty.Empty());
+  EXPECT_EQ(1u, fromEmpty.Offsets().size());
+
+  EXPECT_TRUE(BreadthFirstSort(empty, 0).empty());
+  EXPECT_TRUE(DepthFirstSort(empty, 0).empty());
+  EXPECT_TRUE(Dijkstra(empty, 0).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, Directed)
+{
+  DirectedGraph<int, double> graph(
+  {
+    {{"A", 0, 10}, {"B", 1, 20}, {"C", 2, 30}},
+    {{{10, 20}, 0, 2.0}, {{10, 30}, 0, 3.0}, {{30, 10}, 0, 4.0}}
+  });
+
+  CompressedGraph csr(graph);
+  EXPECT_FALSE(csr.Empty());
+  ASSERT_EQ(3u, csr.VertexCount());
+  ASSERT_EQ(3u, csr.ArcCount());
+
+  EXPECT_EQ((std::vector<VertexId>{10, 20, 30}), csr.Ids());
+  EXPECT_EQ(0u, csr.Index(10));
+  EXPECT_EQ(1u, csr.Index(20));
+  EXPECT_EQ(2u, csr.Index(30));
+  EXPECT_EQ(kNullIndex, csr.Index(15));
+  EXPECT_EQ(30u, csr.Id(2));
+  EXPECT_EQ(kNullId, csr.Id(3));
+
+  EXPECT_EQ((std::vector<std::size_t>{0, 2, 2, 3}), csr.Offsets());
+  EXPECT_EQ((std::vector<std::size_t>{1, 2, 0}), csr.Targets());
+  EXPECT_EQ((std::vector<double>{2.0, 3.0, 4.0}), csr.Weights());
+  EXPECT_EQ((std::vector<EdgeId>{0, 1, 2}), csr.EdgeIds());
+  EXPECT_EQ(2u, csr.OutDegree(0));
+  EXPECT_EQ(0u, csr.OutDegree(1));
+  EXPECT_EQ(1u, csr.OutDegree(2));
+
+  // The snapshot does not follow changes to the graph.
+  graph.RemoveVertex(20);
+  EXPECT_EQ(3u, csr.VertexCount());
+}
+
+/////////////////////////////////////////////////
+TEST(CompressedGraphTest, Undirected)
+{
+  UndirectedGraph<int, double> graph(
+  {
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}},
+    {{{0, 1}, 0, 2.0}, {{1, 2}, 0, 3.0}, {{2, 2}, 0, 4.0}}
+  });
+
+  CompressedGraph csr(graph);
+  ASSERT_EQ(3u, csr.VertexCount());
+
+  // One arc per direction, and a single arc for the self loop.
+  ASSERT_EQ(5u, csr.ArcCount());
+  EXPECT_EQ((std::vector<std::size_t>{0, 1, 3, 5}), csr.Offsets());
+  EXPECT_EQ((std::vector<std::size_t>{1, 0, 2, 1, 2}), csr.Targets());
+  EXPECT_EQ((std::vector<double>{2.0, 2.0, 3.0, 3.0, 4.0}), csr.Weights());
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(CompressedGraphTestFixture, MatchesGraphAlgorithms)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}, {"H", 7, 7}},
+    // Edges.
+    {{{0, 1}, 0, 2.0}, {{0, 2}, 0, 3.0}, {{0, 4}, 0, 4.0},
+     {{1, 3}, 0, 2.0}, {{1, 5}, 0, 3.0}, {{2, 6}, 0, 4.0},
+     {{5, 4}, 0, 2.0}, {{4, 1}, 0, 0.5}, {{0, 1}, 0, 1.0}}
+  });
+
+  CompressedGraph csr(graph);
+
+  for (VertexId from = 0; from < 8; ++from)
+  {
+    EXPECT_EQ(BreadthFirstSort(graph, from), BreadthFirstSort(csr, from));
+    EXPECT_EQ(DepthFirstSort(graph, from), DepthFirstSort(csr, from));
+
+    auto expected = Dijkstra(graph, from);
+    auto res = Dijkstra(csr, from);
+    ASSERT_EQ(expected.size(), res.size());
+    for (auto const &cost : expected)
+    {
+      ASSERT_NE(res.end(), res.find(cost.first));
+      EXPECT_DOUBLE_EQ(cost.second.first, res.at(cost.first).first);
+    }
+  }
+
+  // Inexistent vertices.
+  EXPECT_TRUE(BreadthFirstSort(csr, 99).empty());
+  EXPECT_TRUE(DepthFirstSort(csr, 99).empty());
+  EXPECT_TRUE(Dijkstra(csr, 99).empty());
+  EXPECT_TRUE(Dijkstra(csr, 0, 99).empty());
+
+  // Early termination.
+  auto res = Dijkstra(csr, 0, 3);
+  ASSERT_NE(res.end(), res.find(3));
+  EXPECT_DOUBLE_EQ(3.0, res.at(3).first);
+  EXPECT_EQ(1u, res.at(3).second);
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(CompressedGraphTestFixture, DijkstraBuffer)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}, {"H", 7, 7}},
+    // Edges.
+    {{{0, 1}, 0, 2.0}, {{0, 2}, 0, 3.0}, {{0, 4}, 0, 4.0},
+     {{1, 3}, 0, 2.0}, {{1, 5}, 0, 3.0}, {{2, 6}, 0, 4.0},
+     {{5, 4}, 0, 2.0}, {{4, 1}, 0, 0.5}, {{0, 1}, 0, 1.0}}
+  });
+
+  CompressedGraph csr(graph);
+
+  DijkstraBuffer empty;
+  EXPECT_EQ(0u, empty.VertexCount());
+  EXPECT_FALSE(empty.Reached(0));
+  EXPECT_DOUBLE_EQ(MAX_D, empty.Cost(0));
+  EXPECT_EQ(kNullIndex, empty.Previous(0));
+
+  // The same buffer is reused for all the queries.
+  DijkstraBuffer buffer;
+  std::vector<std::size_t> path;
+  for (VertexId from = 0; from < 8; ++from)
+  {
+    ASSERT_TRUE(Dijkstra(csr, from, buffer));
+    EXPECT_EQ(8u, buffer.VertexCount());
+
+    auto expected = Dijkstra(graph, from);
+    for (auto const &cost : expected)
+    {
+      const std::size_t index = csr.Index(cost.first);
+      EXPECT_DOUBLE_EQ(cost.second.first, buffer.Cost(index));
+      EXPECT_EQ(cost.second.first < MAX_D, buffer.Reached(index));
+
+      buffer.Path(index, path);
+      if (!buffer.Reached(index))
+      {
+        EXPECT_TRUE(path.empty());
+        EXPECT_EQ(kNullIndex, buffer.Previous(index));
+        continue;
+      }
+
+      // Follow the path and add up the costs.
+      ASSERT_FALSE(path.empty());
+      EXPECT_EQ(csr.Index(from), path.front());
+      EXPECT_EQ(index, path.back());
+      for (std::size_t i = 1; i < path.size(); ++i)
+      {
+        EXPECT_EQ(path[i - 1], buffer.Previous(path[i]));
+        EXPECT_LE(buffer.Cost(path[i - 1]), buffer.Cost(path[i]));
+      }
+    }
+  }
+
+  // Early termination.
+  ASSERT_TRUE(Dijkstra(csr, 0, buffer, 3));
+  EXPECT_DOUBLE_EQ(3.0, buffer.Cost(csr.Index(3)));
+  EXPECT_EQ(csr.Index(1), buffer.Previous(csr.Index(3)));
+
+  // Inexistent vertices leave the buffer empty.
+  EXPECT_FALSE(Dijkstra(csr, 99, buffer));
+  EXPECT_EQ(0u, buffer.VertexCount());
+  EXPECT_FALSE(buffer.Reached(0));
+  EXPECT_FALSE(Dijkstra(csr, 0, buffer, 99));
+  EXPECT_FALSE(buffer.Reached(0));
+
+  // A smaller graph after a larger one.
+  CompressedGraph small(TypeParam({{{"A", 0, 0}, {"B", 1, 1}}, {}}));
+  ASSERT_TRUE(Dijkstra(small, 1, buffer));
+  EXPECT_EQ(2u, buffer.VertexCount());
+  EXPECT_FALSE(buffer.Reached(0));
+  EXPECT_TRUE(buffer.Reached(1));
+  EXPECT_FALSE(buffer.Reached(2));
+  EXPECT_DOUBLE_EQ(0.0, buffer.Cost(1));
+  EXPECT_EQ(1u, buffer.Previous(1));
+}
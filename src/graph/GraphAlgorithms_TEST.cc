@@ -16,8 +16,13 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
 #include <string>
+#include <vector>
 
+#include "gz/math/graph/CompressedGraph.hh"
 #include "gz/math/graph/Graph.hh"
 #include "gz/math/graph/GraphAlgorithms.hh"
 
@@ -53,6 +58,26 @@ TYPED_TEST(GraphTestFixture, BreadthFirstSort)
   auto res = BreadthFirstSort(graph, 0);
   std::vector<VertexId> expected = {0, 1, 2, 4, 3, 5, 6};
   EXPECT_EQ(expected, res);
+
+  // Inexistent source vertex.
+  EXPECT_TRUE(BreadthFirstSort(graph, 99).empty());
+  EXPECT_TRUE(DepthFirstSort(graph, 99).empty());
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, SortLargeIds)
+{
+  // Ids on both sides of the range tracked with a dense bitmap.
+  const VertexId big = VertexId(1) << 40;
+  TypeParam graph(
+  {
+    {{"A", 0, 3}, {"B", 1, big}, {"C", 2, big + 7}, {"D", 3, 5000000}},
+    {{{3, big}, 1.0}, {{big, big + 7}, 1.0}, {{3, 5000000}, 1.0}}
+  });
+
+  std::vector<VertexId> expected = {3, 5000000, big, big + 7};
+  EXPECT_EQ(expected, BreadthFirstSort(graph, 3));
+  EXPECT_EQ(4u, DepthFirstSort(graph, 3).size());
 }
 
 /////////////////////////////////////////////////
@@ -211,6 +236,141 @@ TEST(GraphTestFixture, DijkstraDirected)
   EXPECT_EQ(0u, res.at(1).second);
 }
 
+/////////////////////////////////////////////////
+/// \brief Sum the weights of the cheapest edges along a path.
+template<typename GraphType>
+double PathCost(const GraphType &_graph, const std::vector<VertexId> &_path)
+{
+  double cost = 0;
+  for (std::size_t i = 1; i < _path.size(); ++i)
+  {
+    double weight = MAX_D;
+    _graph.ForEachIncidentFrom(_path[i - 1],
+        [&](const auto &_edge)
+    {
+      if (_edge.From(_path[i - 1]) == _path[i])
+        weight = std::min(weight, _edge.Weight());
+    });
+    cost += weight;
+  }
+  return cost;
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, ShortestPath)
+{
+  TypeParam graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4},
+     {"F", 5, 5}, {"G", 6, 6}, {"H", 7, 7}},
+    // Edges.
+    {{{0, 1}, 0, 2.0}, {{0, 2}, 0, 3.0}, {{0, 4}, 0, 4.0},
+     {{1, 3}, 0, 2.0}, {{1, 5}, 0, 3.0}, {{2, 6}, 0, 4.0},
+     {{5, 4}, 0, 2.0}, {{4, 1}, 0, 0.5}, {{0, 1}, 0, 1.0}}
+  });
+
+  auto zero = [](const Vertex<int> &, const Vertex<int> &)
+  {
+    return 0.0;
+  };
+
+  for (VertexId from = 0; from < 8; ++from)
+  {
+    auto expected = Dijkstra(graph, from);
+    for (VertexId to = 0; to < 8; ++to)
+    {
+      double astarCost;
+      double bidirCost;
+      auto astar = AStar(graph, from, to, zero, &astarCost);
+      auto bidir = BidirectionalDijkstra(graph, from, to, &bidirCost);
+
+      if (expected.at(to).first >= MAX_D)
+      {
+        EXPECT_TRUE(astar.empty());
+        EXPECT_TRUE(bidir.empty());
+        EXPECT_DOUBLE_EQ(MAX_D, astarCost);
+        EXPECT_DOUBLE_EQ(MAX_D, bidirCost);
+        continue;
+      }
+
+      ASSERT_FALSE(astar.empty());
+      ASSERT_FALSE(bidir.empty());
+      EXPECT_EQ(from, astar.front());
+      EXPECT_EQ(to, astar.back());
+      EXPECT_EQ(from, bidir.front());
+      EXPECT_EQ(to, bidir.back());
+      EXPECT_DOUBLE_EQ(expected.at(to).first, astarCost);
+      EXPECT_DOUBLE_EQ(expected.at(to).first, bidirCost);
+      EXPECT_DOUBLE_EQ(astarCost, PathCost(graph, astar));
+      EXPECT_DOUBLE_EQ(bidirCost, PathCost(graph, bidir));
+    }
+  }
+
+  // Same source and destination.
+  EXPECT_EQ(std::vector<VertexId>{3}, AStar(graph, 3, 3, zero));
+  EXPECT_EQ(std::vector<VertexId>{3}, BidirectionalDijkstra(graph, 3, 3));
+
+  // Inexistent vertices.
+  EXPECT_TRUE(AStar(graph, 99, 0, zero).empty());
+  EXPECT_TRUE(AStar(graph, 0, 99, zero).empty());
+  EXPECT_TRUE(BidirectionalDijkstra(graph, 99, 0).empty());
+  EXPECT_TRUE(BidirectionalDijkstra(graph, 0, 99).empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTestFixture, AStarGrid)
+{
+  // A 5x5 grid with unit weights. The vertex data stores the column and the
+  // row of each vertex as col * 10 + row.
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (int r = 0; r < 5; ++r)
+  {
+    for (int c = 0; c < 5; ++c)
+    {
+      const VertexId id = r * 5 + c;
+      vertices.emplace_back("", c * 10 + r, id);
+      if (c < 4)
+        edges.emplace_back(VertexId_P(id, id + 1), 0.0, 1.0);
+      if (r < 4)
+        edges.emplace_back(VertexId_P(id, id + 5), 0.0, 1.0);
+    }
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+
+  // Manhattan distance.
+  unsigned int calls = 0;
+  auto manhattan = [&calls](const Vertex<int> &_v, const Vertex<int> &_goal)
+  {
+    ++calls;
+    return std::abs(_v.Data() / 10 - _goal.Data() / 10) +
+           std::abs(_v.Data() % 10 - _goal.Data() % 10) + 0.0;
+  };
+
+  double cost;
+  auto path = AStar(graph, 0, 24, manhattan, &cost);
+  EXPECT_DOUBLE_EQ(8.0, cost);
+  ASSERT_EQ(9u, path.size());
+  EXPECT_EQ(0u, path.front());
+  EXPECT_EQ(24u, path.back());
+  EXPECT_DOUBLE_EQ(8.0, PathCost(graph, path));
+  EXPECT_GT(calls, 0u);
+
+  // Remove the middle column except for the last row and check that the
+  // path goes around it.
+  graph.RemoveVertex(2);
+  graph.RemoveVertex(7);
+  graph.RemoveVertex(12);
+  graph.RemoveVertex(17);
+  path = AStar(graph, 10, 14, manhattan, &cost);
+  EXPECT_DOUBLE_EQ(8.0, cost);
+  EXPECT_DOUBLE_EQ(8.0, PathCost(graph, path));
+  path = BidirectionalDijkstra(graph, 10, 14, &cost);
+  EXPECT_DOUBLE_EQ(8.0, cost);
+  EXPECT_DOUBLE_EQ(8.0, PathCost(graph, path));
+}
+
 /////////////////////////////////////////////////
 TEST(GraphTestFixture, ConnectedComponents)
 {
@@ -310,6 +470,146 @@ TEST(GraphTestFixture, ConnectedComponents)
   }
 }
 
+/////////////////////////////////////////////////
+TEST(GraphTestFixture, ConnectedComponentLabels)
+{
+  // Labels of an empty graph.
+  UndirectedGraph<int, double> emptyGraph;
+  std::size_t count = 1;
+  EXPECT_TRUE(ConnectedComponentLabels(emptyGraph, 1, &count).empty());
+  EXPECT_EQ(0u, count);
+
+  UndirectedGraph<int, double> graph(
+  {
+    // Vertices.
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}, {"E", 4, 4}},
+    // Edges.
+    {{{0, 2}, 2.0, 6.0},
+     {{1, 4}, 4.0, 5.0}}
+  });
+
+  for (unsigned int threads : {1u, 4u})
+  {
+    auto labels = ConnectedComponentLabels(graph, threads, &count);
+    ASSERT_EQ(5u, labels.size());
+    EXPECT_EQ(3u, count);
+    EXPECT_EQ(0u, labels.at(0));
+    EXPECT_EQ(1u, labels.at(1));
+    EXPECT_EQ(0u, labels.at(2));
+    EXPECT_EQ(2u, labels.at(3));
+    EXPECT_EQ(1u, labels.at(4));
+  }
+
+  // Build a single component.
+  auto labels = ConnectedComponentLabels(graph);
+  auto component = ConnectedComponent(graph, labels, 1);
+  auto vertices = component.Vertices();
+  ASSERT_EQ(2u, vertices.size());
+  EXPECT_EQ("B", vertices.at(1).get().Name());
+  EXPECT_EQ("E", vertices.at(4).get().Name());
+  auto edges = component.Edges();
+  ASSERT_EQ(1u, edges.size());
+  EXPECT_DOUBLE_EQ(4.0, edges.begin()->second.get().Data());
+  EXPECT_DOUBLE_EQ(5.0, edges.begin()->second.get().Weight());
+
+  EXPECT_TRUE(ConnectedComponent(graph, labels, 3).Empty());
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTestFixture, ConnectedComponentLabelsParallel)
+{
+  // Many small chains, large enough to use several threads. Vertex i is
+  // connected to i + 7 when both are in the same block of 50 vertices.
+  const VertexId kVertexCount = 20000;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (VertexId i = 0; i < kVertexCount; ++i)
+  {
+    vertices.emplace_back("", 0, i);
+    if ((i % 50) + 7 < 50)
+      edges.emplace_back(VertexId_P(i, i + 7));
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+  CompressedGraph csr(graph);
+
+  std::size_t serialCount;
+  std::size_t parallelCount;
+  auto serial = ConnectedComponentLabels(csr, 1, &serialCount);
+  auto parallel = ConnectedComponentLabels(csr, 4, &parallelCount);
+  EXPECT_EQ(kVertexCount / 50 * 7, serialCount);
+  EXPECT_EQ(serialCount, parallelCount);
+  EXPECT_EQ(serial, parallel);
+
+  for (VertexId i = 0; i < kVertexCount; ++i)
+    EXPECT_EQ(serial[i], (i / 50) * 7 + (i % 50) % 7);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTestFixture, ConnectedComponentLabelsParallelAcrossChunks)
+{
+  // Pairs {i, i + n/2}, so that every component spans two chunks.
+  const VertexId kVertexCount = 200000;
+  const VertexId kHalf = kVertexCount / 2;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (VertexId i = 0; i < kVertexCount; ++i)
+  {
+    vertices.emplace_back("", 0, i);
+    if (i < kHalf)
+      edges.emplace_back(VertexId_P(i, i + kHalf));
+  }
+  UndirectedGraph<int, double> graph(vertices, edges);
+  CompressedGraph csr(graph);
+
+  std::size_t count;
+  auto labels = ConnectedComponentLabels(csr, 4, &count);
+  EXPECT_EQ(kHalf, count);
+  EXPECT_EQ(labels, ConnectedComponentLabels(csr, 1));
+  for (VertexId i = 0; i < kVertexCount; ++i)
+    EXPECT_EQ(i % kHalf, labels[i]);
+}
+
+/////////////////////////////////////////////////
+TEST(GraphTestFixture, BreadthFirstLevels)
+{
+  // A 100x100 grid.
+  const VertexId kSide = 100;
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  for (VertexId r = 0; r < kSide; ++r)
+  {
+    for (VertexId c = 0; c < kSide; ++c)
+    {
+      const VertexId id = r * kSide + c;
+      vertices.emplace_back("", 0, id);
+      if (c + 1 < kSide)
+        edges.emplace_back(VertexId_P(id, id + 1));
+      if (r + 1 < kSide)
+        edges.emplace_back(VertexId_P(id, id + kSide));
+    }
+  }
+  // An isolated vertex.
+  vertices.emplace_back("", 0, kSide * kSide);
+  CompressedGraph csr(UndirectedGraph<int, double>(vertices, edges));
+
+  EXPECT_TRUE(BreadthFirstLevels(csr, 99999).empty());
+
+  for (unsigned int threads : {1u, 4u})
+  {
+    auto levels = BreadthFirstLevels(csr, kSide / 2, threads);
+    ASSERT_EQ(kSide * kSide + 1, levels.size());
+    for (VertexId r = 0; r < kSide; ++r)
+    {
+      for (VertexId c = 0; c < kSide; ++c)
+      {
+        const std::size_t dc = c > kSide / 2 ? c - kSide / 2 : kSide / 2 - c;
+        EXPECT_EQ(r + dc, levels[r * kSide + c]);
+      }
+    }
+    EXPECT_EQ(kNullIndex, levels.back());
+  }
+}
+
 /////////////////////////////////////////////////
 TEST(GraphTestFixture, ToUndirectedGraph)
 {
@@ -16,7 +16,10 @@
 */
 
 #include <gtest/gtest.h>
+#include <cstddef>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "gz/math/graph/Graph.hh"
 
@@ -136,6 +139,20 @@ TEST(GraphTest, BadUniformInitializationMock)
     auto edges = graph.Edges();
     EXPECT_EQ(0u, edges.size());
   }
+
+  // The bulk load starts over with the Ids of a new graph.
+  {
+    MockVerticesFullUndirectedGraph<int, double> graph;
+    auto report = graph.Load({{"0", 0}, {"1", 1, 1}}, {});
+    EXPECT_TRUE(report.ignoredVertices.empty());
+    EXPECT_EQ(2u, graph.Vertices().size());
+  }
+  {
+    MockEdgesFullUndirectedGraph<int, double> graph;
+    auto report = graph.Load({{"0", 0, 0}, {"1", 1, 1}}, {{{0, 1}, 1.0}});
+    EXPECT_TRUE(report.ignoredEdges.empty());
+    EXPECT_EQ(1u, graph.Edges().size());
+  }
 }
 
 /////////////////////////////////////////////////
@@ -457,3 +474,178 @@ TYPED_TEST(GraphTestFixture, EdgelessOutDegree)
     EXPECT_EQ(0u, graph.OutDegree(idVertex.first));
   }
 }
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, ForEachNeighbor)
+{
+  // Graph with a repeated edge between 0 and 1.
+  TypeParam graph(
+  {
+    {{"A", 0, 0}, {"B", 1, 1}, {"C", 2, 2}, {"D", 3, 3}},
+    {{{0, 1}, 2.0}, {{1, 0}, 3.0}, {{0, 2}, 4.0}, {{2, 3}, 5.0},
+     {{0, 1}, 6.0}}
+  });
+
+  for (VertexId id = 0; id < 5; ++id)
+  {
+    // Incident edges are visited in edge Id order, like the maps.
+    std::vector<EdgeId> edgeIds;
+    graph.ForEachIncidentFrom(id, [&edgeIds](const auto &_edge)
+    {
+      edgeIds.push_back(_edge.Id());
+    });
+    std::vector<EdgeId> expectedEdgeIds;
+    for (auto const &edgePair : graph.IncidentsFrom(id))
+      expectedEdgeIds.push_back(edgePair.first);
+    EXPECT_EQ(expectedEdgeIds, edgeIds);
+
+    edgeIds.clear();
+    graph.ForEachIncidentTo(id, [&edgeIds](const auto &_edge)
+    {
+      edgeIds.push_back(_edge.Id());
+    });
+    expectedEdgeIds.clear();
+    for (auto const &edgePair : graph.IncidentsTo(id))
+      expectedEdgeIds.push_back(edgePair.first);
+    EXPECT_EQ(expectedEdgeIds, edgeIds);
+
+    // Adjacent vertices may be visited more than once, but the set of
+    // vertices matches.
+    std::set<VertexId> vertexIds;
+    graph.ForEachAdjacentFrom(id, [&vertexIds](const Vertex<int> &_v)
+    {
+      EXPECT_TRUE(_v.Valid());
+      vertexIds.insert(_v.Id());
+    });
+    std::set<VertexId> expectedVertexIds;
+    for (auto const &vertexPair : graph.AdjacentsFrom(id))
+      expectedVertexIds.insert(vertexPair.first);
+    EXPECT_EQ(expectedVertexIds, vertexIds);
+
+    vertexIds.clear();
+    graph.ForEachAdjacentTo(id, [&vertexIds](const Vertex<int> &_v)
+    {
+      EXPECT_TRUE(_v.Valid());
+      vertexIds.insert(_v.Id());
+    });
+    expectedVertexIds.clear();
+    for (auto const &vertexPair : graph.AdjacentsTo(id))
+      expectedVertexIds.insert(vertexPair.first);
+    EXPECT_EQ(expectedVertexIds, vertexIds);
+  }
+
+  // Vertex 0 has three edges to or from vertex 1.
+  int count = 0;
+  graph.ForEachAdjacentFrom(0, [&count](const Vertex<int> &_v)
+  {
+    if (_v.Id() == 1u)
+      ++count;
+  });
+  EXPECT_EQ(graph.IncidentsFrom(0).size() - 1u, static_cast<size_t>(count));
+}
+
+/////////////////////////////////////////////////
+TYPED_TEST(GraphTestFixture, Load)
+{
+  // Unsorted vertices, generated Ids, a repeated Id, repeated names, a self
+  // loop and edges to an inexistent vertex.
+  std::vector<Vertex<int>> vertices =
+  {
+    {"A", 0, 5}, {"B", 1}, {"C", 2, 1}, {"A", 3}, {"D", 4, 0}, {"E", 5, 3},
+    {"F", 6}
+  };
+  std::vector<EdgeInitializer<double>> edges =
+  {
+    {{5, 0}, 1.0, 2.0}, {{0, 9}, 2.0}, {{1, 1}, 3.0}, {{3, 5}, 4.0},
+    {{2, 0}, 5.0}, {{9, 9}, 6.0}, {{0, 5}, 7.0}
+  };
+
+  // Reference graph, built one element at a time.
+  TypeParam expected;
+  std::vector<std::size_t> ignoredVertices;
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    const auto &v = vertices[i];
+    if (!expected.AddVertex(v.Name(), v.Data(), v.Id()).Valid())
+      ignoredVertices.push_back(i);
+  }
+  std::vector<std::size_t> ignoredEdges;
+  for (std::size_t i = 0; i < edges.size(); ++i)
+  {
+    const auto &e = edges[i];
+    if (!expected.AddEdge(e.vertices, e.data, e.weight).Valid())
+      ignoredEdges.push_back(i);
+  }
+
+  // Load into a graph that already has content.
+  TypeParam graph({{{"Z", 9, 9}, {"Y", 8, 8}}, {{{9, 8}, 9.0}}});
+  auto report = graph.Load(vertices, edges);
+  EXPECT_FALSE(report.Valid());
+  EXPECT_EQ(ignoredVertices, report.ignoredVertices);
+  EXPECT_EQ(ignoredEdges, report.ignoredEdges);
+  EXPECT_EQ((std::vector<std::size_t>{4}), report.ignoredVertices);
+  EXPECT_EQ((std::vector<std::size_t>{1, 5}), report.ignoredEdges);
+
+  // Compare with the reference graph.
+  auto expectedVertices = expected.Vertices();
+  auto loadedVertices = graph.Vertices();
+  ASSERT_EQ(expectedVertices.size(), loadedVertices.size());
+  for (auto const &vPair : expectedVertices)
+  {
+    ASSERT_NE(loadedVertices.end(), loadedVertices.find(vPair.first));
+    const auto &v = loadedVertices.at(vPair.first).get();
+    EXPECT_EQ(vPair.second.get().Name(), v.Name());
+    EXPECT_EQ(vPair.second.get().Data(), v.Data());
+    EXPECT_EQ(vPair.first, v.Id());
+
+    EXPECT_EQ(expected.Vertices(v.Name()).size(),
+              graph.Vertices(v.Name()).size());
+
+    std::vector<EdgeId> expectedIncidents;
+    for (auto const &ePair : expected.IncidentsFrom(vPair.first))
+      expectedIncidents.push_back(ePair.first);
+    std::vector<EdgeId> incidents;
+    for (auto const &ePair : graph.IncidentsFrom(vPair.first))
+      incidents.push_back(ePair.first);
+    EXPECT_EQ(expectedIncidents, incidents);
+  }
+
+  auto expectedEdges = expected.Edges();
+  auto loadedEdges = graph.Edges();
+  ASSERT_EQ(expectedEdges.size(), loadedEdges.size());
+  for (auto const &ePair : expectedEdges)
+  {
+    ASSERT_NE(loadedEdges.end(), loadedEdges.find(ePair.first));
+    const auto &e = loadedEdges.at(ePair.first).get();
+    EXPECT_EQ(ePair.second.get().Vertices(), e.Vertices());
+    EXPECT_DOUBLE_EQ(ePair.second.get().Data(), e.Data());
+    EXPECT_DOUBLE_EQ(ePair.second.get().Weight(), e.Weight());
+  }
+
+  // New elements get the same Ids as in the reference graph.
+  EXPECT_EQ(expected.AddVertex("G", 7).Id(), graph.AddVertex("G", 7).Id());
+  EXPECT_EQ(expected.AddEdge({0, 1}, 8.0).Id(),
+            graph.AddEdge({0, 1}, 8.0).Id());
+
+  // Valid input.
+  report = graph.Load({{"A", 0, 0}, {"B", 1, 1}}, {{{0, 1}, 1.0}});
+  EXPECT_TRUE(report.Valid());
+  EXPECT_EQ(2u, graph.Vertices().size());
+  EXPECT_EQ(1u, graph.Edges().size());
+
+  // Empty input.
+  report = graph.Load({}, {});
+  EXPECT_TRUE(report.Valid());
+  EXPECT_TRUE(graph.Empty());
+
+  // Ids generated before loading do not affect the Ids generated after.
+  TypeParam used;
+  for (int i = 0; i < 5; ++i)
+    used.AddVertex("X", i);
+  used.AddEdge({0, 1}, 1.0);
+  used.AddEdge({1, 2}, 1.0);
+  used.Load({{"A", 0}, {"B", 1}}, {{{0, 1}, 1.0}});
+  TypeParam fresh({{"A", 0}, {"B", 1}}, {{{0, 1}, 1.0}});
+  EXPECT_EQ(fresh.AddVertex("C", 2).Id(), used.AddVertex("C", 2).Id());
+  EXPECT_EQ(fresh.AddEdge({1, 2}, 2.0).Id(), used.AddEdge({1, 2}, 2.0).Id());
+}
@@ -34,6 +34,10 @@ void defineMathRollingMean(py::module &m, const std::string &typestr)
                     py::dynamic_attr())
   .def(py::init<size_t>(), py::arg("_windowSize") = 10)
   .def("mean", &Class::Mean, "Get the mean value.")
+   .def("variance", &Class::Variance,
+        "Get the sample variance of the data points.")
+   .def("min", &Class::Min, "Get the minimum value.")
+   .def("max", &Class::Max, "Get the maximum value.")
    .def("count", &Class::Count, "Get the number of data points.")
    .def("push", &Class::Push, "Insert a new value.")
    .def("clear", &Class::Clear, "Remove all the pushed values.")
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "SignalStats.hh"
 #include <gz/math/SignalStats.hh>
@@ -45,14 +46,22 @@ void defineMathSignalStats(py::module &m, const std::string &typestr)
        "Get the current values of each statistical measure, "
        "stored in a map using the short name as the key.")
   .def("insert_data",
-       &Class::InsertData,
+       py::overload_cast<const double>(&Class::InsertData),
        "Add a new sample to the statistical measures.")
+  .def("insert_data",
+       py::overload_cast<const std::vector<double> &, const unsigned int>(
+         &Class::InsertData),
+       py::arg("_data"), py::arg("_threads") = 1,
+       "Add a batch of samples to the statistical measures.")
   .def("insert_statistic",
        &Class::InsertStatistic,
        "Add a new type of statistic.")
   .def("insert_statistics",
        &Class::InsertStatistics,
-       "Add multiple statistics.");
+       "Add multiple statistics.")
+  .def("merge",
+       &Class::Merge,
+       "Merge the data of another collection of statistics into this one.");
 }
 
 //////////////////////////////////////////////////
@@ -45,7 +45,8 @@ void defineMathSphericalCoordinates(py::module &m, const std::string &typestr)
     .def(py::self != py::self)
     .def(py::self == py::self)
     .def("spherical_from_local_position",
-         &Class::SphericalFromLocalPosition,
+         py::overload_cast<const gz::math::Vector3d &>(
+           &Class::SphericalFromLocalPosition, py::const_),
          "Convert a Cartesian position vector to geodetic coordinates.")
     .def("global_from_local_velocity",
          &Class::GlobalFromLocalVelocity,
@@ -96,7 +97,8 @@ void defineMathSphericalCoordinates(py::module &m, const std::string &typestr)
          &Class::SetHeadingOffset,
          "Set heading angle offset for the frame.")
     .def("local_from_spherical_position",
-         &Class::LocalFromSphericalPosition,
+         py::overload_cast<const gz::math::Vector3d &>(
+           &Class::LocalFromSphericalPosition, py::const_),
          "Convert a geodetic position vector to Cartesian coordinates.")
     .def("local_from_global_velocity",
          &Class::LocalFromGlobalVelocity,
@@ -106,7 +108,10 @@ void defineMathSphericalCoordinates(py::module &m, const std::string &typestr)
          &Class::UpdateTransformationMatrix,
          "Update coordinate transformation matrix with reference location")
     .def("position_transform",
-         &Class::PositionTransform,
+         py::overload_cast<const gz::math::Vector3d &,
+                           const Class::CoordinateType &,
+                           const Class::CoordinateType &>(
+           &Class::PositionTransform, py::const_),
          "Convert between velocity in SPHERICAL/ECEF/LOCAL/GLOBAL frame "
          "Spherical coordinates use radians, while the other frames use "
          "meters.")
@@ -39,7 +39,7 @@ void defineMathVector3Stats(py::module &m, const std::string &typestr)
                     py::dynamic_attr())
     .def(py::init<>())
     .def("insert_data",
-         &Class::InsertData,
+         py::overload_cast<const gz::math::Vector3d &>(&Class::InsertData),
          "Add a new sample to the statistical measures")
     .def("insert_statistic",
          &Class::InsertStatistic,
@@ -50,6 +50,9 @@ void defineMathVector3Stats(py::module &m, const std::string &typestr)
     .def("reset",
          &Class::Reset,
          "Forget all previous data.")
+    .def("merge",
+         &Class::Merge,
+         "Merge the data of another Vector3Stats into this one.")
     .def("x",
          py::overload_cast<>(&Class::X),
          py::return_value_policy::reference_internal,
@@ -40,6 +40,10 @@ class TestRollingMean(unittest.TestCase):
         mean.push(20.0)
         self.assertAlmostEqual(8.75, mean.mean())
 
+        self.assertAlmostEqual(2.0, mean.min())
+        self.assertAlmostEqual(20.0, mean.max())
+        self.assertAlmostEqual(206.75 / 3.0, mean.variance())
+
         mean.clear()
         self.assertTrue(math.isnan(mean.mean()))
 
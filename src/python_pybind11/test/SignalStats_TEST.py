@@ -523,6 +523,56 @@ class TestSignalStats(unittest.TestCase):
         self.assertAlmostEqual(map["rms"], 0.0)
         self.assertAlmostEqual(map["mean"], 0.0)
 
+    def test_signal_stats_insert_batch(self):
+        stats = SignalStats()
+        self.assertTrue(stats.insert_statistics("max,maxAbs,mean,min,rms,var"))
+
+        # Insert a batch of data with alternating signs
+        value = 3.14159
+        stats.insert_data([value, -value, value, -value])
+        self.assertEqual(stats.count(), 4)
+
+        map = stats.map()
+        self.assertAlmostEqual(map["max"], value)
+        self.assertAlmostEqual(map["maxAbs"], value)
+        self.assertAlmostEqual(map["min"], -value)
+        self.assertAlmostEqual(map["rms"], value)
+        self.assertAlmostEqual(map["mean"], 0.0)
+        self.assertAlmostEqual(map["var"], 4.0 * value * value / 3.0)
+
+    def test_signal_stats_quantiles(self):
+        stats = SignalStats()
+        self.assertTrue(stats.insert_statistics("p50,p99,hist[0:100:50]"))
+        self.assertFalse(stats.insert_statistic("p99.0"))
+        self.assertFalse(stats.insert_statistic("p101"))
+
+        stats.insert_data([i + 0.5 for i in range(100)])
+        map = stats.map()
+        self.assertEqual(len(map), 3)
+        self.assertAlmostEqual(map["p50"], 50.0, delta=0.5)
+        self.assertAlmostEqual(map["p99"], 99.0, delta=1.0)
+        self.assertAlmostEqual(map["hist[0:100:50]"], 50.0)
+
+    def test_signal_stats_merge(self):
+        a = SignalStats()
+        b = SignalStats()
+        self.assertTrue(a.insert_statistics("max,mean,var"))
+        self.assertTrue(b.insert_statistics("max,mean,var"))
+        a.insert_data([1.0, 2.0])
+        b.insert_data([3.0, 4.0], 2)
+        self.assertTrue(a.merge(b))
+        self.assertEqual(a.count(), 4)
+
+        map = a.map()
+        self.assertAlmostEqual(map["max"], 4.0)
+        self.assertAlmostEqual(map["mean"], 2.5)
+        self.assertAlmostEqual(map["var"], 5.0 / 3.0)
+
+        # Different statistics can't be merged
+        c = SignalStats()
+        self.assertTrue(c.insert_statistics("max"))
+        self.assertFalse(a.merge(c))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "gz/math/AxisAlignedBox.hh"
+#include "gz/math/AxisAlignedBoxTree.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the input generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of rays, or overlap queries, per iteration.
+static constexpr std::size_t kQueryCount = 1024;
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random boxes in a 100 m cube.
+/// \param[in] _count Number of boxes.
+static std::vector<AxisAlignedBox> RandomBoxes(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> pos(-50.0, 50.0);
+  std::uniform_real_distribution<double> size(0.1, 2.0);
+
+  std::vector<AxisAlignedBox> result;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d min(pos(gen), pos(gen), pos(gen));
+    result.emplace_back(min, min + Vector3d(size(gen), size(gen), size(gen)));
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random rays.
+/// \param[out] _origins Origins of the rays.
+/// \param[out] _dirs Directions of the rays.
+static void RandomRays(std::vector<Vector3d> &_origins,
+    std::vector<Vector3d> &_dirs)
+{
+  std::mt19937 gen(kSeed + 1);
+  std::uniform_real_distribution<double> pos(-60.0, 60.0);
+  std::uniform_real_distribution<double> dir(-1.0, 1.0);
+  for (std::size_t i = 0; i < kQueryCount; ++i)
+  {
+    _origins.emplace_back(pos(gen), pos(gen), pos(gen));
+    _dirs.emplace_back(dir(gen), dir(gen), dir(gen));
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Closest hit of each ray testing every box.
+static void BruteForceIntersect(benchmark::State &_state)
+{
+  const auto boxes = RandomBoxes(_state.range(0));
+  std::vector<Vector3d> origins, dirs;
+  RandomRays(origins, dirs);
+  for (auto _ : _state)
+  {
+    for (std::size_t r = 0; r < kQueryCount; ++r)
+    {
+      double best = 100.0;
+      std::size_t index = AxisAlignedBoxTree::NoBox;
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+      {
+        auto hit = boxes[i].Intersect(origins[r], dirs[r], 0, 100);
+        if (std::get<0>(hit) && std::get<1>(hit) < best)
+        {
+          best = std::get<1>(hit);
+          index = i;
+        }
+      }
+      benchmark::DoNotOptimize(index);
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueryCount);
+}
+BENCHMARK(BruteForceIntersect)->Arg(1000)->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void AxisAlignedBoxTreeBuild(benchmark::State &_state)
+{
+  const auto boxes = RandomBoxes(_state.range(0));
+  AxisAlignedBoxTree tree;
+  for (auto _ : _state)
+  {
+    tree.Build(boxes);
+    benchmark::DoNotOptimize(tree);
+  }
+  _state.SetItemsProcessed(_state.iterations() * boxes.size());
+}
+BENCHMARK(AxisAlignedBoxTreeBuild)->Arg(1000)->Arg(10000)->Arg(100000)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void AxisAlignedBoxTreeRefit(benchmark::State &_state)
+{
+  const auto boxes = RandomBoxes(_state.range(0));
+  AxisAlignedBoxTree tree(boxes);
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(tree.Refit(boxes));
+  _state.SetItemsProcessed(_state.iterations() * boxes.size());
+}
+BENCHMARK(AxisAlignedBoxTreeRefit)->Arg(1000)->Arg(10000)->Arg(100000)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of boxes and the number of threads.
+static void AxisAlignedBoxTreeIntersect(benchmark::State &_state)
+{
+  const AxisAlignedBoxTree tree(RandomBoxes(_state.range(0)));
+  std::vector<Vector3d> origins, dirs;
+  RandomRays(origins, dirs);
+  std::vector<std::size_t> indices(kQueryCount);
+  std::vector<double> distances(kQueryCount);
+  for (auto _ : _state)
+  {
+    tree.Intersect(origins.data(), dirs.data(), kQueryCount, 0, 100,
+        indices.data(), distances.data(),
+        static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(indices.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueryCount);
+}
+BENCHMARK(AxisAlignedBoxTreeIntersect)
+  ->Args({1000, 1})->Args({10000, 1})->Args({100000, 1})->Args({100000, 4})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Boxes overlapping each query testing every box.
+static void BruteForceOverlaps(benchmark::State &_state)
+{
+  const auto boxes = RandomBoxes(_state.range(0));
+  const auto queries = RandomBoxes(kQueryCount);
+  std::vector<std::size_t> indices;
+  for (auto _ : _state)
+  {
+    for (auto const &query : queries)
+    {
+      indices.clear();
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+      {
+        if (boxes[i].Intersects(query))
+          indices.push_back(i);
+      }
+      benchmark::DoNotOptimize(indices.data());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueryCount);
+}
+BENCHMARK(BruteForceOverlaps)->Arg(1000)->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void AxisAlignedBoxTreeOverlaps(benchmark::State &_state)
+{
+  const AxisAlignedBoxTree tree(RandomBoxes(_state.range(0)));
+  const auto queries = RandomBoxes(kQueryCount);
+  std::vector<std::size_t> indices;
+  for (auto _ : _state)
+  {
+    for (auto const &query : queries)
+    {
+      tree.Overlaps(query, indices);
+      benchmark::DoNotOptimize(indices.data());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kQueryCount);
+}
+BENCHMARK(AxisAlignedBoxTreeOverlaps)->Arg(1000)->Arg(10000)->Arg(100000)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
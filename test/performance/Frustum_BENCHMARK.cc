@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gz/math/AxisAlignedBox.hh"
+#include "gz/math/Frustum.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the input generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Boxes as a structure of arrays.
+struct BoxArrays
+{
+  /// \brief Coordinates of the minimum corners.
+  std::vector<double> minX, minY, minZ;
+
+  /// \brief Coordinates of the maximum corners.
+  std::vector<double> maxX, maxY, maxZ;
+};
+
+/////////////////////////////////////////////////
+/// \brief A camera looking at a cloud of small boxes, about a tenth of
+/// which are in view.
+static Frustum Camera()
+{
+  return Frustum(0.1, 60, Angle(1.05), 1.6,
+      Pose3d(0, 0, 1, 0, 0.1, 0.3));
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random boxes.
+/// \param[in] _count Number of boxes.
+static std::vector<AxisAlignedBox> RandomBoxes(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> pos(-60.0, 60.0);
+  std::uniform_real_distribution<double> size(0.1, 2.0);
+
+  std::vector<AxisAlignedBox> result;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    const Vector3d min(pos(gen), pos(gen), pos(gen) * 0.1);
+    result.emplace_back(min, min + Vector3d(size(gen), size(gen), size(gen)));
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Convert boxes to a structure of arrays.
+/// \param[in] _boxes The boxes.
+static BoxArrays ToArrays(const std::vector<AxisAlignedBox> &_boxes)
+{
+  BoxArrays result;
+  for (auto const &box : _boxes)
+  {
+    result.minX.push_back(box.Min().X());
+    result.minY.push_back(box.Min().Y());
+    result.minZ.push_back(box.Min().Z());
+    result.maxX.push_back(box.Max().X());
+    result.maxY.push_back(box.Max().Y());
+    result.maxZ.push_back(box.Max().Z());
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+static void FrustumContainsLoop(benchmark::State &_state)
+{
+  const Frustum frustum = Camera();
+  const auto boxes = RandomBoxes(_state.range(0));
+  std::vector<std::uint64_t> visible((boxes.size() + 63) / 64);
+  for (auto _ : _state)
+  {
+    std::fill(visible.begin(), visible.end(), 0u);
+    for (std::size_t i = 0; i < boxes.size(); ++i)
+    {
+      if (frustum.Contains(boxes[i]))
+        visible[i / 64] |= std::uint64_t(1) << (i % 64);
+    }
+    benchmark::DoNotOptimize(visible.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * boxes.size());
+}
+BENCHMARK(FrustumContainsLoop)->Arg(1000)->Arg(50000)
+  ->Unit(benchmark::kMicrosecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of boxes and the number of threads.
+static void FrustumContainsBatch(benchmark::State &_state)
+{
+  const Frustum frustum = Camera();
+  const auto boxes = ToArrays(RandomBoxes(_state.range(0)));
+  const std::size_t count = boxes.minX.size();
+  std::vector<std::uint64_t> visible((count + 63) / 64);
+  for (auto _ : _state)
+  {
+    frustum.Contains(boxes.minX.data(), boxes.minY.data(), boxes.minZ.data(),
+        boxes.maxX.data(), boxes.maxY.data(), boxes.maxZ.data(), count,
+        visible.data(), static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(visible.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * count);
+}
+BENCHMARK(FrustumContainsBatch)
+  ->Args({1000, 1})->Args({50000, 1})->Args({50000, 4})
+  ->Unit(benchmark::kMicrosecond);
+
+/////////////////////////////////////////////////
+/// \brief Move the camera and change its field of view, then test a box,
+/// as done once per frame.
+static void FrustumUpdate(benchmark::State &_state)
+{
+  Frustum frustum = Camera();
+  const AxisAlignedBox box(Vector3d(10, 2, 0), Vector3d(11, 3, 1));
+  double yaw = 0;
+  for (auto _ : _state)
+  {
+    yaw += 0.001;
+    frustum.SetPose(Pose3d(0, 0, 1, 0, 0.1, yaw));
+    frustum.SetFOV(Angle(1.0 + yaw * 0.01));
+    frustum.SetFar(60 + yaw);
+    benchmark::DoNotOptimize(frustum.Contains(box));
+  }
+}
+BENCHMARK(FrustumUpdate);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/graph/CompressedGraph.hh"
+#include "gz/math/graph/Graph.hh"
+#include "gz/math/graph/GraphAlgorithms.hh"
+
+using namespace gz;
+using namespace math;
+using namespace graph;
+
+/// \brief Seed for the edge weight generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/////////////////////////////////////////////////
+/// \brief Generate the vertices and edges of a road-like grid graph with
+/// _side * _side vertices, 4-connected, with random edge weights in [1, 2).
+/// \param[in] _side Number of vertices along each side of the grid.
+/// \param[out] _vertices The vertices.
+/// \param[out] _edges The edges.
+static void GridInput(std::size_t _side, std::vector<Vertex<int>> &_vertices,
+    std::vector<EdgeInitializer<double>> &_edges)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(1.0, 2.0);
+
+  for (std::size_t r = 0; r < _side; ++r)
+  {
+    for (std::size_t c = 0; c < _side; ++c)
+    {
+      const VertexId id = r * _side + c;
+      _vertices.emplace_back("", 0, id);
+      if (c + 1 < _side)
+        _edges.emplace_back(VertexId_P(id, id + 1), 0.0, dist(gen));
+      if (r + 1 < _side)
+        _edges.emplace_back(VertexId_P(id, id + _side), 0.0, dist(gen));
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Build an undirected grid graph, see GridInput().
+/// \param[in] _side Number of vertices along each side of the grid.
+static UndirectedGraph<int, double> GridGraph(std::size_t _side)
+{
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  GridInput(_side, vertices, edges);
+  return UndirectedGraph<int, double>(vertices, edges);
+}
+
+/////////////////////////////////////////////////
+/// \brief Build a graph one vertex and one edge at a time.
+static void GraphBuildIncremental(benchmark::State &_state)
+{
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  GridInput(_state.range(0), vertices, edges);
+  for (auto _ : _state)
+  {
+    UndirectedGraph<int, double> graph;
+    for (auto const &v : vertices)
+      graph.AddVertex(v.Name(), v.Data(), v.Id());
+    for (auto const &e : edges)
+      graph.AddEdge(e.vertices, e.data, e.weight);
+    benchmark::DoNotOptimize(graph);
+  }
+  _state.SetItemsProcessed(_state.iterations() * edges.size());
+}
+BENCHMARK(GraphBuildIncremental)->Arg(128)->Arg(512)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphLoad(benchmark::State &_state)
+{
+  std::vector<Vertex<int>> vertices;
+  std::vector<EdgeInitializer<double>> edges;
+  GridInput(_state.range(0), vertices, edges);
+  for (auto _ : _state)
+  {
+    UndirectedGraph<int, double> graph;
+    benchmark::DoNotOptimize(graph.Load(vertices, edges));
+  }
+  _state.SetItemsProcessed(_state.iterations() * edges.size());
+}
+BENCHMARK(GraphLoad)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphBreadthFirstSort(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(BreadthFirstSort(graph, 0));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(GraphBreadthFirstSort)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphDijkstra(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(Dijkstra(graph, 0));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(GraphDijkstra)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Point to point query between opposite corners of the grid.
+static void GraphDijkstraPointToPoint(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  const VertexId goal = _state.range(0) * _state.range(0) - 1;
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(Dijkstra(graph, 0, goal));
+}
+BENCHMARK(GraphDijkstraPointToPoint)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphAStar(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  const VertexId side = _state.range(0);
+  const VertexId goal = side * side - 1;
+
+  // Manhattan distance is admissible since weights are at least 1.
+  auto manhattan = [side](const Vertex<int> &_v, const Vertex<int> &_goal)
+  {
+    const double dr = std::abs(static_cast<double>(_v.Id() / side) -
+        static_cast<double>(_goal.Id() / side));
+    const double dc = std::abs(static_cast<double>(_v.Id() % side) -
+        static_cast<double>(_goal.Id() % side));
+    return dr + dc;
+  };
+
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(AStar(graph, 0, goal, manhattan));
+}
+BENCHMARK(GraphAStar)->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphBidirectionalDijkstra(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  const VertexId goal = _state.range(0) * _state.range(0) - 1;
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(BidirectionalDijkstra(graph, 0, goal));
+}
+BENCHMARK(GraphBidirectionalDijkstra)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void GraphConnectedComponents(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(ConnectedComponents(graph));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(GraphConnectedComponents)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void CompressedGraphBuild(benchmark::State &_state)
+{
+  const auto graph = GridGraph(_state.range(0));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(CompressedGraph(graph));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphBuild)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void CompressedGraphBreadthFirstSort(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(BreadthFirstSort(graph, 0));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphBreadthFirstSort)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void CompressedGraphDijkstra(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(Dijkstra(graph, 0));
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphDijkstra)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void CompressedGraphDijkstraBuffer(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  DijkstraBuffer buffer;
+  for (auto _ : _state)
+  {
+    Dijkstra(graph, 0, buffer);
+    benchmark::DoNotOptimize(buffer);
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphDijkstraBuffer)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Point to point queries in a loop, reusing the buffer.
+static void CompressedGraphDijkstraBufferPointToPoint(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  const VertexId side = _state.range(0);
+  DijkstraBuffer buffer;
+  VertexId goal = 0;
+  for (auto _ : _state)
+  {
+    Dijkstra(graph, 0, buffer, goal);
+    benchmark::DoNotOptimize(buffer);
+    goal = (goal + side + 1) % (side * side);
+  }
+}
+BENCHMARK(CompressedGraphDijkstraBufferPointToPoint)->Arg(32)->Arg(128)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the grid side and the number of threads.
+static void CompressedGraphConnectedComponentLabels(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(ConnectedComponentLabels(graph,
+          static_cast<unsigned int>(_state.range(1))));
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphConnectedComponentLabels)
+  ->Args({128, 1})->Args({512, 1})->Args({512, 4})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the grid side and the number of threads.
+static void CompressedGraphBreadthFirstLevels(benchmark::State &_state)
+{
+  const CompressedGraph graph(GridGraph(_state.range(0)));
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(BreadthFirstLevels(graph, 0,
+          static_cast<unsigned int>(_state.range(1))));
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0) *
+      _state.range(0));
+}
+BENCHMARK(CompressedGraphBreadthFirstLevels)
+  ->Args({128, 1})->Args({512, 1})->Args({512, 4})
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/Kmeans.hh"
+#include "gz/math/Rand.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+
+/// \brief Seed for the input generator and for math::Rand.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of clusters.
+static constexpr int kClusters = 16;
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed random point cloud with kClusters blobs. The
+/// points are sorted by blob, like in a scan.
+/// \param[in] _count Number of points.
+static std::vector<math::Vector3d> BlobCloud(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> centerDist(-50.0, 50.0);
+  std::normal_distribution<double> pointDist(0.0, 2.0);
+
+  std::vector<math::Vector3d> centers(kClusters);
+  for (auto &c : centers)
+    c.Set(centerDist(gen), centerDist(gen), centerDist(gen));
+
+  std::vector<math::Vector3d> result(_count);
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    result[i] = centers[i * kClusters / _count] +
+      math::Vector3d(pointDist(gen), pointDist(gen), pointDist(gen));
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points, the seeding method and the
+/// number of threads.
+static void KmeansCluster(benchmark::State &_state)
+{
+  math::Kmeans kmeans(BlobCloud(_state.range(0)));
+  kmeans.Seeding(static_cast<math::Kmeans::SeedingMethod>(_state.range(1)));
+  kmeans.Threads(static_cast<unsigned int>(_state.range(2)));
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  math::Rand::Seed(kSeed);
+  for (auto _ : _state)
+  {
+    kmeans.Cluster(kClusters, centroids, labels);
+    benchmark::DoNotOptimize(centroids.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(KmeansCluster)
+  ->Args({1 << 16, math::Kmeans::FIRST_OBSERVATIONS, 1})
+  ->Args({1 << 16, math::Kmeans::KMEANS_PLUS_PLUS, 1})
+  ->Args({1 << 16, math::Kmeans::KMEANS_PLUS_PLUS, 4})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points, the number of clusters and
+/// the assignment method. The points are uniformly distributed, like when
+/// clustering voxels.
+static void KmeansClusterAssignment(benchmark::State &_state)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(-50.0, 50.0);
+  std::vector<math::Vector3d> cloud(_state.range(0));
+  for (auto &p : cloud)
+    p.Set(dist(gen), dist(gen), dist(gen));
+
+  math::Kmeans kmeans(cloud);
+  kmeans.Assignment(
+      static_cast<math::Kmeans::AssignmentMethod>(_state.range(2)));
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  for (auto _ : _state)
+  {
+    kmeans.Cluster(static_cast<int>(_state.range(1)), centroids, labels);
+    benchmark::DoNotOptimize(centroids.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(KmeansClusterAssignment)
+  ->Args({1 << 15, 16, math::Kmeans::BRUTE_FORCE})
+  ->Args({1 << 15, 16, math::Kmeans::HAMERLY})
+  ->Args({1 << 15, 256, math::Kmeans::BRUTE_FORCE})
+  ->Args({1 << 15, 256, math::Kmeans::HAMERLY})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points and the batch size.
+static void KmeansMiniBatchCluster(benchmark::State &_state)
+{
+  math::Kmeans kmeans(BlobCloud(_state.range(0)));
+  kmeans.Seeding(math::Kmeans::KMEANS_PLUS_PLUS);
+
+  std::vector<math::Vector3d> centroids;
+  std::vector<unsigned int> labels;
+  math::Rand::Seed(kSeed);
+  for (auto _ : _state)
+  {
+    // Start from scratch on every iteration.
+    kmeans.Cluster(1, centroids, labels);
+    kmeans.MiniBatchCluster(kClusters,
+        static_cast<unsigned int>(_state.range(1)), 50, centroids, labels);
+    benchmark::DoNotOptimize(centroids.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(KmeansMiniBatchCluster)->Args({1 << 16, 1024})
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
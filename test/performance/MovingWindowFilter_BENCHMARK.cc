@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/MovingWindowFilter.hh"
+#include "gz/math/MultiChannelMovingWindowFilter.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the value generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of time steps per iteration.
+static constexpr std::size_t kSteps = 64;
+
+/// \brief Window size of the filters.
+static constexpr unsigned int kWindowSize = 10;
+
+/////////////////////////////////////////////////
+/// \brief Generate random samples, one row of all the channels per time
+/// step.
+/// \param[in] _channels Number of channels.
+/// \return The samples.
+static std::vector<double> RandomSamples(const std::size_t _channels)
+{
+  std::mt19937 gen(kSeed);
+  std::normal_distribution<double> dist(1.0, 0.2);
+  std::vector<double> samples(kSteps * _channels);
+  for (double &v : samples)
+    v = dist(gen);
+  return samples;
+}
+
+/////////////////////////////////////////////////
+/// \brief Reference for the speedup: one MovingWindowFilter per channel.
+/// Argument is the number of channels.
+static void MovingWindowFilterPerChannel(benchmark::State &_state)
+{
+  const std::size_t channels = _state.range(0);
+  const auto samples = RandomSamples(channels);
+  std::vector<MovingWindowFilter<double>> filters(channels);
+  for (auto &filter : filters)
+    filter.SetWindowSize(kWindowSize);
+  std::vector<double> out(channels);
+  for (auto _ : _state)
+  {
+    for (std::size_t s = 0; s < kSteps; ++s)
+    {
+      const double *row = samples.data() + s * channels;
+      for (std::size_t c = 0; c < channels; ++c)
+      {
+        filters[c].Update(row[c]);
+        out[c] = filters[c].Value();
+      }
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSteps * channels);
+}
+BENCHMARK(MovingWindowFilterPerChannel)->Arg(30)->Arg(300);
+
+/////////////////////////////////////////////////
+/// \brief Update all the channels of a MultiChannelMovingWindowFilter.
+/// \param[in] _state Benchmark state. Argument is the number of channels.
+/// \param[in] _kernel Kernel of the filter.
+static void MultiChannel(benchmark::State &_state,
+    const MultiChannelMovingWindowFilter<double>::Kernel _kernel)
+{
+  const std::size_t channels = _state.range(0);
+  const auto samples = RandomSamples(channels);
+  MultiChannelMovingWindowFilter<double> filter(
+      channels, kWindowSize, _kernel);
+  for (auto _ : _state)
+  {
+    for (std::size_t s = 0; s < kSteps; ++s)
+    {
+      filter.Update(samples.data() + s * channels);
+      benchmark::DoNotOptimize(filter.Values().data());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSteps * channels);
+}
+BENCHMARK_CAPTURE(MultiChannel, Mean,
+    MultiChannelMovingWindowFilter<double>::MEAN)->Arg(30)->Arg(300);
+BENCHMARK_CAPTURE(MultiChannel, Median,
+    MultiChannelMovingWindowFilter<double>::MEDIAN)->Arg(30)->Arg(300);
+BENCHMARK_CAPTURE(MultiChannel, Exponential,
+    MultiChannelMovingWindowFilter<double>::EXPONENTIAL)->Arg(30)->Arg(300);
+
+BENCHMARK_MAIN();
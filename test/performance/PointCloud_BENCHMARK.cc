@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/Matrix4.hh"
+#include "gz/math/Pose3.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+
+/// \brief Seed for the input generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Pose applied to the point clouds.
+static const math::Pose3d kPose(1.0, -2.0, 0.5, 0.1, -0.4, 2.2);
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed random point cloud.
+/// \param[in] _count Number of points.
+static std::vector<math::Vector3d> RandomCloud(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(-50.0, 50.0);
+
+  std::vector<math::Vector3d> result(_count);
+  for (auto &v : result)
+    v.Set(dist(gen), dist(gen), dist(gen));
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Baseline: transform one point at a time.
+static void PointCloudPerPoint(benchmark::State &_state)
+{
+  auto cloud = RandomCloud(_state.range(0));
+  std::vector<math::Vector3d> out(cloud.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < cloud.size(); ++i)
+      out[i] = kPose.CoordPositionAdd(cloud[i]);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * cloud.size());
+}
+BENCHMARK(PointCloudPerPoint)->Arg(1 << 10)->Arg(1 << 17);
+
+/////////////////////////////////////////////////
+static void PointCloudBatchAoS(benchmark::State &_state)
+{
+  auto cloud = RandomCloud(_state.range(0));
+  std::vector<math::Vector3d> out(cloud.size());
+  const unsigned int threads = static_cast<unsigned int>(_state.range(1));
+  for (auto _ : _state)
+  {
+    kPose.CoordPositionAdd(cloud.data(), out.data(), cloud.size(), threads);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * cloud.size());
+}
+BENCHMARK(PointCloudBatchAoS)
+  ->Args({1 << 10, 1})->Args({1 << 17, 1})->Args({1 << 17, 4})
+  ->UseRealTime();
+
+/////////////////////////////////////////////////
+static void PointCloudBatchSoA(benchmark::State &_state)
+{
+  auto cloud = RandomCloud(_state.range(0));
+  std::vector<double> x, y, z;
+  for (const auto &v : cloud)
+  {
+    x.push_back(v.X());
+    y.push_back(v.Y());
+    z.push_back(v.Z());
+  }
+  const unsigned int threads = static_cast<unsigned int>(_state.range(1));
+  for (auto _ : _state)
+  {
+    kPose.CoordPositionAdd(x.data(), y.data(), z.data(), x.size(), threads);
+    benchmark::DoNotOptimize(x.data());
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * cloud.size());
+}
+BENCHMARK(PointCloudBatchSoA)
+  ->Args({1 << 10, 1})->Args({1 << 17, 1})->Args({1 << 17, 4})
+  ->UseRealTime();
+
+/////////////////////////////////////////////////
+static void PointCloudMatrix4BatchAoS(benchmark::State &_state)
+{
+  auto cloud = RandomCloud(_state.range(0));
+  std::vector<math::Vector3d> out(cloud.size());
+  const math::Matrix4d mat(kPose);
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(
+        mat.TransformAffine(cloud.data(), out.data(), cloud.size()));
+    benchmark::ClobberMemory();
+  }
+  _state.SetItemsProcessed(_state.iterations() * cloud.size());
+}
+BENCHMARK(PointCloudMatrix4BatchAoS)->Arg(1 << 10)->Arg(1 << 17);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "gz/math/RollingMean.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the value generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of values pushed per iteration.
+static constexpr std::size_t kValues = 4096;
+
+/////////////////////////////////////////////////
+/// \brief Generate random values.
+/// \return The values.
+static std::vector<double> RandomValues()
+{
+  std::mt19937 gen(kSeed);
+  std::normal_distribution<double> dist(1.0, 0.2);
+  std::vector<double> values(kValues);
+  for (double &v : values)
+    v = dist(gen);
+  return values;
+}
+
+/////////////////////////////////////////////////
+/// \brief Reference for the speedup: a deque summed on every query, as
+/// RollingMean was implemented before it used a ring buffer.
+/// Argument is the window size.
+static void DequeMeanPushQuery(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  const std::size_t windowSize = _state.range(0);
+  std::deque<double> window;
+  for (auto _ : _state)
+  {
+    for (const double v : values)
+    {
+      window.push_back(v);
+      while (window.size() > windowSize)
+        window.pop_front();
+      benchmark::DoNotOptimize(
+          std::accumulate(window.begin(), window.end(), 0.0) / window.size());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(DequeMeanPushQuery)->RangeMultiplier(10)->Range(10, 10000);
+
+/////////////////////////////////////////////////
+/// \brief Push a value and query the mean, like DiffDriveOdometry does on
+/// each update. Argument is the window size.
+static void RollingMeanPushQuery(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  RollingMean mean(_state.range(0));
+  for (auto _ : _state)
+  {
+    for (const double v : values)
+    {
+      mean.Push(v);
+      benchmark::DoNotOptimize(mean.Mean());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(RollingMeanPushQuery)->RangeMultiplier(10)->Range(10, 10000);
+
+/////////////////////////////////////////////////
+/// \brief Push a value and query all the statistics.
+/// Argument is the window size.
+static void RollingMeanPushAllStatistics(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  RollingMean mean(_state.range(0));
+  for (auto _ : _state)
+  {
+    for (const double v : values)
+    {
+      mean.Push(v);
+      benchmark::DoNotOptimize(mean.Mean());
+      benchmark::DoNotOptimize(mean.Variance());
+      benchmark::DoNotOptimize(mean.Min());
+      benchmark::DoNotOptimize(mean.Max());
+    }
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(RollingMeanPushAllStatistics)->RangeMultiplier(10)
+  ->Range(10, 10000);
+
+BENCHMARK_MAIN();
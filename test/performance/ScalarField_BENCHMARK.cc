@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/AdditivelySeparableScalarField3.hh"
+#include "gz/math/PiecewiseScalarField3.hh"
+#include "gz/math/Polynomial3.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the point generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief A drag-like field, quadratic in x and y and linear in z.
+static const AdditivelySeparableScalarField3d<Polynomial3d> kField(
+    0.5,
+    Polynomial3d(Vector4d(0.01, 0.2, -1.0, 3.0)),
+    Polynomial3d(Vector4d(0.0, 0.3, 0.5, 0.0)),
+    Polynomial3d(Vector4d(0.0, 0.0, -9.8, 1.0)));
+
+/////////////////////////////////////////////////
+/// \brief Generate random points in a 200 m cube.
+/// \param[in] _count Number of points.
+/// \return The points.
+static std::vector<Vector3d> RandomPoints(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(-100.0, 100.0);
+  std::vector<Vector3d> points(_count);
+  for (Vector3d &p : points)
+    p.Set(dist(gen), dist(gen), dist(gen));
+  return points;
+}
+
+/////////////////////////////////////////////////
+static void Polynomial3EvaluateLoop(benchmark::State &_state)
+{
+  const auto points = RandomPoints(_state.range(0));
+  std::vector<double> x(points.size()), y(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    x[i] = points[i].X();
+  const Polynomial3d p(Vector4d(0.01, 0.2, -1.0, 3.0));
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < x.size(); ++i)
+      y[i] = p(x[i]);
+    benchmark::DoNotOptimize(y.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(Polynomial3EvaluateLoop)->Arg(1 << 20);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of values and the number of threads.
+static void Polynomial3EvaluateBatch(benchmark::State &_state)
+{
+  const auto points = RandomPoints(_state.range(0));
+  std::vector<double> x(points.size()), y(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+    x[i] = points[i].X();
+  const Polynomial3d p(Vector4d(0.01, 0.2, -1.0, 3.0));
+  for (auto _ : _state)
+  {
+    p.Evaluate(x.data(), y.data(), x.size(),
+        static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(y.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(Polynomial3EvaluateBatch)->Args({1 << 20, 1})->Args({1 << 20, 4});
+
+/////////////////////////////////////////////////
+static void SeparableFieldEvaluateLoop(benchmark::State &_state)
+{
+  const auto points = RandomPoints(_state.range(0));
+  std::vector<double> values(points.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < points.size(); ++i)
+      values[i] = kField(points[i]);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(SeparableFieldEvaluateLoop)->Arg(1 << 20);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points and the number of threads.
+static void SeparableFieldEvaluateBatch(benchmark::State &_state)
+{
+  const auto points = RandomPoints(_state.range(0));
+  std::vector<double> values;
+  for (auto _ : _state)
+  {
+    kField.Evaluate(points, values,
+        static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(SeparableFieldEvaluateBatch)
+  ->Args({1 << 20, 1})->Args({1 << 20, 4});
+
+/////////////////////////////////////////////////
+/// \brief Points stored as separate x, y and z arrays.
+static void SeparableFieldEvaluateSoa(benchmark::State &_state)
+{
+  const auto points = RandomPoints(_state.range(0));
+  std::vector<double> x(points.size()), y(points.size()), z(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i)
+  {
+    x[i] = points[i].X();
+    y[i] = points[i].Y();
+    z[i] = points[i].Z();
+  }
+  std::vector<double> values(points.size());
+  for (auto _ : _state)
+  {
+    kField.Evaluate(x.data(), y.data(), z.data(), values.data(),
+        values.size());
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(SeparableFieldEvaluateSoa)->Arg(1 << 20);
+
+/////////////////////////////////////////////////
+/// \brief Build a field over a _side x _side grid of regions spanning the
+/// 200 m cube in x and y, unbounded in z, like an ocean current model.
+/// \param[in] _side Number of regions along x and y.
+/// \return The field.
+static PiecewiseScalarField3d<AdditivelySeparableScalarField3d<Polynomial3d>>
+GridField(std::size_t _side)
+{
+  using FieldT = AdditivelySeparableScalarField3d<Polynomial3d>;
+  std::vector<PiecewiseScalarField3d<FieldT>::Piece> pieces;
+  const double size = 200.0 / static_cast<double>(_side);
+  for (std::size_t i = 0; i < _side; ++i)
+  {
+    for (std::size_t j = 0; j < _side; ++j)
+    {
+      const double x = -100.0 + i * size;
+      const double y = -100.0 + j * size;
+      pieces.push_back({Region3d(
+          Intervald::LeftClosed(x, x + size),
+          Intervald::LeftClosed(y, y + size),
+          Intervald::Unbounded), kField});
+    }
+  }
+  return PiecewiseScalarField3d<FieldT>(pieces);
+}
+
+/////////////////////////////////////////////////
+/// \brief Argument is the number of regions along x and y.
+static void PiecewiseFieldEvaluate(benchmark::State &_state)
+{
+  const auto field = GridField(_state.range(0));
+  const auto points = RandomPoints(1 << 14);
+  std::vector<double> values;
+  for (auto _ : _state)
+  {
+    field.Evaluate(points, values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * points.size());
+}
+BENCHMARK(PiecewiseFieldEvaluate)->Arg(2)->Arg(10)->Arg(50);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/SignalStats.hh"
+#include "gz/math/SignalStatsPack.hh"
+#include "gz/math/Vector3Stats.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the value generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of samples inserted per iteration.
+static constexpr std::size_t kValues = 4096;
+
+/// \brief The statistics of each benchmark.
+static const char kNames[] = "max,maxAbs,mean,min,rms,var";
+
+/////////////////////////////////////////////////
+/// \brief Generate random values.
+/// \return The values.
+static std::vector<double> RandomValues()
+{
+  std::mt19937 gen(kSeed);
+  std::normal_distribution<double> dist(1.0, 0.2);
+  std::vector<double> values(kValues);
+  for (double &v : values)
+    v = dist(gen);
+  return values;
+}
+
+/////////////////////////////////////////////////
+/// \brief Insert one sample at a time, one virtual call per statistic and
+/// sample.
+static void SignalStatsInsert(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  SignalStats stats;
+  stats.InsertStatistics(kNames);
+  for (auto _ : _state)
+  {
+    for (const double v : values)
+      stats.InsertData(v);
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(SignalStatsInsert);
+
+/////////////////////////////////////////////////
+static void SignalStatsInsertBatch(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  SignalStats stats;
+  stats.InsertStatistics(kNames);
+  for (auto _ : _state)
+  {
+    stats.InsertData(values);
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(SignalStatsInsertBatch);
+
+/////////////////////////////////////////////////
+/// \brief The same statistics composed at compile time.
+static void SignalStatsPackInsertBatch(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  SignalStatsPack<stats::Maximum, stats::MaxAbsoluteValue, stats::Mean,
+    stats::Minimum, stats::RootMeanSquare, stats::Variance> pack;
+  for (auto _ : _state)
+  {
+    pack.InsertData(values);
+    benchmark::DoNotOptimize(pack);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(SignalStatsPackInsertBatch);
+
+/////////////////////////////////////////////////
+/// \brief Latency monitoring: the median, 99th percentile and a histogram.
+static void SignalStatsQuantilesInsertBatch(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  SignalStats stats;
+  stats.InsertStatistics("p50,p99,hist[0:2:100]");
+  for (auto _ : _state)
+  {
+    stats.InsertData(values);
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * kValues);
+}
+BENCHMARK(SignalStatsQuantilesInsertBatch);
+
+/////////////////////////////////////////////////
+static void SignalQuantileValue(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  SignalQuantile quantile(0.99);
+  for (const double v : values)
+    quantile.InsertData(v);
+  for (auto _ : _state)
+    benchmark::DoNotOptimize(quantile.Value());
+}
+BENCHMARK(SignalQuantileValue);
+
+/////////////////////////////////////////////////
+/// \brief Generate a large recording, of _count random values.
+/// \param[in] _count Number of values.
+/// \return The values.
+static std::vector<double> LargeValues(const std::size_t _count)
+{
+  const auto values = RandomValues();
+  std::vector<double> large(_count);
+  for (std::size_t i = 0; i < _count; ++i)
+    large[i] = values[i % values.size()] + 1e-6 * i;
+  return large;
+}
+
+/////////////////////////////////////////////////
+/// \brief Statistics of a large recording, split across threads and
+/// merged. Argument is the number of threads.
+static void SignalStatsInsertParallel(benchmark::State &_state)
+{
+  const auto values = LargeValues(1 << 22);
+  for (auto _ : _state)
+  {
+    SignalStats stats;
+    stats.InsertStatistics(kNames);
+    stats.InsertData(values, static_cast<unsigned int>(_state.range(0)));
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(SignalStatsInsertParallel)->Arg(1)->Arg(4)
+  ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/////////////////////////////////////////////////
+/// \brief Same as SignalStatsInsertParallel, with a SignalStatsPack.
+static void SignalStatsPackInsertParallel(benchmark::State &_state)
+{
+  const auto values = LargeValues(1 << 22);
+  for (auto _ : _state)
+  {
+    SignalStatsPack<stats::Maximum, stats::MaxAbsoluteValue, stats::Mean,
+      stats::Minimum, stats::RootMeanSquare, stats::Variance> pack;
+    pack.InsertData(values, static_cast<unsigned int>(_state.range(0)));
+    benchmark::DoNotOptimize(pack);
+  }
+  _state.SetItemsProcessed(_state.iterations() * values.size());
+}
+BENCHMARK(SignalStatsPackInsertParallel)->Arg(1)->Arg(4)
+  ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/////////////////////////////////////////////////
+static void Vector3StatsInsert(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  std::vector<Vector3d> vectors;
+  for (std::size_t i = 0; i + 2 < values.size(); i += 3)
+    vectors.emplace_back(values[i], values[i + 1], values[i + 2]);
+
+  Vector3Stats stats;
+  stats.InsertStatistics(kNames);
+  for (auto _ : _state)
+  {
+    for (const auto &v : vectors)
+      stats.InsertData(v);
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * vectors.size());
+}
+BENCHMARK(Vector3StatsInsert);
+
+/////////////////////////////////////////////////
+static void Vector3StatsInsertBatch(benchmark::State &_state)
+{
+  const auto values = RandomValues();
+  std::vector<Vector3d> vectors;
+  for (std::size_t i = 0; i + 2 < values.size(); i += 3)
+    vectors.emplace_back(values[i], values[i + 1], values[i + 2]);
+
+  Vector3Stats stats;
+  stats.InsertStatistics(kNames);
+  for (auto _ : _state)
+  {
+    stats.InsertData(vectors);
+    benchmark::DoNotOptimize(stats);
+  }
+  _state.SetItemsProcessed(_state.iterations() * vectors.size());
+}
+BENCHMARK(Vector3StatsInsertBatch);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/detail/Simd.hh"
+
+// Compares the SIMD kernels used by the IGNITION_MATH_ENABLE_SIMD
+// specializations of Quaternion<double> and Vector4<double> against the
+// generic scalar code, independently of how the library was configured.
+
+/// \brief Number of precomputed inputs. Must be a power of two.
+static constexpr std::size_t kInputCount = 1024;
+
+/// \brief Mask used to wrap the input index.
+static constexpr std::size_t kInputMask = kInputCount - 1;
+
+/// \brief Four doubles, laid out like Quaternion and Vector4 data.
+struct Double4
+{
+  /// \brief Values
+  double v[4];
+};
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random four element arrays.
+/// \param[in] _seed Random seed.
+static std::vector<Double4> RandomInputs(unsigned int _seed)
+{
+  std::mt19937 gen(_seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+  std::vector<Double4> result(kInputCount);
+  for (auto &d : result)
+  {
+    for (auto &v : d.v)
+      v = dist(gen);
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Scalar reference, identical to the generic
+/// Quaternion<T>::operator*.
+static void ScalarQuaternionMultiply(const double _a[4], const double _b[4],
+    double _out[4])
+{
+  _out[0] = _a[0]*_b[0] - _a[1]*_b[1] - _a[2]*_b[2] - _a[3]*_b[3];
+  _out[1] = _a[0]*_b[1] + _a[1]*_b[0] + _a[2]*_b[3] - _a[3]*_b[2];
+  _out[2] = _a[0]*_b[2] - _a[1]*_b[3] + _a[2]*_b[0] + _a[3]*_b[1];
+  _out[3] = _a[0]*_b[3] + _a[1]*_b[2] - _a[2]*_b[1] + _a[3]*_b[0];
+}
+
+/////////////////////////////////////////////////
+/// \brief Scalar reference, identical to the generic Vector4<T>::Dot.
+static double ScalarDot4(const double _a[4], const double _b[4])
+{
+  return _a[0] * _b[0] + _a[1] * _b[1] + _a[2] * _b[2] + _a[3] * _b[3];
+}
+
+/////////////////////////////////////////////////
+/// \brief Scalar reference, identical to the generic Vector4<T>::operator+.
+static void ScalarAdd4(const double _a[4], const double _b[4],
+    double _out[4])
+{
+  for (int i = 0; i < 4; ++i)
+    _out[i] = _a[i] + _b[i];
+}
+
+/////////////////////////////////////////////////
+/// \brief Run a binary kernel that writes four doubles over the inputs.
+template<void (*Kernel)(const double *, const double *, double *)>
+static void RunKernel(benchmark::State &_state)
+{
+  auto a = RandomInputs(1);
+  auto b = RandomInputs(2);
+  Double4 out;
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    Kernel(a[i].v, b[i].v, out.v);
+    benchmark::DoNotOptimize(out);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+
+/////////////////////////////////////////////////
+/// \brief Run a dot product kernel over the inputs.
+template<double (*Kernel)(const double *, const double *)>
+static void RunDotKernel(benchmark::State &_state)
+{
+  auto a = RandomInputs(1);
+  auto b = RandomInputs(2);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(Kernel(a[i].v, b[i].v));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+
+BENCHMARK_TEMPLATE(RunKernel, ScalarQuaternionMultiply)
+  ->Name("QuaternionMultiply/scalar");
+BENCHMARK_TEMPLATE(RunKernel, ScalarAdd4)->Name("Vector4Add/scalar");
+BENCHMARK_TEMPLATE(RunDotKernel, ScalarDot4)->Name("Vector4Dot/scalar");
+
+#ifdef IGNITION_MATH_HAVE_SIMD
+using namespace gz::math::detail;
+
+BENCHMARK_TEMPLATE(RunKernel, simd::QuaternionMultiply)
+  ->Name("QuaternionMultiply/simd");
+BENCHMARK_TEMPLATE(RunKernel, simd::Add4)->Name("Vector4Add/simd");
+BENCHMARK_TEMPLATE(RunDotKernel, simd::Dot4)->Name("Vector4Dot/simd");
+#endif
+
+BENCHMARK_MAIN();
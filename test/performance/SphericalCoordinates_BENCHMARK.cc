@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/SphericalCoordinates.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the point generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/////////////////////////////////////////////////
+/// \brief Spherical coordinates with a reference point and a heading.
+static SphericalCoordinates Reference()
+{
+  return SphericalCoordinates(SphericalCoordinates::EARTH_WGS84,
+      Angle(IGN_DTOR(37.4)), Angle(IGN_DTOR(-122.1)), 30.0,
+      Angle(IGN_DTOR(15.0)));
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate random local positions within 10 km of the reference.
+/// \param[in] _count Number of points.
+static std::vector<Vector3d> LocalPoints(std::size_t _count)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> xy(-1e4, 1e4);
+  std::uniform_real_distribution<double> z(-50.0, 500.0);
+  std::vector<Vector3d> points(_count);
+  for (auto &p : points)
+    p.Set(xy(gen), xy(gen), z(gen));
+  return points;
+}
+
+/////////////////////////////////////////////////
+static void SphericalFromLocalLoop(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < in.size(); ++i)
+      out[i] = sc.SphericalFromLocalPosition(in[i]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(SphericalFromLocalLoop)->Arg(1 << 16)->Arg(1 << 20)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points and the number of threads.
+static void SphericalFromLocalBatch(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    sc.SphericalFromLocalPosition(in.data(), out.data(), in.size(),
+        static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(SphericalFromLocalBatch)
+  ->Args({1 << 16, 1})->Args({1 << 20, 1})->Args({1 << 20, 4})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void LocalFromSphericalLoop(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto local = LocalPoints(_state.range(0));
+  std::vector<Vector3d> in(local.size());
+  sc.SphericalFromLocalPosition(local.data(), in.data(), local.size());
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < in.size(); ++i)
+      out[i] = sc.LocalFromSphericalPosition(in[i]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(LocalFromSphericalLoop)->Arg(1 << 16)->Arg(1 << 20)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of points and the number of threads.
+static void LocalFromSphericalBatch(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto local = LocalPoints(_state.range(0));
+  std::vector<Vector3d> in(local.size());
+  sc.SphericalFromLocalPosition(local.data(), in.data(), local.size());
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    sc.LocalFromSphericalPosition(in.data(), out.data(), in.size(),
+        static_cast<unsigned int>(_state.range(1)));
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(LocalFromSphericalBatch)
+  ->Args({1 << 16, 1})->Args({1 << 20, 1})->Args({1 << 20, 4})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Single point conversions with the tangent plane approximation.
+static void SphericalFromLocalTangentPlaneLoop(benchmark::State &_state)
+{
+  auto sc = Reference();
+  sc.SetApproximation(SphericalCoordinates::TANGENT_PLANE);
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < in.size(); ++i)
+      out[i] = sc.SphericalFromLocalPosition(in[i]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(SphericalFromLocalTangentPlaneLoop)->Arg(1 << 20)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Batch conversions with the tangent plane approximation.
+static void SphericalFromLocalTangentPlaneBatch(benchmark::State &_state)
+{
+  auto sc = Reference();
+  sc.SetApproximation(SphericalCoordinates::TANGENT_PLANE);
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    sc.SphericalFromLocalPosition(in.data(), out.data(), in.size());
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(SphericalFromLocalTangentPlaneBatch)->Arg(1 << 20)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Single point conversions with the tangent plane approximation.
+static void LocalFromSphericalTangentPlaneLoop(benchmark::State &_state)
+{
+  auto sc = Reference();
+  const auto local = LocalPoints(_state.range(0));
+  std::vector<Vector3d> in(local.size());
+  sc.SphericalFromLocalPosition(local.data(), in.data(), local.size());
+  sc.SetApproximation(SphericalCoordinates::TANGENT_PLANE);
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < in.size(); ++i)
+      out[i] = sc.LocalFromSphericalPosition(in[i]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(LocalFromSphericalTangentPlaneLoop)->Arg(1 << 20)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief LOCAL2 to GLOBAL, which does not need trigonometric functions.
+static void LocalToGlobalLoop(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      out[i] = sc.PositionTransform(in[i], SphericalCoordinates::LOCAL2,
+          SphericalCoordinates::GLOBAL);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(LocalToGlobalLoop)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+static void LocalToGlobalBatch(benchmark::State &_state)
+{
+  const auto sc = Reference();
+  const auto in = LocalPoints(_state.range(0));
+  std::vector<Vector3d> out(in.size());
+  for (auto _ : _state)
+  {
+    sc.PositionTransform(in.data(), out.data(), in.size(),
+        SphericalCoordinates::LOCAL2, SphericalCoordinates::GLOBAL);
+    benchmark::DoNotOptimize(out.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * in.size());
+}
+BENCHMARK(LocalToGlobalBatch)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
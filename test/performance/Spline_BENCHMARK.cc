@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gz/math/Quaternion.hh"
+#include "gz/math/RotationSpline.hh"
+#include "gz/math/Spline.hh"
+
+using namespace gz;
+using namespace math;
+
+/// \brief Seed for the point generator.
+static constexpr unsigned int kSeed = 12345u;
+
+/// \brief Number of points sampled on the spline.
+static constexpr std::size_t kSamples = 100000;
+
+/////////////////////////////////////////////////
+/// \brief Fill a spline with a random walk.
+/// \param[in] _count Number of control points.
+/// \param[out] _spline The spline.
+static void RandomWalk(std::size_t _count, Spline &_spline)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  _spline.AutoCalculate(false);
+  Vector3d p;
+  for (std::size_t i = 0; i < _count; ++i)
+  {
+    p += Vector3d(1.0 + dist(gen), dist(gen), 0.1 * dist(gen));
+    _spline.AddPoint(p);
+  }
+  _spline.RecalcTangents();
+}
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of control points and the size of the
+/// arc length table.
+static void SplineInterpolateLoop(benchmark::State &_state)
+{
+  Spline spline;
+  RandomWalk(_state.range(0), spline);
+  spline.ArcLengthTableSize(static_cast<unsigned int>(_state.range(1)));
+  std::vector<Vector3d> points(kSamples);
+  for (auto _ : _state)
+  {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      points[i] = spline.Interpolate(i / (kSamples - 1.0));
+    benchmark::DoNotOptimize(points.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(SplineInterpolateLoop)
+  ->Args({10000, 0})->Args({10000, 40000})->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Arguments are the number of control points and the size of the
+/// arc length table.
+static void SplineInterpolateBatch(benchmark::State &_state)
+{
+  Spline spline;
+  RandomWalk(_state.range(0), spline);
+  spline.ArcLengthTableSize(static_cast<unsigned int>(_state.range(1)));
+  std::vector<Vector3d> points;
+  for (auto _ : _state)
+  {
+    spline.Interpolate(kSamples, points);
+    benchmark::DoNotOptimize(points.data());
+  }
+  _state.SetItemsProcessed(_state.iterations() * kSamples);
+}
+BENCHMARK(SplineInterpolateBatch)
+  ->Args({10000, 0})->Args({10000, 40000})->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Cost of building the arc length table.
+static void SplineArcLengthTable(benchmark::State &_state)
+{
+  Spline spline;
+  RandomWalk(_state.range(0), spline);
+  for (auto _ : _state)
+    spline.ArcLengthTableSize(static_cast<unsigned int>(_state.range(1)));
+}
+BENCHMARK(SplineArcLengthTable)->Args({10000, 40000})
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Build a path one point at a time, with the tangents calculated
+/// automatically.
+static void SplineBuildIncremental(benchmark::State &_state)
+{
+  Spline walk;
+  RandomWalk(_state.range(0), walk);
+  for (auto _ : _state)
+  {
+    Spline spline;
+    for (unsigned int i = 0; i < walk.PointCount(); ++i)
+      spline.AddPoint(walk.Point(i));
+    benchmark::DoNotOptimize(spline.ArcLength());
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(SplineBuildIncremental)->Arg(1000)->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+/////////////////////////////////////////////////
+/// \brief Move points in the middle of a path.
+static void SplineUpdatePoint(benchmark::State &_state)
+{
+  Spline spline;
+  RandomWalk(_state.range(0), spline);
+  spline.AutoCalculate(true);
+  unsigned int index = 0;
+  for (auto _ : _state)
+  {
+    spline.UpdatePoint(index, spline.Point(index) + Vector3d(0, 0, 0.01));
+    index = (index + 7) % spline.PointCount();
+  }
+}
+BENCHMARK(SplineUpdatePoint)->Arg(1000)->Arg(10000);
+
+/////////////////////////////////////////////////
+/// \brief Build a rotation path one point at a time, with the tangents
+/// calculated automatically.
+static void RotationSplineBuildIncremental(benchmark::State &_state)
+{
+  std::mt19937 gen(kSeed);
+  std::uniform_real_distribution<double> dist(-0.1, 0.1);
+  std::vector<Quaterniond> points;
+  Vector3d euler;
+  for (int64_t i = 0; i < _state.range(0); ++i)
+  {
+    euler += Vector3d(dist(gen), dist(gen), dist(gen));
+    points.emplace_back(euler);
+  }
+
+  for (auto _ : _state)
+  {
+    RotationSpline spline;
+    for (const Quaterniond &q : points)
+      spline.AddPoint(q);
+    benchmark::DoNotOptimize(spline.Interpolate(0.5));
+  }
+  _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(RotationSplineBuildIncremental)->Arg(1000)->Arg(10000)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
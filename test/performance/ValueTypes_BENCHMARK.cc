@@ -0,0 +1,364 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "gz/math/Helpers.hh"
+#include "gz/math/Matrix3.hh"
+#include "gz/math/Matrix4.hh"
+#include "gz/math/Pose3.hh"
+#include "gz/math/Quaternion.hh"
+#include "gz/math/Vector3.hh"
+
+using namespace gz;
+
+/// \brief Number of precomputed inputs per benchmark. Must be a power of two
+/// so that the input index can be wrapped with a mask.
+static constexpr std::size_t kInputCount = 1024;
+
+/// \brief Mask used to wrap the input index.
+static constexpr std::size_t kInputMask = kInputCount - 1;
+
+/// \brief Seed shared by all input generators, so that every run measures
+/// exactly the same data.
+static constexpr unsigned int kSeed = 12345u;
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random vectors.
+/// \param[in] _seedOffset Offset added to the seed, so that two sets of
+/// inputs in the same benchmark differ.
+static std::vector<math::Vector3d> RandomVectors(unsigned int _seedOffset = 0)
+{
+  std::mt19937 gen(kSeed + _seedOffset);
+  std::uniform_real_distribution<double> dist(-100.0, 100.0);
+
+  std::vector<math::Vector3d> result(kInputCount);
+  for (auto &v : result)
+    v.Set(dist(gen), dist(gen), dist(gen));
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random unit quaternions.
+/// \param[in] _seedOffset Offset added to the seed.
+static std::vector<math::Quaterniond> RandomQuaternions(
+    unsigned int _seedOffset = 0)
+{
+  std::mt19937 gen(kSeed + _seedOffset);
+  std::uniform_real_distribution<double> dist(-IGN_PI, IGN_PI);
+
+  std::vector<math::Quaterniond> result(kInputCount);
+  for (auto &q : result)
+    q.Euler(dist(gen), dist(gen) * 0.5, dist(gen));
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Generate a fixed set of random poses.
+/// \param[in] _seedOffset Offset added to the seed.
+static std::vector<math::Pose3d> RandomPoses(unsigned int _seedOffset = 0)
+{
+  auto pos = RandomVectors(_seedOffset);
+  auto rot = RandomQuaternions(_seedOffset);
+
+  std::vector<math::Pose3d> result(kInputCount);
+  for (std::size_t i = 0; i < kInputCount; ++i)
+    result[i].Set(pos[i], rot[i]);
+  return result;
+}
+
+/////////////////////////////////////////////////
+static void Vector3Add(benchmark::State &_state)
+{
+  auto a = RandomVectors(0);
+  auto b = RandomVectors(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i] + b[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Vector3Add);
+
+/////////////////////////////////////////////////
+static void Vector3Dot(benchmark::State &_state)
+{
+  auto a = RandomVectors(0);
+  auto b = RandomVectors(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i].Dot(b[i]));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Vector3Dot);
+
+/////////////////////////////////////////////////
+static void Vector3Cross(benchmark::State &_state)
+{
+  auto a = RandomVectors(0);
+  auto b = RandomVectors(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i].Cross(b[i]));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Vector3Cross);
+
+/////////////////////////////////////////////////
+static void Vector3Normalize(benchmark::State &_state)
+{
+  auto a = RandomVectors(0);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i].Normalized());
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Vector3Normalize);
+
+/////////////////////////////////////////////////
+static void QuaternionMultiply(benchmark::State &_state)
+{
+  auto a = RandomQuaternions(0);
+  auto b = RandomQuaternions(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i] * b[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(QuaternionMultiply);
+
+/////////////////////////////////////////////////
+static void QuaternionRotateVector(benchmark::State &_state)
+{
+  auto q = RandomQuaternions(0);
+  auto v = RandomVectors(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(q[i].RotateVector(v[i]));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(QuaternionRotateVector);
+
+/////////////////////////////////////////////////
+static void QuaternionToEuler(benchmark::State &_state)
+{
+  auto q = RandomQuaternions(0);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(q[i].Euler());
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(QuaternionToEuler);
+
+/////////////////////////////////////////////////
+static void QuaternionFromEuler(benchmark::State &_state)
+{
+  auto v = RandomVectors(0);
+  std::size_t i = 0;
+  math::Quaterniond q;
+  for (auto _ : _state)
+  {
+    q.Euler(v[i]);
+    benchmark::DoNotOptimize(q);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(QuaternionFromEuler);
+
+/////////////////////////////////////////////////
+static void QuaternionSlerp(benchmark::State &_state)
+{
+  auto a = RandomQuaternions(0);
+  auto b = RandomQuaternions(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(
+        math::Quaterniond::Slerp(0.3, a[i], b[i], true));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(QuaternionSlerp);
+
+/////////////////////////////////////////////////
+static void Pose3Compose(benchmark::State &_state)
+{
+  auto a = RandomPoses(0);
+  auto b = RandomPoses(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i] * b[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Pose3Compose);
+
+/////////////////////////////////////////////////
+static void Pose3Inverse(benchmark::State &_state)
+{
+  auto a = RandomPoses(0);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i].Inverse());
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Pose3Inverse);
+
+/////////////////////////////////////////////////
+static void Pose3CoordPositionAdd(benchmark::State &_state)
+{
+  auto p = RandomPoses(0);
+  auto v = RandomVectors(1);
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(p[i].CoordPositionAdd(v[i]));
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Pose3CoordPositionAdd);
+
+/////////////////////////////////////////////////
+static void Matrix3Multiply(benchmark::State &_state)
+{
+  auto qa = RandomQuaternions(0);
+  auto qb = RandomQuaternions(1);
+  std::vector<math::Matrix3d> a(qa.begin(), qa.end());
+  std::vector<math::Matrix3d> b(qb.begin(), qb.end());
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i] * b[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix3Multiply);
+
+/////////////////////////////////////////////////
+static void Matrix3MultiplyVector(benchmark::State &_state)
+{
+  auto q = RandomQuaternions(0);
+  auto v = RandomVectors(1);
+  std::vector<math::Matrix3d> m(q.begin(), q.end());
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(m[i] * v[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix3MultiplyVector);
+
+/////////////////////////////////////////////////
+static void Matrix3Inverse(benchmark::State &_state)
+{
+  auto q = RandomQuaternions(0);
+  std::vector<math::Matrix3d> m(q.begin(), q.end());
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(m[i].Inverse());
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix3Inverse);
+
+/////////////////////////////////////////////////
+static void Matrix4Multiply(benchmark::State &_state)
+{
+  auto pa = RandomPoses(0);
+  auto pb = RandomPoses(1);
+  std::vector<math::Matrix4d> a(pa.begin(), pa.end());
+  std::vector<math::Matrix4d> b(pb.begin(), pb.end());
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(a[i] * b[i]);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix4Multiply);
+
+/////////////////////////////////////////////////
+static void Matrix4TransformAffine(benchmark::State &_state)
+{
+  auto p = RandomPoses(0);
+  auto v = RandomVectors(1);
+  std::vector<math::Matrix4d> m(p.begin(), p.end());
+  std::size_t i = 0;
+  math::Vector3d result;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(m[i].TransformAffine(v[i], result));
+    benchmark::DoNotOptimize(result);
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix4TransformAffine);
+
+/////////////////////////////////////////////////
+static void Matrix4Inverse(benchmark::State &_state)
+{
+  auto p = RandomPoses(0);
+  std::vector<math::Matrix4d> m(p.begin(), p.end());
+  std::size_t i = 0;
+  for (auto _ : _state)
+  {
+    benchmark::DoNotOptimize(m[i].Inverse());
+    i = (i + 1) & kInputMask;
+  }
+  _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(Matrix4Inverse);
+
+BENCHMARK_MAIN();